@@ -121,6 +121,18 @@
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
     #define LV_CIRCLE_CACHE_SIZE 4
+
+    /* Set number of maximally cached rounded rectangle corners.
+    * The anti-aliased coverage of a corner is saved to draw rectangles, borders and outlines without masks
+    * (radius or border width)^2 bytes are used per corner (the most recently used ones are saved)
+    * The corners are stored in a LV_CORNER_CACHE_SIZE kB buffer which is allocated on first use and kept until `lv_deinit()`
+    * 0: to always draw the corners with masks */
+    #define LV_CORNER_CACHE_SIZE 4
+
+    /* Use the constant circle data of `src/draw/lv_draw_mask_circle_tables.c` for the radii it contains
+    * instead of calculating and caching them at runtime. Regenerate it with `scripts/circle_table_gen.py`
+    * for the radii used by your theme. About radius * 6 bytes of flash are used per radius */
+    #define LV_USE_CIRCLE_TABLES 1
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -146,6 +158,36 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE 0
 
+/*Default memory limit of the image cache in bytes. The decoded images allocated by the decoders are counted too.
+ *If the limit is reached the least recently used images are closed, preferring the ones which are faster to open.
+ *0: no limit, only the number of images (LV_IMG_CACHE_DEF_SIZE) is limited*/
+#define LV_IMG_CACHE_DEF_MEM_SIZE 0
+
+/*1: Convert the indexed, alpha only (1..4 bit), chroma keyed and (with 16 bit colors) ARGB images to the native color format
+ *when they are cached, so they are drawn as plain blits. Transparent images become RGB565A8 with 16 bit colors.
+ *Requires LV_IMG_CACHE_DEF_SIZE > 0 and uses (sizeof(lv_color_t) + 1) bytes per pixel while the image is cached*/
+#define LV_IMG_CACHE_CONVERT 0
+
+/*1: Keep the recolored (`img_recolor` / `img_recolor_opa`) variants of the images in the image cache,
+ *so the colors are mixed only once and not on every draw. The variants use the same budget as the other cached images.
+ *Requires LV_IMG_CACHE_DEF_SIZE > 0*/
+#define LV_IMG_CACHE_RECOLOR 0
+
+/*1: Keep the zoomed and/or rotated (`transform_zoom` / `transform_angle`) variants of the images in the image cache,
+ *so redrawing a statically transformed image is a plain blit. Only one transformed variant is kept per image,
+ *and it's built when the same angle, zoom, pivot and antialiasing is drawn twice in a row (so not while animating).
+ *The variants use the same budget as the other cached images.
+ *Requires LV_IMG_CACHE_DEF_SIZE > 0*/
+#define LV_IMG_CACHE_TRANSFORM 0
+
+/*1: Decode the image files and the images of the external decoders (e.g. PNG, JPG) on a worker thread registered with
+ *`lv_img_cache_async_drv_register()`. A placeholder (or the dominant color of the image if it was decoded before)
+ *is drawn until the image is ready. `lv_img_cache_prefetch()` decodes images before they are shown.
+ *The memory management is locked by the driver so the decoders can use it from the worker.
+ *The decoders and the file system drivers run on the worker too, so custom ones need to be thread-safe.
+ *Requires LV_IMG_CACHE_DEF_SIZE > 0*/
+#define LV_IMG_CACHE_ASYNC 0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS 2
@@ -401,6 +443,17 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Number of letters and kerning pairs to cache per font to find their glyph ID and kerning value quickly.
+ *Needs to be a power of 2. 0: to cache only the last letter*/
+#define LV_FONT_FMT_TXT_CACHE_SIZE 16
+
+/*Size of the glyph cache in bytes (0: disable, else min. 256).
+ *Glyphs of the built-in format fonts (except plain 8 bpp) are stored already decompressed and expanded to 8 bpp opacity
+ *so redrawing a text doesn't need to decompress and unpack its glyphs again. The least recently used glyphs are dropped.
+ *A glyph needs box_w * box_h + 24 bytes (on 32 bit MCUs): the ASCII range of Montserrat 14 is ~10 kB, of Montserrat 24 ~21 kB.
+ *Make it large enough for the glyphs of a screen, else the glyphs are expanded again in every refresh.*/
+#define LV_FONT_GLYPH_CACHE_SIZE 0
+
 /*Enable subpixel rendering*/
 #define LV_USE_FONT_SUBPX 0
 #if LV_USE_FONT_SUBPX
@@ -482,7 +535,9 @@
 #define LV_USE_LABEL      1
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
-    #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LONG_TXT_HINT 1  /*Store the lines and some extra info in labels to speed up drawing of long texts*/
+    #define LV_LABEL_SCROLL_CACHE_SIZE 0  /*>0: render the text of scrolling labels once to an A8 image of max. this size (bytes)*/
+    #define LV_LABEL_TEXT_INLINE_SIZE 0   /*>0: store texts of max. this size (bytes with the closing '\0') in the label without allocation*/
 #endif
 
 #define LV_USE_LINE       1
@@ -633,6 +688,9 @@
 
 /*PNG decoder library*/
 #define LV_USE_PNG 0
+#if LV_USE_PNG
+    #define LV_PNG_STREAM 0   /*1: decode the PNG rows directly into the native color format with a few KB of RAM*/
+#endif
 
 /*BMP decoder library*/
 #define LV_USE_BMP 0
@@ -640,6 +698,10 @@
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
 #define LV_USE_SJPG 0
+#if LV_USE_SJPG
+    #define LV_SJPG_CACHE_SIZE 0    /*Bytes of decoded slices to keep per image, at least one slice is kept*/
+    #define LV_SJPG_PREFETCH 0      /*1: decode the next slice in the background (requires LV_IMG_CACHE_ASYNC)*/
+#endif
 
 /*GIF decoder library*/
 #define LV_USE_GIF 0
@@ -647,6 +709,13 @@
 /*QR code library*/
 #define LV_USE_QRCODE 0
 
+/*Asset packs: pre-converted images, fonts and strings in one blob which is used in place (see scripts/lv_asset_pack.py)*/
+#define LV_USE_ASSET_PACK 0
+#if LV_USE_ASSET_PACK
+    #define LV_ASSET_PACK_LETTER '\0'   /*Set an upper cased letter to access the assets as files (e.g. 'Z' for "Z:name")*/
+    #define LV_ASSET_PACK_MMAP 0        /*1: lv_asset_pack_open() maps the file with POSIX mmap() instead of loading it*/
+#endif
+
 /*FreeType library*/
 #define LV_USE_FREETYPE 0
 #if LV_USE_FREETYPE
@@ -662,6 +731,9 @@
         #define LV_FREETYPE_CACHE_FT_FACES 0
         #define LV_FREETYPE_CACHE_FT_SIZES 0
     #endif
+    /*Size of the glyph cache in bytes (0: disable).
+     *It stores the rendered glyphs already converted to A8 so redrawing a text doesn't reach FreeType.*/
+    #define LV_FREETYPE_GLYPH_CACHE_SIZE (16 * 1024)
 #endif
 
 /*Rlottie library*/
@@ -40,6 +40,8 @@ parser.add_argument('--compressed', action='store_true',
 					help='Compress the bitmaps')
 parser.add_argument('--subpx', action='store_true',
 					help='3 times wider letters for sub pixel rendering')
+parser.add_argument('--cmap_hash', action='store_true',
+					help='Add a perfect hash table of the code points for faster glyph lookup (for fonts with a lot of characters)')
 
 args = parser.parse_args()
 
@@ -60,3 +62,6 @@ syms = "61441,61448,61451,61452,61452,61453,61457,61459,61461,61465,61468,61473,
 #Run the command (Add degree and bullet symbol)
 cmd = "lv_font_conv {} {} --bpp {} --size {} --font {} -r {} {} --font FontAwesome5-Solid+Brands+Regular.woff -r {} --format lvgl -o {} --force-fast-kern-format".format(subpx, compr, args.bpp, args.size, args.font, args.range[0], args.symbols[0], syms, args.output)
 os.system(cmd)
+
+if args.cmap_hash:
+	os.system("{} {} {}".format(sys.executable, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "font_cmap_hash.py"), args.output))
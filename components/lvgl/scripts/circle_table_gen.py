@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+
+'''
+Generates src/draw/lv_draw_mask_circle_tables.c with the anti-aliased circle data
+of the given radii. Radius masks use these constant tables instead of calculating
+the data at runtime and storing it in the circle cache.
+
+The calculation is the same as `_lv_draw_mask_circle_calc()` in src/draw/lv_draw_mask.c.
+
+Usage: circle_table_gen.py [--radii 1-16,20,24] [--output path/to/file.c]
+'''
+
+import argparse
+import os
+import sys
+
+SCRIPT_DIR = os.path.dirname(__file__)
+DEFAULT_OUTPUT = os.path.join(SCRIPT_DIR, "..", "src", "draw", "lv_draw_mask_circle_tables.c")
+DEFAULT_RADII = "1-16,20,24,32"
+
+if sys.version_info < (3,6,0):
+  print("Python >=3.6 is required", file=sys.stderr)
+  exit(1)
+
+
+def parse_radii(s):
+  radii = set()
+  for part in s.split(","):
+    part = part.strip()
+    if not part:
+      continue
+    if "-" in part:
+      first, last = part.split("-")
+      radii.update(range(int(first), int(last) + 1))
+    else:
+      radii.add(int(part))
+
+  for r in radii:
+    if r < 1 or r > 0x7FFF:
+      raise ValueError("Invalid radius: " + str(r))
+
+  return sorted(radii)
+
+
+def circ_calc_aa4(radius):
+  '''Return (cir_opa, opa_start_on_y, x_start_on_y) exactly as _lv_draw_mask_circle_calc() calculates them'''
+  if radius == 1:
+    return [180], [0, 1], [0]
+
+  cir_x = []
+  cir_y = []
+  cir_opa = []
+
+  # circ_init() with 4x upscaled radius
+  cp_x = radius * 4
+  cp_y = 0
+  tmp = 1 - cp_x
+
+  def circ_next():
+    nonlocal cp_x, cp_y, tmp
+    if tmp <= 0:
+      tmp += 2 * cp_y + 3
+    else:
+      tmp += 2 * (cp_y - cp_x) + 5
+      cp_x -= 1
+    cp_y += 1
+
+  def circ_cont():
+    return cp_y <= cp_x
+
+  def add(x, y, opa):
+    cir_x.append(x)
+    cir_y.append(y)
+    cir_opa.append(opa & 0xFF)
+
+  y_8th_cnt = 0
+  x_int = [cp_x >> 2, 0, 0, 0]
+  x_fract = [0, 0, 0, 0]
+
+  # Calculate an 1/8 circle
+  while circ_cont():
+    i = 0
+    while i < 4:
+      circ_next()
+      if not circ_cont():
+        break
+      x_int[i] = cp_x >> 2
+      x_fract[i] = cp_x & 0x3
+      i += 1
+    if i != 4:
+      break
+
+    if x_int[0] == x_int[3]:
+      add(x_int[0], y_8th_cnt, (x_fract[0] + x_fract[1] + x_fract[2] + x_fract[3]) * 16)
+    elif x_int[0] != x_int[1]:
+      add(x_int[0], y_8th_cnt, x_fract[0] * 16)
+      add(x_int[0] - 1, y_8th_cnt, (1 * 4 + x_fract[1] + x_fract[2] + x_fract[3]) * 16)
+    elif x_int[0] != x_int[2]:
+      add(x_int[0], y_8th_cnt, (x_fract[0] + x_fract[1]) * 16)
+      add(x_int[0] - 1, y_8th_cnt, (2 * 4 + x_fract[2] + x_fract[3]) * 16)
+    else:
+      add(x_int[0], y_8th_cnt, (x_fract[0] + x_fract[1] + x_fract[2]) * 16)
+      add(x_int[0] - 1, y_8th_cnt, (3 * 4 + x_fract[3]) * 16)
+
+    y_8th_cnt += 1
+
+  # The point on the 1/8 circle is special, calculate it manually
+  mid = radius * 723
+  mid_int = mid >> 10
+  if cir_x[-1] != mid_int or cir_y[-1] != mid_int:
+    tmp_val = mid - (mid_int << 10)
+    if tmp_val <= 512:
+      tmp_val = tmp_val * tmp_val * 2
+      tmp_val = tmp_val >> (10 + 6)
+    else:
+      tmp_val = 1024 - tmp_val
+      tmp_val = tmp_val * tmp_val * 2
+      tmp_val = tmp_val >> (10 + 6)
+      tmp_val = 15 - tmp_val
+    add(mid_int, mid_int, tmp_val * 16)
+
+  # Build the second octet by mirroring the first
+  for i in range(len(cir_x) - 2, -1, -1):
+    add(cir_y[i], cir_x[i], cir_opa[i])
+
+  opa_start_on_y = []
+  x_start_on_y = []
+  i = 0
+  y = 0
+  while i < len(cir_x):
+    opa_start_on_y.append(i)
+    x_start = cir_x[i]
+    while i < len(cir_x) and cir_y[i] == y:
+      x_start = min(x_start, cir_x[i])
+      i += 1
+    x_start_on_y.append(x_start)
+    y += 1
+
+  # `get_next_line()` reads `opa_start_on_y[y + 1]` for all `y < radius`
+  if len(opa_start_on_y) < radius + 1:
+    raise RuntimeError("Unexpected circle data for radius " + str(radius))
+
+  return cir_opa, opa_start_on_y, x_start_on_y
+
+
+def c_array(values, per_line=16):
+  lines = []
+  for i in range(0, len(values), per_line):
+    lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+  return "\n".join(lines)
+
+
+def main():
+  parser = argparse.ArgumentParser(description="Generate the built-in circle tables of the radius masks")
+  parser.add_argument("--radii", default=DEFAULT_RADII,
+                      help="comma separated list of radii and ranges (default: %(default)s)")
+  parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT, help="output C file")
+  args = parser.parse_args()
+
+  radii = parse_radii(args.radii)
+
+  out = []
+  out.append('''/**
+ * GENERATED FILE, DO NOT EDIT IT!
+ * @file lv_draw_mask_circle_tables.c
+ * Built-in circle data of the radius masks.
+ * Regenerate with `scripts/circle_table_gen.py --radii ''' + args.radii + '''`
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_mask.h"
+#if LV_DRAW_COMPLEX && LV_USE_CIRCLE_TABLES
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/''')
+
+  total = 0
+  for r in radii:
+    cir_opa, opa_start_on_y, x_start_on_y = circ_calc_aa4(r)
+    total += len(cir_opa) + 2 * len(opa_start_on_y) + 2 * len(x_start_on_y)
+    out.append("static const lv_opa_t cir_opa_%d[] = {\n%s\n};\n" % (r, c_array(cir_opa)))
+    out.append("static const uint16_t opa_start_on_y_%d[] = {\n%s\n};\n" % (r, c_array(opa_start_on_y)))
+    out.append("static const uint16_t x_start_on_y_%d[] = {\n%s\n};\n" % (r, c_array(x_start_on_y)))
+
+  out.append("/*%d bytes of circle data*/" % total)
+  out.append("static const _lv_draw_mask_radius_circle_dsc_t circle_tables[] = {")
+  for r in radii:
+    out.append("    {.cir_opa = cir_opa_%d, .x_start_on_y = x_start_on_y_%d, .opa_start_on_y = opa_start_on_y_%d, .radius = %d},"
+               % (r, r, r, r))
+  out.append('''};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const _lv_draw_mask_radius_circle_dsc_t * _lv_draw_mask_circle_table_get(lv_coord_t radius)
+{
+    switch(radius) {''')
+  for i, r in enumerate(radii):
+    out.append("        case %d:\n            return &circle_tables[%d];" % (r, i))
+  out.append('''        default:
+            return NULL;
+    }
+}
+
+#endif /*LV_DRAW_COMPLEX && LV_USE_CIRCLE_TABLES*/
+''')
+
+  with open(args.output, "w") as f:
+    f.write("\n".join(out))
+
+  print("%d radii, %d bytes of circle data written to %s" % (len(radii), total, args.output))
+
+
+if __name__ == "__main__":
+  main()
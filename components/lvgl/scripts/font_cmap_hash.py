@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+
+"""
+Add a perfect hash table of the code points to a font converted by lv_font_conv (--format lvgl).
+
+With the hash table the glyph ID of a letter is found with two table reads
+instead of searching the cmaps. It's useful for fonts with a lot of characters (e.g. CJK fonts).
+
+The file is updated in place, running it again regenerates the table.
+Example: python3 font_cmap_hash.py ../src/font/lv_font_simsun_16_cjk.c
+"""
+
+import argparse
+import math
+import re
+import sys
+
+SECTION_BEGIN = "/*--------------------\n *  CMAP HASH\n *--------------------*/\n"
+SECTION_END = "/*End of CMAP HASH*/\n"
+SECTION_ANCHOR = "/*--------------------\n *  ALL CUSTOM DATA\n *--------------------*/\n"
+
+LOAD_FACTOR = 0.85      # Number of letters / number of slots
+BUCKET_SIZE = 4         # Average number of letters in a bucket
+
+
+def mix(letter, seed):
+    """Must be the same as `cmap_hash_mix()` in lv_font_fmt_txt.c"""
+    x = (letter ^ (seed * 0x9E3779B9)) & 0xFFFFFFFF
+    x ^= x >> 16
+    x = (x * 0x85EBCA6B) & 0xFFFFFFFF
+    x ^= x >> 13
+    x = (x * 0xC2B2AE35) & 0xFFFFFFFF
+    x ^= x >> 16
+    return x
+
+
+def parse_array(src, name):
+    m = re.search(r"static\s+const\s+uint(?:8|16)_t\s+" + name + r"\[\]\s*=\s*\{(.*?)\};", src, re.S)
+    if not m:
+        sys.exit("Can't find the array " + name)
+    return [int(v, 0) for v in re.findall(r"0x[0-9a-fA-F]+|\d+", m.group(1))]
+
+
+def parse_cmaps(src):
+    m = re.search(r"static\s+const\s+lv_font_fmt_txt_cmap_t\s+cmaps\[\]\s*=\s*\{(.*?)\n\};", src, re.S)
+    if not m:
+        sys.exit("Can't find the cmaps")
+
+    cmaps = []
+    for body in re.findall(r"\{(.*?)\}", m.group(1), re.S):
+        fields = dict(re.findall(r"\.(\w+)\s*=\s*([\w]+)", body))
+        cmaps.append(fields)
+    return cmaps
+
+
+def get_letters(src):
+    """Map the letters to glyph IDs the same way as `get_glyph_dsc_id()` does with the cmaps"""
+    letters = {}
+    decided = set()
+    for cmap in parse_cmaps(src):
+        start = int(cmap["range_start"], 0)
+        length = int(cmap["range_length"], 0)
+        gid_start = int(cmap["glyph_id_start"], 0)
+        cmap_type = cmap["type"]
+
+        unicode_list = None
+        if cmap["unicode_list"] != "NULL":
+            unicode_list = parse_array(src, cmap["unicode_list"])
+        ofs_list = None
+        if cmap["glyph_id_ofs_list"] != "NULL":
+            ofs_list = parse_array(src, cmap["glyph_id_ofs_list"])
+
+        rcp_to_gid = {}
+        if cmap_type == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+            rcp_to_gid = {rcp: gid_start + rcp for rcp in range(length)}
+        elif cmap_type == "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL":
+            rcp_to_gid = {rcp: gid_start + ofs_list[rcp] for rcp in range(length)}
+        elif cmap_type == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+            rcp_to_gid = {rcp: gid_start + i for i, rcp in enumerate(unicode_list)}
+        elif cmap_type == "LV_FONT_FMT_TXT_CMAP_SPARSE_FULL":
+            rcp_to_gid = {rcp: gid_start + ofs_list[i] for i, rcp in enumerate(unicode_list)}
+        else:
+            sys.exit("Unknown cmap type " + cmap_type)
+
+        # The first cmap covering a letter decides even if it has no glyph for it
+        for rcp in range(length):
+            letter = start + rcp
+            if letter in decided:
+                continue
+            decided.add(letter)
+            gid = rcp_to_gid.get(rcp, 0)
+            if gid:
+                letters[letter] = gid
+
+    letters.pop(0, None)
+    return letters
+
+
+def build_hash(letters):
+    slot_cnt = max(1, math.ceil(len(letters) / LOAD_FACTOR))
+    bucket_cnt = max(1, math.ceil(len(letters) / BUCKET_SIZE))
+    if slot_cnt > 0xFFFF:
+        sys.exit("Too many letters for the hash table")
+    if max(letters.values()) > 0xFFFF:
+        sys.exit("Too many glyphs for the hash table")
+
+    buckets = [[] for _ in range(bucket_cnt)]
+    for letter in letters:
+        buckets[mix(letter, 0) % bucket_cnt].append(letter)
+
+    seeds = [0] * bucket_cnt
+    slots = [0] * slot_cnt
+    # Place the largest buckets first while there is a lot of free slots
+    for b in sorted(range(bucket_cnt), key=lambda i: -len(buckets[i])):
+        if not buckets[b]:
+            break
+        for seed in range(0x10000):
+            pos = [mix(letter, seed + 1) % slot_cnt for letter in buckets[b]]
+            if len(set(pos)) == len(pos) and all(slots[p] == 0 for p in pos):
+                break
+        else:
+            sys.exit("Couldn't find a seed for a bucket. Try a lower LOAD_FACTOR.")
+
+        seeds[b] = seed
+        for letter, p in zip(buckets[b], pos):
+            slots[p] = letter
+
+    glyph_ids = [letters[letter] if letter else 0 for letter in slots]
+    return seeds, slots, glyph_ids
+
+
+def format_array(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt.format(v) for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Add a perfect hash table of the code points to an LVGL font")
+    parser.add_argument("font", help="The font's C file generated by lv_font_conv")
+    args = parser.parse_args()
+
+    with open(args.font, encoding="utf-8") as f:
+        src = f.read()
+
+    # Remove the previously generated table
+    src = re.sub(re.escape(SECTION_BEGIN) + ".*?" + re.escape(SECTION_END) + r"\n*", "", src, flags=re.S)
+    src = re.sub(r"\n\s*\.cmap_hash = &cmap_hash", "", src)
+
+    if SECTION_ANCHOR not in src:
+        sys.exit("Not a font generated by lv_font_conv")
+
+    letters = get_letters(src)
+    if not letters:
+        sys.exit("The font has no letters")
+
+    seeds, slots, glyph_ids = build_hash(letters)
+
+    section = SECTION_BEGIN
+    section += "\n/*Generated by scripts/font_cmap_hash.py*/\n"
+    section += "static const uint16_t cmap_hash_seeds[] = {\n" + format_array(seeds, 12, "{}") + "\n};\n\n"
+    section += "static const uint32_t cmap_hash_letters[] = {\n" + format_array(slots, 8, "0x{:x}") + "\n};\n\n"
+    section += "static const uint16_t cmap_hash_glyph_ids[] = {\n" + format_array(glyph_ids, 12, "{}") + "\n};\n\n"
+    section += "static const lv_font_fmt_txt_cmap_hash_t cmap_hash = {\n"
+    section += "    .seeds = cmap_hash_seeds,\n"
+    section += "    .letters = cmap_hash_letters,\n"
+    section += "    .glyph_ids = cmap_hash_glyph_ids,\n"
+    section += "    .bucket_cnt = {},\n".format(len(seeds))
+    section += "    .slot_cnt = {}\n".format(len(slots))
+    section += "};\n"
+    section += SECTION_END + "\n"
+
+    src = src.replace(SECTION_ANCHOR, section + SECTION_ANCHOR)
+
+    cache_init = re.search(r"\n(\s*)\.cache = &cache,?\n", src)
+    if not cache_init:
+        sys.exit("Can't find the `.cache` field of the font descriptor")
+    src = src.replace(cache_init.group(0), "\n{0}.cache = &cache,\n{0}.cmap_hash = &cmap_hash\n".format(
+        cache_init.group(1)), 1)
+
+    with open(args.font, "w", encoding="utf-8") as f:
+        f.write(src)
+
+    print("{} letters in {} slots and {} buckets".format(len(letters), len(slots), len(seeds)))
+
+
+if __name__ == "__main__":
+    main()
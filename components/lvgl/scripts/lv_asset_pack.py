@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+
+'''
+Creates an asset pack for `src/extra/libs/asset_pack`.
+
+The assets are converted to the format of the target at build time
+so they can be used in place, without decoding, copying or converting at runtime.
+
+Usage:
+    lv_asset_pack.py -o assets.bin --color-depth 16 logo.png title=title.txt img:bg=bg.bin font:main=main.fnt
+
+Every input is `[type:][name=]path`. If no name is given the file name without extension is used.
+If no type is given it's guessed from the extension:
+    .png, .jpg, .jpeg, .bmp, .gif   img     converted with Pillow
+    .bin                            img     already converted LVGL image (lv_img_header_t + pixels)
+    .fnt, .font                     font    binary font of lv_font_conv
+    .txt                            str     UTF-8 text
+    anything else                   data    copied as it is
+'''
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x5041564C      # "LVAP"
+VERSION = 1
+
+TYPES = {"data": 0, "img": 1, "font": 2, "str": 3}
+
+CF_TRUE_COLOR = 4
+CF_TRUE_COLOR_ALPHA = 5
+CF_TRUE_COLOR_CHROMA_KEYED = 6
+CF_ALPHA_8BIT = 14
+CF_RGB565A8 = 20
+
+CF_NAMES = {
+    "true_color": CF_TRUE_COLOR,
+    "true_color_alpha": CF_TRUE_COLOR_ALPHA,
+    "true_color_chroma_keyed": CF_TRUE_COLOR_CHROMA_KEYED,
+    "alpha_8bit": CF_ALPHA_8BIT,
+    "rgb565a8": CF_RGB565A8,
+}
+
+CHROMA_KEY = (0x00, 0xFF, 0x00)     # LV_COLOR_CHROMA_KEY of lv_conf.h
+
+EXT_TYPES = {
+    ".png": "img", ".jpg": "img", ".jpeg": "img", ".bmp": "img", ".gif": "img",
+    ".bin": "img",
+    ".fnt": "font", ".font": "font",
+    ".txt": "str",
+}
+
+
+def align4(n):
+    return (n + 3) & ~3
+
+
+def pack_color(r, g, b, depth, swap):
+    if depth == 32:
+        return bytes((b, g, r))
+    if depth == 16:
+        c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        return struct.pack(">H" if swap else "<H", c)
+    return bytes((((r >> 5) << 5) | ((g >> 5) << 2) | (b >> 6),))
+
+
+def convert_img(path, depth, swap, cf_name):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("Pillow is required to convert " + path)
+
+    im = Image.open(path).convert("RGBA")
+    w, h = im.size
+    if w >= 1 << 11 or h >= 1 << 11:
+        sys.exit(path + ": images larger than 2047 px are not supported")
+
+    raw = im.tobytes()
+    px = [tuple(raw[i:i + 4]) for i in range(0, len(raw), 4)]
+    has_alpha = any(a != 0xFF for _, _, _, a in px)
+
+    if cf_name == "auto":
+        cf = CF_TRUE_COLOR_ALPHA if has_alpha else CF_TRUE_COLOR
+        if cf == CF_TRUE_COLOR_ALPHA and depth == 16:
+            cf = CF_RGB565A8
+    else:
+        cf = CF_NAMES[cf_name]
+        if cf == CF_RGB565A8 and depth != 16:
+            sys.exit("rgb565a8 requires --color-depth 16")
+
+    data = bytearray()
+    if cf == CF_TRUE_COLOR:
+        for r, g, b, _ in px:
+            data += pack_color(r, g, b, depth, swap)
+            if depth == 32:
+                data.append(0xFF)
+    elif cf == CF_TRUE_COLOR_CHROMA_KEYED:
+        for r, g, b, a in px:
+            if a < 0x80:
+                r, g, b = CHROMA_KEY
+            data += pack_color(r, g, b, depth, swap)
+            if depth == 32:
+                data.append(0xFF)
+    elif cf == CF_TRUE_COLOR_ALPHA:
+        for r, g, b, a in px:
+            data += pack_color(r, g, b, depth, swap)
+            data.append(a)
+    elif cf == CF_RGB565A8:
+        for r, g, b, _ in px:
+            data += pack_color(r, g, b, depth, swap)
+        data += bytes(a for _, _, _, a in px)
+    elif cf == CF_ALPHA_8BIT:
+        data += bytes(a for _, _, _, a in px)
+
+    header = struct.pack("<I", cf | (w << 10) | (h << 21))
+    return header + bytes(data)
+
+
+def parse_input(arg):
+    type_name = None
+    name = None
+    path = arg
+
+    head, sep, tail = path.partition(":")
+    if sep and head in TYPES:
+        type_name, path = head, tail
+
+    head, sep, tail = path.partition("=")
+    if sep:
+        name, path = head, tail
+
+    ext = os.path.splitext(path)[1].lower()
+    if type_name is None:
+        type_name = EXT_TYPES.get(ext, "data")
+    if name is None:
+        name = os.path.splitext(os.path.basename(path))[0]
+
+    return type_name, name, path, ext
+
+
+def load_asset(type_name, path, ext, args):
+    if type_name == "img" and ext != ".bin":
+        return convert_img(path, args.color_depth, args.swap, args.cf)
+
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if type_name == "img" and len(data) < 4:
+        sys.exit(path + ": not an LVGL image")
+    if type_name == "str":
+        data = data.decode("utf-8").encode("utf-8") + b"\0"
+
+    return data
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Create an LVGL asset pack")
+    parser.add_argument("inputs", nargs="+", metavar="[type:][name=]path",
+                        help="type: " + ", ".join(TYPES))
+    parser.add_argument("-o", "--output", required=True, help="the pack to create")
+    parser.add_argument("--color-depth", type=int, choices=(8, 16, 32), default=16, help="LV_COLOR_DEPTH")
+    parser.add_argument("--swap", action="store_true", help="LV_COLOR_16_SWAP")
+    parser.add_argument("--cf", choices=["auto"] + list(CF_NAMES), default="auto",
+                        help="color format of the converted images (auto: true_color or the alpha format of the depth)")
+    args = parser.parse_args()
+
+    assets = {}
+    for arg in args.inputs:
+        type_name, name, path, ext = parse_input(arg)
+        if name in assets:
+            sys.exit("Duplicated name: " + name)
+        assets[name] = (TYPES[type_name], load_asset(type_name, path, ext, args))
+
+    # The runtime looks up the names with binary search
+    names = sorted(assets, key=lambda n: n.encode("utf-8"))
+
+    header_size = 16
+    entry_size = 16
+    ofs = header_size + entry_size * len(names)
+
+    name_ofs = {}
+    for name in names:
+        name_ofs[name] = ofs
+        ofs += len(name.encode("utf-8")) + 1
+
+    data_ofs = {}
+    for name in names:
+        ofs = align4(ofs)
+        data_ofs[name] = ofs
+        ofs += len(assets[name][1])
+    size = align4(ofs)
+
+    out = bytearray(size)
+    struct.pack_into("<IIII", out, 0, MAGIC, VERSION, len(names), size)
+    for i, name in enumerate(names):
+        type_id, data = assets[name]
+        struct.pack_into("<IIII", out, header_size + i * entry_size, name_ofs[name], data_ofs[name], len(data), type_id)
+        encoded = name.encode("utf-8")
+        out[name_ofs[name]:name_ofs[name] + len(encoded)] = encoded
+        out[data_ofs[name]:data_ofs[name] + len(data)] = data
+
+    with open(args.output, "wb") as f:
+        f.write(out)
+
+    print("%s: %d assets, %d bytes" % (args.output, len(names), size))
+
+
+if __name__ == "__main__":
+    main()
@@ -187,6 +187,10 @@ void lv_init(void)
 
 void lv_deinit(void)
 {
+#if LV_DRAW_COMPLEX
+    _lv_draw_mask_deinit();
+#endif
+
     _lv_gc_clear_roots();
 
     lv_disp_set_default(NULL);
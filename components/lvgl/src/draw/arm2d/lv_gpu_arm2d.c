@@ -496,6 +496,8 @@ void lv_draw_arm2d_ctx_init(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
 
     arm2d_draw_ctx->blend = lv_draw_arm2d_blend;
     arm2d_draw_ctx->base_draw.wait_for_finish = lv_gpu_arm2d_wait_cb;
+    /*Letter runs are rendered by the SW renderer only, draw the letters one by one*/
+    arm2d_draw_ctx->base_draw.draw_letter_run = NULL;
 
 #if !__ARM_2D_HAS_HW_ACC__
     arm2d_draw_ctx->base_draw.draw_img_decoded = lv_draw_arm2d_img_decoded;
@@ -88,6 +88,34 @@ typedef struct _lv_draw_ctx_t  {
     void (*draw_letter)(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,  const lv_point_t * pos_p,
                         uint32_t letter);
 
+    /**
+     * Draw letters of a line with the same style in one step. Optional, if NULL `draw_letter` is used for each letter.
+     * @param draw_ctx      pointer to a draw context
+     * @param dsc           descriptor of the letters
+     * @param pos_y         y coordinate of the line
+     * @param letters       the letters to draw
+     * @param pos_x         x coordinate of each letter
+     * @param letter_cnt    number of letters
+     */
+    void (*draw_letter_run)(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                            const uint32_t * letters, const lv_coord_t * pos_x, uint32_t letter_cnt);
+
+    /**
+     * Render only the coverage of letters into an A8 buffer instead of drawing them.
+     * Optional, used by `lv_draw_label_to_a8()`.
+     * @param draw_ctx      pointer to a draw context
+     * @param dsc           descriptor of the letters
+     * @param pos_y         y coordinate of the line
+     * @param letters       the letters to render
+     * @param pos_x         x coordinate of each letter
+     * @param letter_cnt    number of letters
+     * @param buf           the A8 buffer. Its stride is the width of `buf_area`.
+     * @param buf_area      the area of the buffer. The letters are clipped to it.
+     */
+    void (*letter_run_to_a8)(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                             const uint32_t * letters, const lv_coord_t * pos_x, uint32_t letter_cnt,
+                             lv_opa_t * buf, const lv_area_t * buf_area);
+
 
     void (*draw_line)(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_line_dsc_t * dsc, const lv_point_t * point1,
                       const lv_point_t * point2);
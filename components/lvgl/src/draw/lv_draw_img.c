@@ -233,7 +233,49 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
 {
     if(draw_dsc->opa <= LV_OPA_MIN) return LV_RES_OK;
 
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_ASYNC
+    /*Draw a placeholder while the image is decoded in the background*/
+    lv_area_t inv_area;
+    lv_area_copy(&inv_area, coords);
+    if(draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) {
+        _lv_img_buf_get_transformed_area(&inv_area, lv_area_get_width(coords), lv_area_get_height(coords),
+                                         draw_dsc->angle, draw_dsc->zoom, &draw_dsc->pivot);
+        lv_area_move(&inv_area, coords->x1, coords->y1);
+    }
+
+    lv_color_t placeholder_color;
+    lv_opa_t placeholder_opa;
+    if(_lv_img_cache_decode_async(src, draw_dsc->recolor, draw_dsc->frame_id, &inv_area,
+                                  &placeholder_color, &placeholder_opa)) {
+        if(placeholder_opa > LV_OPA_MIN) {
+            lv_draw_rect_dsc_t rect_dsc;
+            lv_draw_rect_dsc_init(&rect_dsc);
+            rect_dsc.bg_color = placeholder_color;
+            rect_dsc.bg_opa = (placeholder_opa * draw_dsc->opa) >> 8;
+            lv_draw_rect(draw_ctx, &rect_dsc, &inv_area);
+        }
+        return LV_RES_OK;
+    }
+#endif
+
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_RECOLOR
+    /*Use the cached recolored variant of the image and draw it without recoloring*/
+    lv_draw_img_dsc_t recolored_dsc;
+    _lv_img_cache_entry_t * cdsc;
+    if(draw_dsc->recolor_opa > LV_OPA_MIN) {
+        cdsc = _lv_img_cache_open_recolor(src, draw_dsc->recolor, draw_dsc->recolor_opa, draw_dsc->frame_id);
+        if(cdsc && cdsc->recolor_opa) {
+            recolored_dsc = *draw_dsc;
+            recolored_dsc.recolor_opa = LV_OPA_TRANSP;
+            draw_dsc = &recolored_dsc;
+        }
+    }
+    else {
+        cdsc = _lv_img_cache_open(src, draw_dsc->recolor, draw_dsc->frame_id);
+    }
+#else
     _lv_img_cache_entry_t * cdsc = _lv_img_cache_open(src, draw_dsc->recolor, draw_dsc->frame_id);
+#endif
 
     if(cdsc == NULL) return LV_RES_INV;
 
@@ -244,6 +286,33 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
     else if(lv_img_cf_has_alpha(cdsc->dec_dsc.header.cf)) cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
     else cf = LV_IMG_CF_TRUE_COLOR;
 
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_TRANSFORM
+    /*Use the cached transformed variant of the image and draw it without transformation*/
+    lv_draw_img_dsc_t transformed_dsc;
+    lv_area_t transformed_coords;
+    if((draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) && cf != LV_IMG_CF_ALPHA_8BIT &&
+       cdsc->dec_dsc.img_data && cdsc->dec_dsc.error_msg == NULL) {
+        _lv_img_cache_entry_t * transformed = _lv_img_cache_open_transformed(draw_ctx, cdsc, cf, draw_dsc->angle,
+                                                                             draw_dsc->zoom, &draw_dsc->pivot,
+                                                                             draw_dsc->antialias);
+        if(transformed) {
+            cdsc = transformed;
+            cf = cdsc->dec_dsc.header.cf;
+
+            transformed_coords.x1 = coords->x1 + cdsc->ofs.x;
+            transformed_coords.y1 = coords->y1 + cdsc->ofs.y;
+            transformed_coords.x2 = transformed_coords.x1 + cdsc->dec_dsc.header.w - 1;
+            transformed_coords.y2 = transformed_coords.y1 + cdsc->dec_dsc.header.h - 1;
+            coords = &transformed_coords;
+
+            transformed_dsc = *draw_dsc;
+            transformed_dsc.angle = 0;
+            transformed_dsc.zoom = LV_IMG_ZOOM_NONE;
+            draw_dsc = &transformed_dsc;
+        }
+    }
+#endif
+
     if(cf == LV_IMG_CF_ALPHA_8BIT) {
         if(draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) {
             /* resume normal method */
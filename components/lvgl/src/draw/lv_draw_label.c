@@ -13,12 +13,14 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_mem.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define LABEL_RECOLOR_PAR_LENGTH 6
 #define LV_LABEL_HINT_UPDATE_TH 1024 /*Update the "hint" if the label's y coordinates have changed more then this*/
+#define LINE_TABLE_GROW 16           /*Number of lines to add to the line table when it's full*/
 
 /**********************
  *      TYPEDEFS
@@ -30,11 +32,27 @@ enum {
 };
 typedef uint8_t cmd_state_t;
 
+/*Renders the letters to an A8 buffer with the `letter_run_to_a8` of `parent`*/
+typedef struct {
+    lv_draw_ctx_t base;
+    lv_draw_ctx_t * parent;
+} a8_draw_ctx_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
 static uint8_t hex_char_to_num(char hex);
+static void draw_letter_run(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                            const uint32_t * letters, const lv_coord_t * pos_x, uint32_t * letter_cnt);
+static void a8_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                           uint32_t letter);
+static void a8_draw_letter_run(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                               const uint32_t * letters, const lv_coord_t * pos_x, uint32_t letter_cnt);
+static uint32_t get_line_end(const char * txt, uint32_t line_start, uint32_t line_id, const lv_draw_label_hint_t * hint,
+                             const lv_draw_label_dsc_t * dsc, lv_coord_t max_w);
+static lv_coord_t get_line_width(const char * txt, uint32_t line_start, uint32_t line_end, uint32_t line_id,
+                                 const lv_draw_label_hint_t * hint, const lv_draw_label_dsc_t * dsc);
 
 /**********************
  *  STATIC VARIABLES
@@ -106,10 +124,19 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     lv_bidi_calculate_align(&align, &base_dir, txt);
 
+    /*Use the line table of the hint if it was built for this text*/
+    if(hint && !lv_draw_label_hint_has_lines(hint, txt, font, dsc->letter_space, lv_area_get_width(coords), dsc->flag)) {
+        if(hint->lines) hint = NULL;    /*The table is outdated and the hint might be too*/
+    }
+    bool use_lines = hint && hint->lines;
+
     if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(use_lines) {
+        w = hint->lines_w;
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -118,6 +145,11 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         w = p.x;
     }
 
+#if LV_USE_BIDI
+    /*Reorder the lines only once and use the result until the text or its layout changes*/
+    bool bidi_cached = hint && lv_draw_label_hint_set_bidi(hint, txt, font, dsc->letter_space, w, dsc->flag, base_dir);
+#endif
+
     int32_t line_height_font = lv_font_get_line_height(font);
     int32_t line_height = line_height_font + dsc->line_space;
 
@@ -134,10 +166,18 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_id        = 0;
     int32_t last_line_start = -1;
 
-    /*Check the hint to use the cached info*/
-    if(hint && y_ofs == 0 && coords->y1 < 0) {
+    /*Jump to the first visible line with the line table*/
+    if(use_lines && line_height > 0 && pos.y + line_height_font < draw_ctx->clip_area->y1) {
+        line_id = (draw_ctx->clip_area->y1 - pos.y - line_height_font + line_height - 1) / line_height;
+        if(line_id >= hint->line_cnt) return;
+        line_start = hint->lines[line_id].start;
+        pos.y += line_id * line_height;
+    }
+    /*Else check the hint to use the cached info*/
+    else if(hint && !use_lines && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             hint->line_start = -1;
@@ -151,17 +191,18 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         pos.y += hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+    uint32_t line_end = get_line_end(txt, line_start, line_id, hint, dsc, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_ctx->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(txt, line_start, line_id, hint, dsc, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
-        if(hint && pos.y >= -LV_LABEL_HINT_UPDATE_TH && hint->line_start < 0) {
+        if(hint && !use_lines && pos.y >= -LV_LABEL_HINT_UPDATE_TH && hint->line_start < 0) {
             hint->line_start = line_start;
             hint->y          = pos.y - coords->y1;
             hint->coord_y    = coords->y1;
@@ -172,14 +213,14 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(txt, line_start, line_end, line_id, hint, dsc);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(txt, line_start, line_end, line_id, hint, dsc);
         pos.x += lv_area_get_width(coords) - line_width;
     }
     uint32_t sel_start = dsc->sel_start;
@@ -219,27 +260,61 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         cmd_state = CMD_STATE_WAIT;
         i         = 0;
 #if LV_USE_BIDI
-        char * bidi_txt = lv_mem_buf_get(line_end - line_start + 1);
-        _lv_bidi_process_paragraph(txt + line_start, bidi_txt, line_end - line_start, base_dir, NULL, 0);
+        const char * bidi_txt;
+        const uint16_t * bidi_pos = NULL;
+        char * bidi_buf = NULL;
+        if(bidi_cached) {
+            bidi_txt = hint->bidi_txt ? &hint->bidi_txt[line_start] : &txt[line_start];
+            if(hint->bidi_pos) bidi_pos = &hint->bidi_pos[line_start];
+        }
+        else {
+            bidi_buf = lv_mem_buf_get(line_end - line_start + 1);
+            _lv_bidi_process_paragraph(txt + line_start, bidi_buf, line_end - line_start, base_dir, NULL, 0);
+            bidi_txt = bidi_buf;
+        }
 #else
         const char * bidi_txt = txt + line_start;
 #endif
 
+        /*Index of the line's first character and the current character in the line to find the selected letters*/
+        uint32_t line_char_id = 0;
+        uint32_t char_id = 0;
+        if(sel_start != 0xFFFF && sel_end != 0xFFFF) line_char_id = _lv_txt_encoded_get_char_id(txt, line_start);
+
+        /*Collect the letters with the same color and draw them together if the draw unit supports it*/
+        uint32_t * run_letters = NULL;
+        lv_coord_t * run_x = NULL;
+        uint32_t run_cnt = 0;
+        if(draw_ctx->draw_letter_run) {
+            uint32_t max_cnt = line_end - line_start;
+            run_letters = lv_mem_buf_get(max_cnt * (sizeof(uint32_t) + sizeof(lv_coord_t)));
+            run_x = (lv_coord_t *)(run_letters + max_cnt);
+        }
+
         while(i < line_end - line_start) {
             uint32_t logical_char_pos = 0;
             if(sel_start != 0xFFFF && sel_end != 0xFFFF) {
 #if LV_USE_BIDI
-                logical_char_pos = _lv_txt_encoded_get_char_id(txt, line_start);
-                uint32_t t = _lv_txt_encoded_get_char_id(bidi_txt, i);
-                logical_char_pos += _lv_bidi_get_logical_pos(bidi_txt, NULL, line_end - line_start, base_dir, t, NULL);
+                logical_char_pos = line_char_id;
+                if(bidi_pos) {
+                    logical_char_pos += _LV_BIDI_GET_POS(bidi_pos[i]);
+                }
+                else if(bidi_cached) {
+                    logical_char_pos += char_id;
+                }
+                else {
+                    uint32_t t = _lv_txt_encoded_get_char_id(bidi_txt, i);
+                    logical_char_pos += _lv_bidi_get_logical_pos(bidi_txt, NULL, line_end - line_start, base_dir, t, NULL);
+                }
 #else
-                logical_char_pos = _lv_txt_encoded_get_char_id(txt, line_start + i);
+                logical_char_pos = line_char_id + char_id;
 #endif
             }
 
             uint32_t letter;
             uint32_t letter_next;
             _lv_txt_encoded_letter_next_2(bidi_txt, &letter, &letter_next, &i);
+            char_id++;
             /*Handle the re-color command*/
             if((dsc->flag & LV_TEXT_FLAG_RECOLOR) != 0) {
                 if(letter == (uint32_t)LV_TXT_COLOR_CMD[0]) {
@@ -288,6 +363,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
             if(sel_start != 0xFFFF && sel_end != 0xFFFF) {
                 if(logical_char_pos >= sel_start && logical_char_pos < sel_end) {
+                    draw_letter_run(draw_ctx, &dsc_mod, pos.y, run_letters, run_x, &run_cnt);
                     lv_area_t sel_coords;
                     sel_coords.x1 = pos.x;
                     sel_coords.y1 = pos.y;
@@ -298,14 +374,30 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
                 }
             }
 
-            dsc_mod.color = color;
-            lv_draw_letter(draw_ctx, &dsc_mod, &pos, letter);
+            if(run_letters) {
+                if(dsc_mod.color.full != color.full) {
+                    draw_letter_run(draw_ctx, &dsc_mod, pos.y, run_letters, run_x, &run_cnt);
+                    dsc_mod.color = color;
+                }
+                run_letters[run_cnt] = letter;
+                run_x[run_cnt] = pos.x;
+                run_cnt++;
+            }
+            else {
+                dsc_mod.color = color;
+                lv_draw_letter(draw_ctx, &dsc_mod, &pos, letter);
+            }
 
             if(letter_w > 0) {
                 pos.x += letter_w + dsc->letter_space;
             }
         }
 
+        if(run_letters) {
+            draw_letter_run(draw_ctx, &dsc_mod, pos.y, run_letters, run_x, &run_cnt);
+            lv_mem_buf_release(run_letters);
+        }
+
         if(dsc->decor & LV_TEXT_DECOR_STRIKETHROUGH) {
             lv_point_t p1;
             lv_point_t p2;
@@ -329,26 +421,24 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         }
 
 #if LV_USE_BIDI
-        lv_mem_buf_release(bidi_txt);
-        bidi_txt = NULL;
+        if(bidi_buf) lv_mem_buf_release(bidi_buf);
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_id++;
+        line_end = get_line_end(txt, line_start, line_id, hint, dsc, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(txt, line_start, line_end, line_id, hint, dsc);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(txt, line_start, line_end, line_id, hint, dsc);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -367,11 +457,416 @@ void lv_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
     draw_ctx->draw_letter(draw_ctx, dsc, pos_p, letter);
 }
 
+lv_res_t lv_draw_label_to_a8(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_area_t * coords,
+                             const char * txt, lv_draw_label_hint_t * hint, lv_opa_t * buf, const lv_area_t * buf_area)
+{
+    if(draw_ctx->letter_run_to_a8 == NULL) return LV_RES_INV;
+
+    lv_area_t area = *buf_area;
+    a8_draw_ctx_t a8_ctx;
+    lv_memset_00(&a8_ctx, sizeof(a8_ctx));
+    a8_ctx.base.buf = buf;
+    a8_ctx.base.buf_area = &area;
+    a8_ctx.base.clip_area = &area;
+    a8_ctx.base.draw_letter = a8_draw_letter;
+    a8_ctx.base.draw_letter_run = a8_draw_letter_run;
+    a8_ctx.parent = draw_ctx;
+
+    lv_draw_label(&a8_ctx.base, dsc, coords, txt, hint);
+
+    return LV_RES_OK;
+}
+
+bool lv_draw_label_hint_set_lines(lv_draw_label_hint_t * hint, const char * txt, const lv_font_t * font,
+                                  lv_coord_t letter_space, lv_coord_t max_w, lv_text_flag_t flag)
+{
+    lv_draw_label_hint_clear_lines(hint);
+
+    if(txt == NULL || font == NULL) return false;
+    if(flag & LV_TEXT_FLAG_EXPAND) max_w = LV_COORD_MAX;
+
+    /*Single line texts are drawn quickly anyway so don't waste memory on them*/
+    uint32_t line_end = _lv_txt_get_next_line(txt, font, letter_space, max_w, NULL, flag);
+    if(txt[line_end] == '\0') return false;
+
+    uint32_t size = 0;
+    uint32_t cnt = 0;
+    uint32_t line_start = 0;
+    lv_coord_t lines_w = 0;
+    lv_draw_label_line_t * lines = NULL;
+    while(1) {
+        /*Keep place for the closing item too*/
+        if(cnt + 1 >= size) {
+            size += LINE_TABLE_GROW;
+            lv_draw_label_line_t * new_lines = lv_mem_realloc(lines, size * sizeof(lv_draw_label_line_t));
+            if(new_lines == NULL) {
+                LV_LOG_WARN("couldn't allocate the line table");
+                lv_mem_free(lines);
+                return false;
+            }
+            lines = new_lines;
+        }
+
+        lines[cnt].start = line_start;
+        if(txt[line_start] == '\0') break;
+
+        lines[cnt].width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, letter_space, flag);
+        lines_w = LV_MAX(lines_w, lines[cnt].width);
+        cnt++;
+
+        line_start = line_end;
+        line_end += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+    }
+    lines[cnt].width = 0;
+
+    hint->lines = lines;
+    hint->line_cnt = cnt;
+    hint->lines_w = lines_w;
+    hint->lines_txt = txt;
+    hint->lines_font = font;
+    hint->lines_max_w = max_w;
+    hint->lines_letter_space = letter_space;
+    hint->lines_flag = flag;
+
+    return true;
+}
+
+void lv_draw_label_hint_clear_lines(lv_draw_label_hint_t * hint)
+{
+#if LV_USE_BIDI
+    lv_draw_label_hint_clear_bidi(hint);
+#endif
+
+    if(hint->lines) lv_mem_free(hint->lines);
+    hint->lines = NULL;
+    hint->line_cnt = 0;
+    hint->lines_w = 0;
+    hint->lines_txt = NULL;
+}
+
+bool lv_draw_label_hint_has_lines(const lv_draw_label_hint_t * hint, const char * txt, const lv_font_t * font,
+                                  lv_coord_t letter_space, lv_coord_t max_w, lv_text_flag_t flag)
+{
+    if(hint->lines == NULL) return false;
+    if(hint->lines_txt != txt || hint->lines_font != font) return false;
+    if(hint->lines_letter_space != letter_space || hint->lines_flag != flag) return false;
+
+    /*The width doesn't matter if the lines are broken only at new line characters*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) return true;
+    return hint->lines_max_w == max_w;
+}
+
+bool lv_draw_label_hint_update_lines(lv_draw_label_hint_t * hint, const char * txt, uint32_t pos, uint32_t del_len,
+                                     uint32_t ins_len)
+{
+#if LV_USE_BIDI
+    lv_draw_label_hint_clear_bidi(hint);
+#endif
+
+    if(hint->lines == NULL) return false;
+
+    lv_draw_label_line_t * lines = hint->lines;
+    uint32_t line_cnt = hint->line_cnt;
+
+    /*The line break at the end of a line depends on the first word(s) of the next line,
+     *so start wrapping before the edited line. Lines after a new line character are not affected by the previous lines.*/
+    uint32_t first = lv_draw_label_hint_get_line(hint, pos);
+    uint32_t i;
+    for(i = 0; i < 2 && first > 0; i++) {
+        char prev = txt[lines[first].start - 1];
+        if(prev == '\n' || prev == '\r') break;
+        first--;
+    }
+
+    /*Wrap the lines again until a line starts at the same place as before. From there the lines are the same.*/
+    uint32_t edit_end = pos + ins_len;
+    uint32_t old_id = first + 1;
+    uint32_t line_start = lines[first].start;
+    uint32_t new_cnt = 0;
+    uint32_t new_size = 0;
+    lv_draw_label_line_t * new_lines = NULL;
+    while(1) {
+        if(line_start >= edit_end) {
+            while(old_id <= line_cnt && (lines[old_id].start < pos + del_len ||
+                                         lines[old_id].start - del_len + ins_len < line_start)) {
+                old_id++;
+            }
+            if(old_id <= line_cnt && lines[old_id].start - del_len + ins_len == line_start) break;
+        }
+
+        if(txt[line_start] == '\0') {
+            old_id = line_cnt + 1; /*No old line to keep*/
+            break;
+        }
+
+        if(new_cnt >= new_size) {
+            new_size += LINE_TABLE_GROW;
+            lv_draw_label_line_t * tmp = lv_mem_realloc(new_lines, new_size * sizeof(lv_draw_label_line_t));
+            if(tmp == NULL) {
+                LV_LOG_WARN("couldn't allocate the line table");
+                lv_mem_free(new_lines);
+                lv_draw_label_hint_clear_lines(hint);
+                return false;
+            }
+            new_lines = tmp;
+        }
+
+        uint32_t line_len = _lv_txt_get_next_line(&txt[line_start], hint->lines_font, hint->lines_letter_space,
+                                                  hint->lines_max_w, NULL, hint->lines_flag);
+        new_lines[new_cnt].start = line_start;
+        new_lines[new_cnt].width = lv_txt_get_width(&txt[line_start], line_len, hint->lines_font, hint->lines_letter_space,
+                                                    hint->lines_flag);
+        new_cnt++;
+        line_start += line_len;
+    }
+
+    /*Keep the lines before the first wrapped line and after the matching line (with the closing item)*/
+    uint32_t keep_cnt = old_id <= line_cnt ? line_cnt + 1 - old_id : 0;
+    uint32_t total_cnt = first + new_cnt + keep_cnt;   /*With the closing item*/
+    if(keep_cnt == 0) total_cnt++;
+
+    if(total_cnt < 3) {
+        /*Single line texts have no line table*/
+        lv_mem_free(new_lines);
+        lv_draw_label_hint_clear_lines(hint);
+        return false;
+    }
+
+    if(total_cnt > line_cnt + 1) {
+        lv_draw_label_line_t * tmp = lv_mem_realloc(lines, total_cnt * sizeof(lv_draw_label_line_t));
+        if(tmp == NULL) {
+            LV_LOG_WARN("couldn't allocate the line table");
+            lv_mem_free(new_lines);
+            lv_draw_label_hint_clear_lines(hint);
+            return false;
+        }
+        lines = tmp;
+        hint->lines = lines;
+    }
+
+    if(keep_cnt) {
+        memmove(&lines[first + new_cnt], &lines[old_id], keep_cnt * sizeof(lv_draw_label_line_t));
+        for(i = first + new_cnt; i < total_cnt; i++) {
+            lines[i].start = lines[i].start - del_len + ins_len;
+        }
+    }
+    else {
+        lines[total_cnt - 1].start = line_start;
+        lines[total_cnt - 1].width = 0;
+    }
+
+    if(new_cnt) lv_memcpy(&lines[first], new_lines, new_cnt * sizeof(lv_draw_label_line_t));
+    lv_mem_free(new_lines);
+
+    if(total_cnt < line_cnt + 1) {
+        lv_draw_label_line_t * tmp = lv_mem_realloc(lines, total_cnt * sizeof(lv_draw_label_line_t));
+        if(tmp) hint->lines = tmp;
+    }
+
+    hint->line_cnt = total_cnt - 1;
+    hint->lines_txt = txt;
+    hint->line_start = -1;
+
+    lv_coord_t lines_w = 0;
+    for(i = 0; i < hint->line_cnt; i++) {
+        lines_w = LV_MAX(lines_w, hint->lines[i].width);
+    }
+    hint->lines_w = lines_w;
+
+    return true;
+}
+
+uint32_t lv_draw_label_hint_get_line(const lv_draw_label_hint_t * hint, uint32_t byte_id)
+{
+    /*Find the last line starting before or at the index*/
+    uint32_t min = 0;
+    uint32_t max = hint->line_cnt > 0 ? hint->line_cnt - 1 : 0;
+    while(min < max) {
+        uint32_t mid = (min + max + 1) / 2;
+        if(hint->lines[mid].start <= byte_id) min = mid;
+        else max = mid - 1;
+    }
+
+    return min;
+}
+
+#if LV_USE_BIDI
+bool lv_draw_label_hint_set_bidi(lv_draw_label_hint_t * hint, const char * txt, const lv_font_t * font,
+                                 lv_coord_t letter_space, lv_coord_t max_w, lv_text_flag_t flag, lv_base_dir_t base_dir)
+{
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_w = LV_COORD_MAX;
+
+    if(hint->bidi_src == txt && hint->bidi_font == font && hint->bidi_letter_space == letter_space &&
+       hint->bidi_max_w == max_w && hint->bidi_flag == flag && hint->bidi_dir == base_dir) {
+        return true;
+    }
+
+    lv_draw_label_hint_clear_bidi(hint);
+    if(txt == NULL || font == NULL) return false;
+
+    uint32_t len = strlen(txt);
+    char * bidi_txt = lv_mem_alloc(len + 1);
+    uint16_t * bidi_pos = lv_mem_alloc(len * sizeof(uint16_t) + 1);
+    uint16_t * pos_conv = NULL;
+    if(bidi_txt == NULL || bidi_pos == NULL) goto fail;
+
+    /*Use the same lines as the drawing*/
+    bool use_lines = lv_draw_label_hint_has_lines(hint, txt, font, letter_space, max_w, flag);
+    bool same = true;
+    uint32_t pos_conv_size = 0;
+    uint32_t line_id = 0;
+    uint32_t line_start = 0;
+    while(txt[line_start] != '\0') {
+        uint32_t line_end;
+        if(use_lines) line_end = hint->lines[line_id + 1].start;
+        else line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        line_id++;
+
+        uint32_t line_len = line_end - line_start;
+        uint32_t char_cnt = _lv_txt_encoded_get_char_id(&txt[line_start], line_len);
+        if(char_cnt > 0x7FFF) goto fail;    /*The positions are stored on 15 bits*/
+        if(char_cnt > pos_conv_size) {
+            pos_conv_size = char_cnt;
+            lv_mem_free(pos_conv);
+            pos_conv = lv_mem_alloc(pos_conv_size * sizeof(uint16_t));
+            if(pos_conv == NULL) goto fail;
+        }
+
+        _lv_bidi_process_paragraph(&txt[line_start], &bidi_txt[line_start], line_len, base_dir, pos_conv, char_cnt);
+
+        /*Store the position of each character on all of its bytes to find it by byte index*/
+        uint32_t i = 0;
+        uint32_t c = 0;
+        while(i < line_len) {
+            uint32_t i_next = line_start + i;
+            _lv_txt_encoded_next(bidi_txt, &i_next);
+            i_next -= line_start;
+            if(pos_conv[c] != c) same = false;
+            while(i < i_next) {
+                bidi_pos[line_start + i] = pos_conv[c];
+                i++;
+            }
+            c++;
+        }
+
+        line_start = line_end;
+    }
+    bidi_txt[len] = '\0';
+    lv_mem_free(pos_conv);
+
+    /*Don't waste memory if the visual order is the same as the logical (e.g. an LTR text)*/
+    if(same && memcmp(bidi_txt, txt, len) == 0) {
+        lv_mem_free(bidi_txt);
+        lv_mem_free(bidi_pos);
+        bidi_txt = NULL;
+        bidi_pos = NULL;
+    }
+
+    hint->bidi_txt = bidi_txt;
+    hint->bidi_pos = bidi_pos;
+    hint->bidi_src = txt;
+    hint->bidi_font = font;
+    hint->bidi_max_w = max_w;
+    hint->bidi_letter_space = letter_space;
+    hint->bidi_flag = flag;
+    hint->bidi_dir = base_dir;
+    return true;
+
+fail:
+    LV_LOG_WARN("couldn't allocate the text in visual order");
+    lv_mem_free(bidi_txt);
+    lv_mem_free(bidi_pos);
+    lv_mem_free(pos_conv);
+    return false;
+}
+
+void lv_draw_label_hint_clear_bidi(lv_draw_label_hint_t * hint)
+{
+    if(hint->bidi_txt) lv_mem_free(hint->bidi_txt);
+    if(hint->bidi_pos) lv_mem_free(hint->bidi_pos);
+    hint->bidi_txt = NULL;
+    hint->bidi_pos = NULL;
+    hint->bidi_src = NULL;
+}
+#endif
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Draw the collected letters of a run and empty the run
+ * @param draw_ctx pointer to a draw context
+ * @param dsc the label's draw descriptor with the color of the run
+ * @param pos_y y coordinate of the line
+ * @param letters the letters of the run. If NULL nothing happens.
+ * @param pos_x x coordinate of each letter
+ * @param letter_cnt number of letters in the run. Set to 0 when the letters are drawn.
+ */
+static void draw_letter_run(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                            const uint32_t * letters, const lv_coord_t * pos_x, uint32_t * letter_cnt)
+{
+    if(letters == NULL || *letter_cnt == 0) return;
+
+    draw_ctx->draw_letter_run(draw_ctx, dsc, pos_y, letters, pos_x, *letter_cnt);
+    *letter_cnt = 0;
+}
+
+static void a8_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                           uint32_t letter)
+{
+    a8_draw_letter_run(draw_ctx, dsc, pos_p->y, &letter, &pos_p->x, 1);
+}
+
+static void a8_draw_letter_run(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                               const uint32_t * letters, const lv_coord_t * pos_x, uint32_t letter_cnt)
+{
+    lv_draw_ctx_t * parent = ((a8_draw_ctx_t *)draw_ctx)->parent;
+    parent->letter_run_to_a8(parent, dsc, pos_y, letters, pos_x, letter_cnt, draw_ctx->buf, draw_ctx->buf_area);
+}
+
+/**
+ * Get the end of a line from the line table of the hint or by wrapping the text
+ * @param txt the text
+ * @param line_start start index of the line
+ * @param line_id index of the line. Used only with the line table
+ * @param hint a hint or NULL
+ * @param dsc the label's draw descriptor
+ * @param max_w max width of the lines
+ * @return index of the first character of the next line
+ */
+static uint32_t get_line_end(const char * txt, uint32_t line_start, uint32_t line_id, const lv_draw_label_hint_t * hint,
+                             const lv_draw_label_dsc_t * dsc, lv_coord_t max_w)
+{
+    if(hint && hint->lines) {
+        if(line_id >= hint->line_cnt) return line_start;
+        return hint->lines[line_id + 1].start;
+    }
+
+    return line_start + _lv_txt_get_next_line(&txt[line_start], dsc->font, dsc->letter_space, max_w, NULL, dsc->flag);
+}
+
+/**
+ * Get the width of a line from the line table of the hint or by measuring it
+ * @param txt the text
+ * @param line_start start index of the line
+ * @param line_end index of the first character of the next line
+ * @param line_id index of the line. Used only with the line table
+ * @param hint a hint or NULL
+ * @param dsc the label's draw descriptor
+ * @return width of the line
+ */
+static lv_coord_t get_line_width(const char * txt, uint32_t line_start, uint32_t line_end, uint32_t line_id,
+                                 const lv_draw_label_hint_t * hint, const lv_draw_label_dsc_t * dsc)
+{
+    if(hint && hint->lines) {
+        if(line_id >= hint->line_cnt) return 0;
+        return hint->lines[line_id].width;
+    }
+
+    return lv_txt_get_width(&txt[line_start], line_end - line_start, dsc->font, dsc->letter_space, dsc->flag);
+}
+
 /**
  * Convert a hexadecimal characters to a number (0..15)
  * @param hex Pointer to a hexadecimal character (0..9, A..F)
@@ -46,11 +46,21 @@ typedef struct {
     lv_blend_mode_t blend_mode: 3;
 } lv_draw_label_dsc_t;
 
+/** Start and width of a line of a text. See `lv_draw_label_hint_t`*/
+typedef struct {
+    uint32_t start;         /**< Byte index of the line's first character*/
+    lv_coord_t width;       /**< Width of the line*/
+} lv_draw_label_line_t;
+
 /** Store some info to speed up drawing of very large texts
  * It takes a lot of time to get the first visible character because
  * all the previous characters needs to be checked to calculate the positions.
  * This structure stores an earlier (e.g. at -1000 px) coordinate and the index of that line.
- * Therefore the calculations can start from here.*/
+ * Therefore the calculations can start from here.
+ *
+ * If the text was split to lines with `lv_draw_label_hint_set_lines()`
+ * the line table is used instead: the first visible line is found without
+ * checking the previous lines and the text is not wrapped again.*/
 typedef struct _lv_draw_label_hint_t {
     /** Index of the line at `y` coordinate*/
     int32_t line_start;
@@ -61,6 +71,40 @@ typedef struct _lv_draw_label_hint_t {
     /** The 'y1' coordinate of the label when the hint was saved.
      * Used to invalidate the hint if the label has moved too much.*/
     int32_t coord_y;
+
+    /** Start and width of the lines or NULL. The item after the last line holds the end of the text.*/
+    lv_draw_label_line_t * lines;
+
+    /** Number of lines in `lines`*/
+    uint32_t line_cnt;
+
+    /** Width of the longest line*/
+    lv_coord_t lines_w;
+
+    /** The parameters the line table was made with. It's used only if the same text is drawn with them.*/
+    const char * lines_txt;
+    const lv_font_t * lines_font;
+    lv_coord_t lines_max_w;
+    lv_coord_t lines_letter_space;
+    lv_text_flag_t lines_flag;
+
+#if LV_USE_BIDI
+    /** The text with all lines in visual order, or NULL if it's the same as the original text.
+     * See `lv_draw_label_hint_set_bidi()`*/
+    char * bidi_txt;
+
+    /** Logical position and direction of the characters of `bidi_txt` in their line
+     * (in the format of `_lv_bidi_process_paragraph()`'s `pos_conv_out`) for every byte, or NULL*/
+    uint16_t * bidi_pos;
+
+    /** The parameters the visual text was made with*/
+    const char * bidi_src;
+    const lv_font_t * bidi_font;
+    lv_coord_t bidi_max_w;
+    lv_coord_t bidi_letter_space;
+    lv_text_flag_t bidi_flag;
+    lv_base_dir_t bidi_dir;
+#endif
 } lv_draw_label_hint_t;
 
 struct _lv_draw_ctx_t;
@@ -85,6 +129,104 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(struct _lv_draw_ctx_t * draw_ctx, const
 void lv_draw_letter(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,  const lv_point_t * pos_p,
                     uint32_t letter);
 
+/**
+ * Render the coverage of a text into an A8 buffer instead of drawing it.
+ * Re-coloring, text selection and decorations are not supported.
+ * @param draw_ctx  pointer to a draw context. Its `letter_run_to_a8` callback renders the letters.
+ * @param dsc       pointer to draw descriptor
+ * @param coords    coordinates of the label relative to the buffer
+ * @param txt       `\0` terminated text to write
+ * @param hint      pointer to a `lv_draw_label_hint_t` variable or NULL
+ * @param buf       the A8 buffer. Its stride is the width of `buf_area`.
+ * @param buf_area  the area of the buffer
+ * @return          LV_RES_OK: the text is rendered; LV_RES_INV: the draw context can't render to an A8 buffer
+ */
+lv_res_t lv_draw_label_to_a8(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                             const lv_area_t * coords, const char * txt, lv_draw_label_hint_t * hint,
+                             lv_opa_t * buf, const lv_area_t * buf_area);
+
+/**
+ * Split a text to lines and store the start and width of the lines in a hint.
+ * If the same text is drawn with this hint and the same parameters,
+ * `lv_draw_label()` uses the stored lines instead of wrapping the text again.
+ * The text must not be modified while the line table is in use.
+ * @param hint pointer to a hint. Its previous line table is freed.
+ * @param txt `\0` terminated text
+ * @param font font of the text
+ * @param letter_space letter space of the text
+ * @param max_w max width of the lines (ignored with `LV_TEXT_FLAG_EXPAND/FIT`)
+ * @param flag the text flags
+ * @return true: the line table is created; false: the text has only one line or out of memory
+ */
+bool lv_draw_label_hint_set_lines(lv_draw_label_hint_t * hint, const char * txt, const lv_font_t * font,
+                                  lv_coord_t letter_space, lv_coord_t max_w, lv_text_flag_t flag);
+
+/**
+ * Free the line table of a hint
+ * @param hint pointer to a hint
+ */
+void lv_draw_label_hint_clear_lines(lv_draw_label_hint_t * hint);
+
+/**
+ * Check if the line table of a hint can be used to draw a text
+ * @param hint pointer to a hint
+ * @param txt the text to draw
+ * @param font font of the text
+ * @param letter_space letter space of the text
+ * @param max_w max width of the lines
+ * @param flag the text flags
+ * @return true: the line table has been made for these parameters
+ */
+bool lv_draw_label_hint_has_lines(const lv_draw_label_hint_t * hint, const char * txt, const lv_font_t * font,
+                                  lv_coord_t letter_space, lv_coord_t max_w, lv_text_flag_t flag);
+
+/**
+ * Update the line table of a hint after `del_len` bytes of the text were replaced by `ins_len` bytes at `pos`.
+ * Only the lines around the edited part are wrapped again until the line breaks get the same as before.
+ * The other parameters of the text are the same as in the last `lv_draw_label_hint_set_lines()`.
+ * @param hint pointer to a hint with a line table
+ * @param txt the edited text. Can be at a different address than the original text.
+ * @param pos byte index of the edit
+ * @param del_len number of bytes deleted from the old text
+ * @param ins_len number of bytes inserted to the new text
+ * @return true: the line table is updated; false: the line table is freed
+ *         (there was no line table, the text has only one line or out of memory)
+ */
+bool lv_draw_label_hint_update_lines(lv_draw_label_hint_t * hint, const char * txt, uint32_t pos, uint32_t del_len,
+                                     uint32_t ins_len);
+
+/**
+ * Find the line of a character in the line table of a hint
+ * @param hint pointer to a hint with a line table
+ * @param byte_id byte index of a character
+ * @return index of the line containing the character, or the last line if the index is at the end of the text
+ */
+uint32_t lv_draw_label_hint_get_line(const lv_draw_label_hint_t * hint, uint32_t byte_id);
+
+#if LV_USE_BIDI
+/**
+ * Reorder the lines of a text to visual order and store the result in a hint.
+ * It's done only if the text or its parameters are different from the last call,
+ * else the stored result is used. The same lines are used as in `lv_draw_label()`.
+ * @param hint pointer to a hint
+ * @param txt `\0` terminated text
+ * @param font font of the text
+ * @param letter_space letter space of the text
+ * @param max_w max width of the lines (ignored with `LV_TEXT_FLAG_EXPAND/FIT`)
+ * @param flag the text flags
+ * @param base_dir `LV_BASE_DIR_LTR` or `LV_BASE_DIR_RTL`
+ * @return true: `bidi_txt` and `bidi_pos` of the hint are valid for the text; false: out of memory
+ */
+bool lv_draw_label_hint_set_bidi(lv_draw_label_hint_t * hint, const char * txt, const lv_font_t * font,
+                                 lv_coord_t letter_space, lv_coord_t max_w, lv_text_flag_t flag, lv_base_dir_t base_dir);
+
+/**
+ * Free the text in visual order of a hint
+ * @param hint pointer to a hint
+ */
+void lv_draw_label_hint_clear_bidi(lv_draw_label_hint_t * hint);
+#endif
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
@@ -29,15 +29,31 @@
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_line(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                   lv_coord_t abs_y, lv_coord_t len,
                                                                   lv_draw_mask_line_param_t * param);
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_line_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                        lv_coord_t abs_y, lv_coord_t len,
+                                                                        lv_draw_mask_line_param_t * param,
+                                                                        lv_draw_mask_span_list_t * spans);
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                     lv_coord_t abs_y, lv_coord_t len,
                                                                     lv_draw_mask_radius_param_t * param);
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                          lv_coord_t abs_y, lv_coord_t len,
+                                                                          lv_draw_mask_radius_param_t * param,
+                                                                          lv_draw_mask_span_list_t * spans);
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                    lv_coord_t abs_y, lv_coord_t len,
                                                                    lv_draw_mask_angle_param_t * param);
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                         lv_coord_t abs_y, lv_coord_t len,
+                                                                         lv_draw_mask_angle_param_t * param,
+                                                                         lv_draw_mask_span_list_t * spans);
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_fade(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                   lv_coord_t abs_y, lv_coord_t len,
                                                                   lv_draw_mask_fade_param_t * param);
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_fade_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                        lv_coord_t abs_y, lv_coord_t len,
+                                                                        lv_draw_mask_fade_param_t * param,
+                                                                        lv_draw_mask_span_list_t * spans);
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_map(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                  lv_coord_t abs_y, lv_coord_t len,
                                                                  lv_draw_mask_map_param_t * param);
@@ -47,19 +63,31 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_polygon(lv_opa_t *
 
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_flat(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
                                                                lv_coord_t len,
-                                                               lv_draw_mask_line_param_t * p);
+                                                               lv_draw_mask_line_param_t * p,
+                                                               lv_draw_mask_span_list_t * spans);
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
                                                                 lv_coord_t len,
-                                                                lv_draw_mask_line_param_t * p);
+                                                                lv_draw_mask_line_param_t * p,
+                                                               lv_draw_mask_span_list_t * spans);
+LV_ATTRIBUTE_FAST_MEM static void line_mask_set_spans(lv_draw_mask_span_list_t * spans, lv_coord_t len, bool inv,
+                                                      int32_t transp_border, int32_t px_first, int32_t px_last);
 
 static void circ_init(lv_point_t * c, lv_coord_t * tmp, lv_coord_t radius);
 static bool circ_cont(lv_point_t * c);
 static void circ_next(lv_point_t * c, lv_coord_t * tmp);
-static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius);
-static lv_opa_t * get_next_line(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
-                                lv_coord_t * x_start);
+static const lv_opa_t * get_next_line(const _lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
+                                      lv_coord_t * x_start);
 LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
 
+LV_ATTRIBUTE_FAST_MEM static void span_push(lv_draw_mask_span_list_t * list, lv_draw_mask_span_type_t type,
+                                            lv_coord_t end);
+LV_ATTRIBUTE_FAST_MEM static void span_append_res(lv_draw_mask_span_list_t * list, lv_draw_mask_res_t res,
+                                                  const lv_draw_mask_span_list_t * sub, lv_coord_t ofs, lv_coord_t end);
+LV_ATTRIBUTE_FAST_MEM static void span_list_merge(lv_draw_mask_span_list_t * acc, const lv_draw_mask_span_list_t * add,
+                                                  lv_coord_t ofs);
+LV_ATTRIBUTE_FAST_MEM static bool span_list_get_visible_range(const lv_draw_mask_span_list_t * list, lv_coord_t * start,
+                                                              lv_coord_t * end);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -110,20 +138,63 @@ int16_t lv_draw_mask_add(void * param, void * custom_id)
  */
 LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
                                                             lv_coord_t len)
+{
+    lv_draw_mask_span_list_t spans;
+    return lv_draw_mask_apply_spans(mask_buf, abs_x, abs_y, len, &spans);
+}
+
+/**
+ * Apply the added buffers on a line and describe the result as spans.
+ * Used internally by the library's drawing routines.
+ * The regions which are already transparent are skipped when applying the next masks.
+ * @param mask_buf store the result mask here. Has to be `len` byte long. Should be initialized with `0xFF`.
+ * @param abs_x absolute X coordinate where the line to calculate start
+ * @param abs_y absolute Y coordinate where the line to calculate start
+ * @param len length of the line to calculate (in pixel count)
+ * @param spans store the transparent, covered and partial spans of the line here.
+ *              Valid only if `LV_DRAW_MASK_RES_CHANGED` is returned.
+ * @return same as `lv_draw_mask_apply`
+ */
+LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                  lv_coord_t abs_y, lv_coord_t len,
+                                                                  lv_draw_mask_span_list_t * spans)
 {
     bool changed = false;
     _lv_draw_mask_common_dsc_t * dsc;
+    lv_draw_mask_span_list_t mask_spans;
+
+    /*Only the not transparent part of the line is passed to the masks*/
+    lv_coord_t win_start = 0;
+    lv_coord_t win_end = len;
+
+    spans->cnt = 0;
+    span_push(spans, LV_DRAW_MASK_SPAN_COVER, len);
 
     _lv_draw_mask_saved_t * m = LV_GC_ROOT(_lv_draw_mask_list);
 
     while(m->param) {
         dsc = m->param;
+        lv_coord_t win_len = win_end - win_start;
         lv_draw_mask_res_t res = LV_DRAW_MASK_RES_FULL_COVER;
-        res = dsc->cb(mask_buf, abs_x, abs_y, len, (void *)m->param);
+        if(dsc->span_cb) {
+            res = dsc->span_cb(&mask_buf[win_start], abs_x + win_start, abs_y, win_len, (void *)m->param, &mask_spans);
+        }
+        else {
+            /*Without spans anything could have been changed in the line*/
+            res = dsc->cb(&mask_buf[win_start], abs_x + win_start, abs_y, win_len, (void *)m->param);
+            mask_spans.cnt = 0;
+            span_push(&mask_spans, LV_DRAW_MASK_SPAN_PARTIAL, win_len);
+        }
+        m++;
+
         if(res == LV_DRAW_MASK_RES_TRANSP) return LV_DRAW_MASK_RES_TRANSP;
-        else if(res == LV_DRAW_MASK_RES_CHANGED) changed = true;
+        else if(res != LV_DRAW_MASK_RES_CHANGED) continue;
 
-        m++;
+        changed = true;
+        span_list_merge(spans, &mask_spans, win_start);
+
+        /*The masks don't need to deal with the transparent parts on the two ends of the line*/
+        if(span_list_get_visible_range(spans, &win_start, &win_end) == false) return LV_DRAW_MASK_RES_TRANSP;
     }
 
     return changed ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
@@ -212,13 +283,16 @@ void lv_draw_mask_free_param(void * p)
     _lv_draw_mask_common_dsc_t * pdsc = p;
     if(pdsc->type == LV_DRAW_MASK_TYPE_RADIUS) {
         lv_draw_mask_radius_param_t * radius_p = (lv_draw_mask_radius_param_t *) p;
-        if(radius_p->circle) {
-            if(radius_p->circle->life < 0) {
-                lv_mem_free(radius_p->circle->cir_opa);
-                lv_mem_free(radius_p->circle);
+        /*The built-in tables are constant, nothing to do with them*/
+        if(radius_p->circle && radius_p->circle->buf) {
+            /*Only the allocated data can be here which is not constant*/
+            _lv_draw_mask_radius_circle_dsc_t * circle = (_lv_draw_mask_radius_circle_dsc_t *)radius_p->circle;
+            if(circle->life < 0) {
+                lv_mem_free(circle->buf);
+                lv_mem_free(circle);
             }
             else {
-                radius_p->circle->used_cnt--;
+                circle->used_cnt--;
             }
         }
     }
@@ -239,6 +313,168 @@ void _lv_draw_mask_cleanup(void)
     }
 }
 
+void _lv_draw_mask_deinit(void)
+{
+    _lv_draw_mask_cleanup();
+
+#if LV_CORNER_CACHE_SIZE > 0
+    /*The corners are kept across the refreshes in a buffer allocated once*/
+    lv_mem_free(LV_GC_ROOT(_lv_corner_cache));
+    LV_GC_ROOT(_lv_corner_cache) = NULL;
+#endif
+}
+
+void _lv_draw_mask_circle_calc(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius)
+{
+    if(radius == 0) return;
+    c->radius = radius;
+
+    /*Allocate buffers*/
+    if(c->buf) lv_mem_free(c->buf);
+
+    c->buf = lv_mem_alloc(radius * 6 + 6);  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
+    LV_ASSERT_MALLOC(c->buf);
+    lv_opa_t * cir_opa = c->buf;
+    uint16_t * opa_start_on_y = (uint16_t *)(c->buf + 2 * radius + 2);
+    uint16_t * x_start_on_y = (uint16_t *)(c->buf + 4 * radius + 4);
+    c->cir_opa = cir_opa;
+    c->opa_start_on_y = opa_start_on_y;
+    c->x_start_on_y = x_start_on_y;
+
+    /*Special case, handle manually*/
+    if(radius == 1) {
+        cir_opa[0] = 180;
+        opa_start_on_y[0] = 0;
+        opa_start_on_y[1] = 1;
+        x_start_on_y[0] = 0;
+        return;
+    }
+
+    lv_coord_t * cir_x = lv_mem_buf_get((radius + 1) * 2 * 2 * sizeof(lv_coord_t));
+    lv_coord_t * cir_y = &cir_x[(radius + 1) * 2];
+
+    uint32_t y_8th_cnt = 0;
+    lv_point_t cp;
+    lv_coord_t tmp;
+    circ_init(&cp, &tmp, radius * 4);    /*Upscale by 4*/
+    int32_t i;
+
+    uint32_t x_int[4];
+    uint32_t x_fract[4];
+    lv_coord_t cir_size = 0;
+    x_int[0] = cp.x >> 2;
+    x_fract[0] = 0;
+
+    /*Calculate an 1/8 circle*/
+    while(circ_cont(&cp)) {
+        /*Calculate 4 point of the circle */
+        for(i = 0; i < 4; i++) {
+            circ_next(&cp, &tmp);
+            if(circ_cont(&cp) == false) break;
+            x_int[i] = cp.x >> 2;
+            x_fract[i] = cp.x & 0x3;
+        }
+        if(i != 4) break;
+
+        /*All lines on the same x when downscaled*/
+        if(x_int[0] == x_int[3]) {
+            cir_x[cir_size] = x_int[0];
+            cir_y[cir_size] = y_8th_cnt;
+            cir_opa[cir_size] = x_fract[0] + x_fract[1] + x_fract[2] + x_fract[3];
+            cir_opa[cir_size] *= 16;
+            cir_size++;
+        }
+        /*Second line on new x when downscaled*/
+        else if(x_int[0] != x_int[1]) {
+            cir_x[cir_size] = x_int[0];
+            cir_y[cir_size] = y_8th_cnt;
+            cir_opa[cir_size] = x_fract[0];
+            cir_opa[cir_size] *= 16;
+            cir_size++;
+
+            cir_x[cir_size] = x_int[0] - 1;
+            cir_y[cir_size] = y_8th_cnt;
+            cir_opa[cir_size] = 1 * 4 + x_fract[1] + x_fract[2] + x_fract[3];;
+            cir_opa[cir_size] *= 16;
+            cir_size++;
+        }
+        /*Third line on new x when downscaled*/
+        else if(x_int[0] != x_int[2]) {
+            cir_x[cir_size] = x_int[0];
+            cir_y[cir_size] = y_8th_cnt;
+            cir_opa[cir_size] = x_fract[0] + x_fract[1];
+            cir_opa[cir_size] *= 16;
+            cir_size++;
+
+            cir_x[cir_size] = x_int[0] - 1;
+            cir_y[cir_size] = y_8th_cnt;
+            cir_opa[cir_size] = 2 * 4 + x_fract[2] + x_fract[3];;
+            cir_opa[cir_size] *= 16;
+            cir_size++;
+        }
+        /*Forth line on new x when downscaled*/
+        else {
+            cir_x[cir_size] = x_int[0];
+            cir_y[cir_size] = y_8th_cnt;
+            cir_opa[cir_size] = x_fract[0] + x_fract[1] + x_fract[2];
+            cir_opa[cir_size] *= 16;
+            cir_size++;
+
+            cir_x[cir_size] = x_int[0] - 1;
+            cir_y[cir_size] = y_8th_cnt;
+            cir_opa[cir_size] = 3 * 4 + x_fract[3];;
+            cir_opa[cir_size] *= 16;
+            cir_size++;
+        }
+
+        y_8th_cnt++;
+    }
+
+    /*The point on the 1/8 circle is special, calculate it manually*/
+    int32_t mid = radius * 723;
+    int32_t mid_int = mid >> 10;
+    if(cir_x[cir_size - 1] != mid_int || cir_y[cir_size - 1] != mid_int) {
+        int32_t tmp_val = mid - (mid_int << 10);
+        if(tmp_val <= 512) {
+            tmp_val = tmp_val * tmp_val * 2;
+            tmp_val = tmp_val >> (10 + 6);
+        }
+        else {
+            tmp_val = 1024 - tmp_val;
+            tmp_val = tmp_val * tmp_val * 2;
+            tmp_val = tmp_val >> (10 + 6);
+            tmp_val = 15 - tmp_val;
+        }
+
+        cir_x[cir_size] = mid_int;
+        cir_y[cir_size] = mid_int;
+        cir_opa[cir_size] = tmp_val;
+        cir_opa[cir_size] *= 16;
+        cir_size++;
+    }
+
+    /*Build the second octet by mirroring the first*/
+    for(i = cir_size - 2; i >= 0; i--, cir_size++) {
+        cir_x[cir_size] = cir_y[i];
+        cir_y[cir_size] = cir_x[i];
+        cir_opa[cir_size] = cir_opa[i];
+    }
+
+    lv_coord_t y = 0;
+    i = 0;
+    opa_start_on_y[0] = 0;
+    while(i < cir_size) {
+        opa_start_on_y[y] = i;
+        x_start_on_y[y] = cir_x[i];
+        for(; cir_y[i] == y && i < (int32_t)cir_size; i++) {
+            x_start_on_y[y] = LV_MIN(x_start_on_y[y], cir_x[i]);
+        }
+        y++;
+    }
+
+    lv_mem_buf_release(cir_x);
+}
+
 /**
  * Count the currently added masks
  * @return number of active masks
@@ -323,6 +559,7 @@ void lv_draw_mask_line_points_init(lv_draw_mask_line_param_t * param, lv_coord_t
     param->yx_steep = 0;
     param->xy_steep = 0;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_line;
+    param->dsc.span_cb = (lv_draw_mask_span_xcb_t)lv_draw_mask_line_spans;
     param->dsc.type = LV_DRAW_MASK_TYPE_LINE;
 
     int32_t dx = p2x - p1x;
@@ -439,6 +676,7 @@ void lv_draw_mask_angle_init(lv_draw_mask_angle_param_t * param, lv_coord_t vert
     param->cfg.vertex_p.x = vertex_x;
     param->cfg.vertex_p.y = vertex_y;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_angle;
+    param->dsc.span_cb = (lv_draw_mask_span_xcb_t)lv_draw_mask_angle_spans;
     param->dsc.type = LV_DRAW_MASK_TYPE_ANGLE;
 
     LV_ASSERT_MSG(start_angle >= 0 && start_angle <= 360, "Unexpected start angle");
@@ -483,6 +721,7 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
     param->cfg.radius = radius;
     param->cfg.outer = inv ? 1 : 0;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_radius;
+    param->dsc.span_cb = (lv_draw_mask_span_xcb_t)lv_draw_mask_radius_spans;
     param->dsc.type = LV_DRAW_MASK_TYPE_RADIUS;
 
     if(radius == 0) {
@@ -490,6 +729,12 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
         return;
     }
 
+#if LV_USE_CIRCLE_TABLES
+    /*Use the built-in data if there is a table for this radius*/
+    param->circle = _lv_draw_mask_circle_table_get(radius);
+    if(param->circle) return;
+#endif
+
     uint32_t i;
 
     /*Try to reuse a circle cache entry*/
@@ -523,9 +768,8 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
         CIRCLE_CACHE_AGING(entry->life, radius);
     }
 
+    _lv_draw_mask_circle_calc(entry, radius);
     param->circle = entry;
-
-    circ_calc_aa4(param->circle, radius);
 }
 
 /**
@@ -547,6 +791,7 @@ void lv_draw_mask_fade_init(lv_draw_mask_fade_param_t * param, const lv_area_t *
     param->cfg.y_top = y_top;
     param->cfg.y_bottom = y_bottom;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_fade;
+    param->dsc.span_cb = (lv_draw_mask_span_xcb_t)lv_draw_mask_fade_spans;
     param->dsc.type = LV_DRAW_MASK_TYPE_FADE;
 }
 
@@ -561,6 +806,7 @@ void lv_draw_mask_map_init(lv_draw_mask_map_param_t * param, const lv_area_t * c
     lv_area_copy(&param->cfg.coords, coords);
     param->cfg.map = map;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_map;
+    param->dsc.span_cb = NULL;
     param->dsc.type = LV_DRAW_MASK_TYPE_MAP;
 }
 
@@ -586,6 +832,7 @@ void lv_draw_mask_polygon_init(lv_draw_mask_polygon_param_t * param, const lv_po
     param->cfg.points = p;
     param->cfg.point_cnt = pcnt;
     param->dsc.cb = (lv_draw_mask_xcb_t)lv_draw_mask_polygon;
+    param->dsc.span_cb = NULL;
     param->dsc.type = LV_DRAW_MASK_TYPE_POLYGON;
 }
 
@@ -596,6 +843,14 @@ void lv_draw_mask_polygon_init(lv_draw_mask_polygon_param_t * param, const lv_po
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_line(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                   lv_coord_t abs_y, lv_coord_t len,
                                                                   lv_draw_mask_line_param_t * p)
+{
+    return lv_draw_mask_line_spans(mask_buf, abs_x, abs_y, len, p, NULL);
+}
+
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_line_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                        lv_coord_t abs_y, lv_coord_t len,
+                                                                        lv_draw_mask_line_param_t * p,
+                                                                        lv_draw_mask_span_list_t * spans)
 {
     /*Make to points relative to the vertex*/
     abs_y -= p->origo.y;
@@ -626,6 +881,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_line(lv_opa_t * mas
                     int32_t k = - abs_x;
                     if(k < 0) return LV_DRAW_MASK_RES_TRANSP;
                     if(k >= 0 && k < len) lv_memset_00(&mask_buf[k], len - k);
+                    line_mask_set_spans(spans, len, false, k, k, k - 1);
                     return  LV_DRAW_MASK_RES_CHANGED;
                 }
             }
@@ -636,6 +892,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_line(lv_opa_t * mas
                     if(k < 0) k = 0;
                     if(k >= len) return LV_DRAW_MASK_RES_TRANSP;
                     else if(k >= 0 && k < len) lv_memset_00(&mask_buf[0], k);
+                    line_mask_set_spans(spans, len, true, k, k, k - 1);
                     return  LV_DRAW_MASK_RES_CHANGED;
                 }
             }
@@ -644,10 +901,10 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_line(lv_opa_t * mas
 
     lv_draw_mask_res_t res;
     if(p->flat) {
-        res = line_mask_flat(mask_buf, abs_x, abs_y, len, p);
+        res = line_mask_flat(mask_buf, abs_x, abs_y, len, p, spans);
     }
     else {
-        res = line_mask_steep(mask_buf, abs_x, abs_y, len, p);
+        res = line_mask_steep(mask_buf, abs_x, abs_y, len, p, spans);
     }
 
     return res;
@@ -655,7 +912,8 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_line(lv_opa_t * mas
 
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_flat(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
                                                                lv_coord_t len,
-                                                               lv_draw_mask_line_param_t * p)
+                                                               lv_draw_mask_line_param_t * p,
+                                                               lv_draw_mask_span_list_t * spans)
 {
 
     int32_t y_at_x;
@@ -747,6 +1005,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_flat(lv_opa_t * mask_b
         mask_buf[k] = mask_mix(mask_buf[k], m);
     }
 
+    int32_t px_last = k;
     if(p->inv) {
         k = xei - abs_x;
         if(k > len) {
@@ -766,12 +1025,14 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_flat(lv_opa_t * mask_b
         }
     }
 
+    line_mask_set_spans(spans, len, p->inv, k, xei - abs_x, px_last);
     return LV_DRAW_MASK_RES_CHANGED;
 }
 
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
                                                                 lv_coord_t len,
-                                                                lv_draw_mask_line_param_t * p)
+                                                                lv_draw_mask_line_param_t * p,
+                                                               lv_draw_mask_span_list_t * spans)
 {
     int32_t k;
     int32_t x_at_y;
@@ -820,6 +1081,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_
     }
 
     if(xsi == xei) {
+        int32_t px = k;
         if(k >= 0 && k < len) {
             m = (xsf + xef) >> 1;
             if(p->inv) m = 255 - m;
@@ -839,8 +1101,9 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_
             if(k > len) k = len;
             if(k == 0) return LV_DRAW_MASK_RES_TRANSP;
             else if(k > 0) lv_memset_00(&mask_buf[k],  len - k);
+            else k = len;   /*Nothing was cleared*/
         }
-
+        line_mask_set_spans(spans, len, p->inv, k, px, px);
     }
     else {
         int32_t y_inters;
@@ -862,18 +1125,21 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_
             }
 
             k += 2;
+            int32_t px_last = k - 1;
 
             if(p->inv) {
                 k = xsi - abs_x - 1;
 
-                if(k > len) k = len;
+                if(k > len) k = 0;  /*Nothing is cleared*/
                 else if(k > 0) lv_memset_00(&mask_buf[0],  k);
 
             }
             else {
                 if(k > len) return LV_DRAW_MASK_RES_FULL_COVER;
                 if(k >= 0) lv_memset_00(&mask_buf[k],  len - k);
+                else k = len;   /*Nothing is cleared*/
             }
+            line_mask_set_spans(spans, len, p->inv, k, px_last - 1, px_last);
 
         }
         else {
@@ -893,6 +1159,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_
                 mask_buf[k] = mask_mix(mask_buf[k], m);
             }
             k++;
+            int32_t px_last = k - 1;
 
             if(p->inv) {
                 k = xsi - abs_x;
@@ -904,17 +1171,64 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_
                 if(k > len) k = len;
                 if(k == 0) return LV_DRAW_MASK_RES_TRANSP;
                 else if(k > 0) lv_memset_00(&mask_buf[k],  len - k);
+                else k = len;   /*Nothing is cleared*/
             }
+            line_mask_set_spans(spans, len, p->inv, k, px_last - 1, px_last);
         }
     }
 
     return LV_DRAW_MASK_RES_CHANGED;
 }
 
+/**
+ * Describe the result of a line mask with spans.
+ * @param spans         store the spans here. If `NULL` nothing happens.
+ * @param len           length of the line
+ * @param inv           true: the pixels before `transp_border` were cleared;
+ *                      false: the pixels from `transp_border` were cleared
+ * @param transp_border border of the cleared part
+ * @param px_first      index of the first pixel set individually
+ * @param px_last       index of the last pixel set individually
+ */
+LV_ATTRIBUTE_FAST_MEM static void line_mask_set_spans(lv_draw_mask_span_list_t * spans, lv_coord_t len, bool inv,
+                                                      int32_t transp_border, int32_t px_first, int32_t px_last)
+{
+    if(spans == NULL) return;
+
+    transp_border = LV_CLAMP(0, transp_border, len);
+    px_first = LV_CLAMP(0, px_first, len);
+    int32_t px_end = LV_CLAMP(0, px_last + 1, len);
+
+    spans->cnt = 0;
+    if(inv) {
+        span_push(spans, LV_DRAW_MASK_SPAN_TRANSP, transp_border);
+        span_push(spans, LV_DRAW_MASK_SPAN_PARTIAL, LV_MAX(px_end, transp_border));
+        span_push(spans, LV_DRAW_MASK_SPAN_COVER, len);
+    }
+    else {
+        span_push(spans, LV_DRAW_MASK_SPAN_COVER, LV_MIN(px_first, transp_border));
+        span_push(spans, LV_DRAW_MASK_SPAN_PARTIAL, transp_border);
+        span_push(spans, LV_DRAW_MASK_SPAN_TRANSP, len);
+    }
+}
+
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                    lv_coord_t abs_y, lv_coord_t len,
                                                                    lv_draw_mask_angle_param_t * p)
 {
+    return lv_draw_mask_angle_spans(mask_buf, abs_x, abs_y, len, p, NULL);
+}
+
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                         lv_coord_t abs_y, lv_coord_t len,
+                                                                         lv_draw_mask_angle_param_t * p,
+                                                                         lv_draw_mask_span_list_t * spans)
+{
+    lv_draw_mask_span_list_t spans1;
+    lv_draw_mask_span_list_t spans2;
+    lv_draw_mask_span_list_t * spans1_p = spans ? &spans1 : NULL;
+    lv_draw_mask_span_list_t * spans2_p = spans ? &spans2 : NULL;
+
     int32_t rel_y = abs_y - p->cfg.vertex_p.y;
     int32_t rel_x = abs_x - p->cfg.vertex_p.x;
 
@@ -947,7 +1261,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * ma
         int32_t tmp = start_angle_last + dist - rel_x;
         if(tmp > len) tmp = len;
         if(tmp > 0) {
-            res1 = lv_draw_mask_line(&mask_buf[0], abs_x, abs_y, tmp, &p->start_line);
+            res1 = lv_draw_mask_line_spans(&mask_buf[0], abs_x, abs_y, tmp, &p->start_line, spans1_p);
             if(res1 == LV_DRAW_MASK_RES_TRANSP) {
                 lv_memset_00(&mask_buf[0], tmp);
             }
@@ -955,10 +1269,15 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * ma
 
         if(tmp > len) tmp = len;
         if(tmp < 0) tmp = 0;
-        res2 = lv_draw_mask_line(&mask_buf[tmp], abs_x + tmp, abs_y, len - tmp, &p->end_line);
+        res2 = lv_draw_mask_line_spans(&mask_buf[tmp], abs_x + tmp, abs_y, len - tmp, &p->end_line, spans2_p);
         if(res2 == LV_DRAW_MASK_RES_TRANSP) {
             lv_memset_00(&mask_buf[tmp], len - tmp);
         }
+        if(spans) {
+            spans->cnt = 0;
+            span_append_res(spans, res1, &spans1, 0, tmp);
+            span_append_res(spans, res2, &spans2, tmp, len);
+        }
         if(res1 == res2) return res1;
         else return LV_DRAW_MASK_RES_CHANGED;
     }
@@ -989,7 +1308,8 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * ma
         int32_t tmp = start_angle_last + dist - rel_x;
         if(tmp > len) tmp = len;
         if(tmp > 0) {
-            res1 = lv_draw_mask_line(&mask_buf[0], abs_x, abs_y, tmp, (lv_draw_mask_line_param_t *)&p->end_line);
+            res1 = lv_draw_mask_line_spans(&mask_buf[0], abs_x, abs_y, tmp, (lv_draw_mask_line_param_t *)&p->end_line,
+                                           spans1_p);
             if(res1 == LV_DRAW_MASK_RES_TRANSP) {
                 lv_memset_00(&mask_buf[0], tmp);
             }
@@ -997,10 +1317,16 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * ma
 
         if(tmp > len) tmp = len;
         if(tmp < 0) tmp = 0;
-        res2 = lv_draw_mask_line(&mask_buf[tmp], abs_x + tmp, abs_y, len - tmp, (lv_draw_mask_line_param_t *)&p->start_line);
+        res2 = lv_draw_mask_line_spans(&mask_buf[tmp], abs_x + tmp, abs_y, len - tmp,
+                                       (lv_draw_mask_line_param_t *)&p->start_line, spans2_p);
         if(res2 == LV_DRAW_MASK_RES_TRANSP) {
             lv_memset_00(&mask_buf[tmp], len - tmp);
         }
+        if(spans) {
+            spans->cnt = 0;
+            span_append_res(spans, res1, &spans1, 0, tmp);
+            span_append_res(spans, res2, &spans2, tmp, len);
+        }
         if(res1 == res2) return res1;
         else return LV_DRAW_MASK_RES_CHANGED;
     }
@@ -1022,7 +1348,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * ma
             res1 = LV_DRAW_MASK_RES_UNKNOWN;
         }
         else  {
-            res1 = lv_draw_mask_line(mask_buf, abs_x, abs_y, len, &p->start_line);
+            res1 = lv_draw_mask_line_spans(mask_buf, abs_x, abs_y, len, &p->start_line, spans1_p);
         }
 
         if(p->cfg.end_angle == 180) {
@@ -1038,11 +1364,21 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * ma
             res2 = LV_DRAW_MASK_RES_UNKNOWN;
         }
         else {
-            res2 = lv_draw_mask_line(mask_buf, abs_x, abs_y, len, &p->end_line);
+            res2 = lv_draw_mask_line_spans(mask_buf, abs_x, abs_y, len, &p->end_line, spans2_p);
         }
 
         if(res1 == LV_DRAW_MASK_RES_TRANSP || res2 == LV_DRAW_MASK_RES_TRANSP) return LV_DRAW_MASK_RES_TRANSP;
-        else if(res1 == LV_DRAW_MASK_RES_UNKNOWN && res2 == LV_DRAW_MASK_RES_UNKNOWN) return LV_DRAW_MASK_RES_TRANSP;
+        if(spans) {
+            /*Both lines were applied on the whole line*/
+            spans->cnt = 0;
+            span_append_res(spans, res1, &spans1, 0, len);
+            lv_draw_mask_span_list_t tmp_spans;
+            tmp_spans.cnt = 0;
+            span_append_res(&tmp_spans, res2, &spans2, 0, len);
+            span_list_merge(spans, &tmp_spans, 0);
+        }
+
+        if(res1 == LV_DRAW_MASK_RES_UNKNOWN && res2 == LV_DRAW_MASK_RES_UNKNOWN) return LV_DRAW_MASK_RES_TRANSP;
         else if(res1 == LV_DRAW_MASK_RES_FULL_COVER &&  res2 == LV_DRAW_MASK_RES_FULL_COVER) return LV_DRAW_MASK_RES_FULL_COVER;
         else return LV_DRAW_MASK_RES_CHANGED;
     }
@@ -1053,6 +1389,14 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_angle(lv_opa_t * ma
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                     lv_coord_t abs_y, lv_coord_t len,
                                                                     lv_draw_mask_radius_param_t * p)
+{
+    return lv_draw_mask_radius_spans(mask_buf, abs_x, abs_y, len, p, NULL);
+}
+
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                          lv_coord_t abs_y, lv_coord_t len,
+                                                                          lv_draw_mask_radius_param_t * p,
+                                                                          lv_draw_mask_span_list_t * spans)
 {
     bool outer = p->cfg.outer;
     int32_t radius = p->cfg.radius;
@@ -1086,18 +1430,33 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * m
                 lv_memset_00(&mask_buf[first], len - first);
             }
             if(last == 0 && first == len) return LV_DRAW_MASK_RES_FULL_COVER;
-            else return LV_DRAW_MASK_RES_CHANGED;
+
+            if(spans) {
+                spans->cnt = 0;
+                span_push(spans, LV_DRAW_MASK_SPAN_TRANSP, LV_CLAMP(0, last, len));
+                span_push(spans, LV_DRAW_MASK_SPAN_COVER, LV_CLAMP(0, first, len));
+                span_push(spans, LV_DRAW_MASK_SPAN_TRANSP, len);
+            }
+            return LV_DRAW_MASK_RES_CHANGED;
         }
         else {
             int32_t first = rect.x1 - abs_x;
+            int32_t last = 0;
             if(first < 0) first = 0;
             if(first <= len) {
-                int32_t last = rect.x2 - abs_x - first + 1;
+                last = rect.x2 - abs_x - first + 1;
                 if(first + last > len) last = len - first;
                 if(last >= 0) {
                     lv_memset_00(&mask_buf[first], last);
                 }
             }
+
+            if(spans) {
+                spans->cnt = 0;
+                span_push(spans, LV_DRAW_MASK_SPAN_COVER, LV_MIN(first, len));
+                span_push(spans, LV_DRAW_MASK_SPAN_TRANSP, LV_MIN(first + LV_MAX(last, 0), len));
+                span_push(spans, LV_DRAW_MASK_SPAN_COVER, len);
+            }
         }
         return LV_DRAW_MASK_RES_CHANGED;
     }
@@ -1124,7 +1483,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * m
     else {
         cir_y = abs_y - (h - radius);
     }
-    lv_opa_t * aa_opa = get_next_line(p->circle, cir_y, &aa_len, &x_start);
+    const lv_opa_t * aa_opa = get_next_line(p->circle, cir_y, &aa_len, &x_start);
     lv_coord_t cir_x_right = k + w - radius + x_start;
     lv_coord_t cir_x_left = k + radius - x_start - 1;
     lv_coord_t i;
@@ -1140,6 +1499,15 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * m
             }
         }
 
+        if(spans) {
+            spans->cnt = 0;
+            span_push(spans, LV_DRAW_MASK_SPAN_TRANSP, LV_CLAMP(0, cir_x_left - aa_len + 1, len));
+            span_push(spans, LV_DRAW_MASK_SPAN_PARTIAL, LV_CLAMP(0, cir_x_left + 1, len));
+            span_push(spans, LV_DRAW_MASK_SPAN_COVER, LV_CLAMP(0, cir_x_right, len));
+            span_push(spans, LV_DRAW_MASK_SPAN_PARTIAL, LV_CLAMP(0, cir_x_right + aa_len, len));
+            span_push(spans, LV_DRAW_MASK_SPAN_TRANSP, len);
+        }
+
         /*Clean the right side*/
         cir_x_right = LV_CLAMP(0, cir_x_right + i, len);
         lv_memset_00(&mask_buf[cir_x_right], len - cir_x_right);
@@ -1162,6 +1530,15 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * m
         lv_coord_t clr_start = LV_CLAMP(0, cir_x_left + 1, len);
         lv_coord_t clr_len = LV_CLAMP(0, cir_x_right - clr_start, len - clr_start);
         lv_memset_00(&mask_buf[clr_start], clr_len);
+
+        if(spans) {
+            spans->cnt = 0;
+            span_push(spans, LV_DRAW_MASK_SPAN_COVER, LV_CLAMP(0, cir_x_left - aa_len + 1, len));
+            span_push(spans, LV_DRAW_MASK_SPAN_PARTIAL, clr_start);
+            span_push(spans, LV_DRAW_MASK_SPAN_TRANSP, clr_start + clr_len);
+            span_push(spans, LV_DRAW_MASK_SPAN_PARTIAL, LV_CLAMP(0, cir_x_right + aa_len, len));
+            span_push(spans, LV_DRAW_MASK_SPAN_COVER, len);
+        }
     }
 
     return LV_DRAW_MASK_RES_CHANGED;
@@ -1170,47 +1547,62 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * m
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_fade(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                   lv_coord_t abs_y, lv_coord_t len,
                                                                   lv_draw_mask_fade_param_t * p)
+{
+    return lv_draw_mask_fade_spans(mask_buf, abs_x, abs_y, len, p, NULL);
+}
+
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_fade_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                        lv_coord_t abs_y, lv_coord_t len,
+                                                                        lv_draw_mask_fade_param_t * p,
+                                                                        lv_draw_mask_span_list_t * spans)
 {
     if(abs_y < p->cfg.coords.y1) return LV_DRAW_MASK_RES_FULL_COVER;
     if(abs_y > p->cfg.coords.y2) return LV_DRAW_MASK_RES_FULL_COVER;
     if(abs_x + len < p->cfg.coords.x1) return LV_DRAW_MASK_RES_FULL_COVER;
     if(abs_x > p->cfg.coords.x2) return LV_DRAW_MASK_RES_FULL_COVER;
 
+    lv_coord_t full_len = len;
+    int32_t x_ofs = 0;
     if(abs_x + len > p->cfg.coords.x2) len -= abs_x + len - p->cfg.coords.x2 - 1;
 
     if(abs_x < p->cfg.coords.x1) {
-        int32_t x_ofs = 0;
         x_ofs = p->cfg.coords.x1 - abs_x;
         len -= x_ofs;
         mask_buf += x_ofs;
     }
 
     int32_t i;
-
+    lv_opa_t opa_act;
     if(abs_y <= p->cfg.y_top) {
-        for(i = 0; i < len; i++) {
-            mask_buf[i] = mask_mix(mask_buf[i], p->cfg.opa_top);
-        }
-        return LV_DRAW_MASK_RES_CHANGED;
+        opa_act = p->cfg.opa_top;
     }
     else if(abs_y >= p->cfg.y_bottom) {
-        for(i = 0; i < len; i++) {
-            mask_buf[i] = mask_mix(mask_buf[i], p->cfg.opa_bottom);
-        }
-        return LV_DRAW_MASK_RES_CHANGED;
+        opa_act = p->cfg.opa_bottom;
     }
     else {
         /*Calculate the opa proportionally*/
         int16_t opa_diff = p->cfg.opa_bottom - p->cfg.opa_top;
         int32_t y_diff = p->cfg.y_bottom - p->cfg.y_top + 1;
-        lv_opa_t opa_act = (int32_t)((int32_t)(abs_y - p->cfg.y_top) * opa_diff) / y_diff;
+        opa_act = (int32_t)((int32_t)(abs_y - p->cfg.y_top) * opa_diff) / y_diff;
         opa_act += p->cfg.opa_top;
+    }
 
-        for(i = 0; i < len; i++) {
-            mask_buf[i] = mask_mix(mask_buf[i], opa_act);
-        }
-        return LV_DRAW_MASK_RES_CHANGED;
+    for(i = 0; i < len; i++) {
+        mask_buf[i] = mask_mix(mask_buf[i], opa_act);
     }
+
+    if(spans) {
+        lv_draw_mask_span_type_t type = LV_DRAW_MASK_SPAN_PARTIAL;
+        if(opa_act >= LV_OPA_MAX) type = LV_DRAW_MASK_SPAN_COVER;
+        else if(opa_act <= LV_OPA_MIN) type = LV_DRAW_MASK_SPAN_TRANSP;
+
+        spans->cnt = 0;
+        span_push(spans, LV_DRAW_MASK_SPAN_COVER, x_ofs);
+        span_push(spans, type, x_ofs + LV_MAX(len, 0));
+        span_push(spans, LV_DRAW_MASK_SPAN_COVER, full_len);
+    }
+
+    return LV_DRAW_MASK_RES_CHANGED;
 }
 
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_map(lv_opa_t * mask_buf, lv_coord_t abs_x,
@@ -1361,169 +1753,143 @@ static void circ_next(lv_point_t * c, lv_coord_t * tmp)
     c->y++;
 }
 
-static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius)
+static const lv_opa_t * get_next_line(const _lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
+                                      lv_coord_t * x_start)
 {
-    if(radius == 0) return;
-    c->radius = radius;
-
-    /*Allocate buffers*/
-    if(c->buf) lv_mem_free(c->buf);
-
-    c->buf = lv_mem_alloc(radius * 6 + 6);  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
-    LV_ASSERT_MALLOC(c->buf);
-    c->cir_opa = c->buf;
-    c->opa_start_on_y = (uint16_t *)(c->buf + 2 * radius + 2);
-    c->x_start_on_y = (uint16_t *)(c->buf + 4 * radius + 4);
-
-    /*Special case, handle manually*/
-    if(radius == 1) {
-        c->cir_opa[0] = 180;
-        c->opa_start_on_y[0] = 0;
-        c->opa_start_on_y[1] = 1;
-        c->x_start_on_y[0] = 0;
-        return;
-    }
+    *len = c->opa_start_on_y[y + 1] - c->opa_start_on_y[y];
+    *x_start = c->x_start_on_y[y];
+    return &c->cir_opa[c->opa_start_on_y[y]];
+}
 
-    lv_coord_t * cir_x = lv_mem_buf_get((radius + 1) * 2 * 2 * sizeof(lv_coord_t));
-    lv_coord_t * cir_y = &cir_x[(radius + 1) * 2];
 
-    uint32_t y_8th_cnt = 0;
-    lv_point_t cp;
-    lv_coord_t tmp;
-    circ_init(&cp, &tmp, radius * 4);    /*Upscale by 4*/
-    int32_t i;
+LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_t mask_new)
+{
+    if(mask_new >= LV_OPA_MAX) return mask_act;
+    if(mask_new <= LV_OPA_MIN) return 0;
 
-    uint32_t x_int[4];
-    uint32_t x_fract[4];
-    lv_coord_t cir_size = 0;
-    x_int[0] = cp.x >> 2;
-    x_fract[0] = 0;
+    return LV_UDIV255(mask_act * mask_new);// >> 8);
+}
 
-    /*Calculate an 1/8 circle*/
-    while(circ_cont(&cp)) {
-        /*Calculate 4 point of the circle */
-        for(i = 0; i < 4; i++) {
-            circ_next(&cp, &tmp);
-            if(circ_cont(&cp) == false) break;
-            x_int[i] = cp.x >> 2;
-            x_fract[i] = cp.x & 0x3;
-        }
-        if(i != 4) break;
+/**
+ * Add a span to the end of a span list.
+ * @param list  pointer to a span list
+ * @param type  type of the new span
+ * @param end   the new span lasts until this index (exclusive). Ignored if not after the end of the last span.
+ */
+LV_ATTRIBUTE_FAST_MEM static void span_push(lv_draw_mask_span_list_t * list, lv_draw_mask_span_type_t type,
+                                            lv_coord_t end)
+{
+    lv_draw_mask_span_t * last = NULL;
+    lv_coord_t start = 0;
+    if(list->cnt) {
+        last = &list->spans[list->cnt - 1];
+        start = last->start + last->len;
+    }
 
-        /*All lines on the same x when downscaled*/
-        if(x_int[0] == x_int[3]) {
-            cir_x[cir_size] = x_int[0];
-            cir_y[cir_size] = y_8th_cnt;
-            c->cir_opa[cir_size] = x_fract[0] + x_fract[1] + x_fract[2] + x_fract[3];
-            c->cir_opa[cir_size] *= 16;
-            cir_size++;
-        }
-        /*Second line on new x when downscaled*/
-        else if(x_int[0] != x_int[1]) {
-            cir_x[cir_size] = x_int[0];
-            cir_y[cir_size] = y_8th_cnt;
-            c->cir_opa[cir_size] = x_fract[0];
-            c->cir_opa[cir_size] *= 16;
-            cir_size++;
+    if(end <= start) return;
 
-            cir_x[cir_size] = x_int[0] - 1;
-            cir_y[cir_size] = y_8th_cnt;
-            c->cir_opa[cir_size] = 1 * 4 + x_fract[1] + x_fract[2] + x_fract[3];;
-            c->cir_opa[cir_size] *= 16;
-            cir_size++;
-        }
-        /*Third line on new x when downscaled*/
-        else if(x_int[0] != x_int[2]) {
-            cir_x[cir_size] = x_int[0];
-            cir_y[cir_size] = y_8th_cnt;
-            c->cir_opa[cir_size] = x_fract[0] + x_fract[1];
-            c->cir_opa[cir_size] *= 16;
-            cir_size++;
+    /*Join to the previous span. If there is no more free place the pixels need to be read from the mask buffer.*/
+    if(last && (last->type == type || list->cnt >= _LV_MASK_SPAN_MAX_NUM)) {
+        if(last->type != type) last->type = LV_DRAW_MASK_SPAN_PARTIAL;
+        last->len = end - last->start;
+        return;
+    }
 
-            cir_x[cir_size] = x_int[0] - 1;
-            cir_y[cir_size] = y_8th_cnt;
-            c->cir_opa[cir_size] = 2 * 4 + x_fract[2] + x_fract[3];;
-            c->cir_opa[cir_size] *= 16;
-            cir_size++;
-        }
-        /*Forth line on new x when downscaled*/
-        else {
-            cir_x[cir_size] = x_int[0];
-            cir_y[cir_size] = y_8th_cnt;
-            c->cir_opa[cir_size] = x_fract[0] + x_fract[1] + x_fract[2];
-            c->cir_opa[cir_size] *= 16;
-            cir_size++;
+    list->spans[list->cnt].start = start;
+    list->spans[list->cnt].len = end - start;
+    list->spans[list->cnt].type = type;
+    list->cnt++;
+}
 
-            cir_x[cir_size] = x_int[0] - 1;
-            cir_y[cir_size] = y_8th_cnt;
-            c->cir_opa[cir_size] = 3 * 4 + x_fract[3];;
-            c->cir_opa[cir_size] *= 16;
-            cir_size++;
+/**
+ * Add the spans of a masks result to a span list.
+ * @param list  pointer to a span list
+ * @param res   result of the mask
+ * @param sub   spans of the mask. Used only if `res` is `LV_DRAW_MASK_RES_CHANGED`
+ * @param ofs   `sub` starts at this index in `list`
+ * @param end   the end of the mask's line in `list`
+ */
+LV_ATTRIBUTE_FAST_MEM static void span_append_res(lv_draw_mask_span_list_t * list, lv_draw_mask_res_t res,
+                                                  const lv_draw_mask_span_list_t * sub, lv_coord_t ofs, lv_coord_t end)
+{
+    if(res == LV_DRAW_MASK_RES_CHANGED) {
+        uint32_t i;
+        for(i = 0; i < sub->cnt; i++) {
+            span_push(list, sub->spans[i].type, ofs + sub->spans[i].start + sub->spans[i].len);
         }
-
-        y_8th_cnt++;
     }
 
-    /*The point on the 1/8 circle is special, calculate it manually*/
-    int32_t mid = radius * 723;
-    int32_t mid_int = mid >> 10;
-    if(cir_x[cir_size - 1] != mid_int || cir_y[cir_size - 1] != mid_int) {
-        int32_t tmp_val = mid - (mid_int << 10);
-        if(tmp_val <= 512) {
-            tmp_val = tmp_val * tmp_val * 2;
-            tmp_val = tmp_val >> (10 + 6);
-        }
-        else {
-            tmp_val = 1024 - tmp_val;
-            tmp_val = tmp_val * tmp_val * 2;
-            tmp_val = tmp_val >> (10 + 6);
-            tmp_val = 15 - tmp_val;
-        }
+    /*Untouched (or not covered by `sub`) pixels are kept as they are*/
+    span_push(list, res == LV_DRAW_MASK_RES_TRANSP ? LV_DRAW_MASK_SPAN_TRANSP : LV_DRAW_MASK_SPAN_COVER, end);
+}
 
-        cir_x[cir_size] = mid_int;
-        cir_y[cir_size] = mid_int;
-        c->cir_opa[cir_size] = tmp_val;
-        c->cir_opa[cir_size] *= 16;
-        cir_size++;
-    }
+/**
+ * Intersect the spans of a new mask with the spans of the previously applied masks.
+ * @param acc   spans of the previous masks. The result is stored here too.
+ * @param add   spans of the new mask. It needs to cover all the not transparent spans of `acc`
+ * @param ofs   `add` starts at this index in `acc`
+ */
+LV_ATTRIBUTE_FAST_MEM static void span_list_merge(lv_draw_mask_span_list_t * acc, const lv_draw_mask_span_list_t * add,
+                                                  lv_coord_t ofs)
+{
+    lv_draw_mask_span_list_t res;
+    res.cnt = 0;
 
-    /*Build the second octet by mirroring the first*/
-    for(i = cir_size - 2; i >= 0; i--, cir_size++) {
-        cir_x[cir_size] = cir_y[i];
-        cir_y[cir_size] = cir_x[i];
-        c->cir_opa[cir_size] = c->cir_opa[i];
-    }
+    uint32_t i;
+    uint32_t j = 0;
+    for(i = 0; i < acc->cnt; i++) {
+        const lv_draw_mask_span_t * a = &acc->spans[i];
+        lv_coord_t a_end = a->start + a->len;
+        if(a->type == LV_DRAW_MASK_SPAN_TRANSP) {
+            span_push(&res, LV_DRAW_MASK_SPAN_TRANSP, a_end);
+            continue;
+        }
+
+        lv_coord_t x = a->start;
+        while(x < a_end) {
+            while(j < add->cnt && ofs + add->spans[j].start + add->spans[j].len <= x) j++;
+
+            /*Shouldn't happen, but the buffer has the correct values anyway*/
+            if(j >= add->cnt) {
+                span_push(&res, LV_DRAW_MASK_SPAN_PARTIAL, a_end);
+                break;
+            }
 
-    lv_coord_t y = 0;
-    i = 0;
-    c->opa_start_on_y[0] = 0;
-    while(i < cir_size) {
-        c->opa_start_on_y[y] = i;
-        c->x_start_on_y[y] = cir_x[i];
-        for(; cir_y[i] == y && i < (int32_t)cir_size; i++) {
-            c->x_start_on_y[y] = LV_MIN(c->x_start_on_y[y], cir_x[i]);
+            const lv_draw_mask_span_t * b = &add->spans[j];
+            lv_coord_t end = LV_MIN(a_end, ofs + b->start + b->len);
+            lv_draw_mask_span_type_t type;
+            if(b->type == LV_DRAW_MASK_SPAN_TRANSP) type = LV_DRAW_MASK_SPAN_TRANSP;
+            else if(a->type == LV_DRAW_MASK_SPAN_PARTIAL ||
+                    b->type == LV_DRAW_MASK_SPAN_PARTIAL) type = LV_DRAW_MASK_SPAN_PARTIAL;
+            else type = LV_DRAW_MASK_SPAN_COVER;
+            span_push(&res, type, end);
+            x = end;
         }
-        y++;
     }
 
-    lv_mem_buf_release(cir_x);
+    acc->cnt = res.cnt;
+    lv_memcpy_small(acc->spans, res.spans, res.cnt * sizeof(lv_draw_mask_span_t));
 }
 
-static lv_opa_t * get_next_line(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
-                                lv_coord_t * x_start)
-{
-    *len = c->opa_start_on_y[y + 1] - c->opa_start_on_y[y];
-    *x_start = c->x_start_on_y[y];
-    return &c->cir_opa[c->opa_start_on_y[y]];
-}
-
-
-LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_t mask_new)
+/**
+ * Get the range between the first and last not transparent spans.
+ * @param list      pointer to a span list
+ * @param start     store the first not transparent index here
+ * @param end       store the end of the last not transparent span here (exclusive)
+ * @return          false: all the spans are transparent
+ */
+LV_ATTRIBUTE_FAST_MEM static bool span_list_get_visible_range(const lv_draw_mask_span_list_t * list, lv_coord_t * start,
+                                                              lv_coord_t * end)
 {
-    if(mask_new >= LV_OPA_MAX) return mask_act;
-    if(mask_new <= LV_OPA_MIN) return 0;
-
-    return LV_UDIV255(mask_act * mask_new);// >> 8);
+    int32_t first = 0;
+    int32_t last = list->cnt - 1;
+    while(first <= last && list->spans[first].type == LV_DRAW_MASK_SPAN_TRANSP) first++;
+    while(last >= first && list->spans[last].type == LV_DRAW_MASK_SPAN_TRANSP) last--;
+    if(first > last) return false;
+
+    *start = list->spans[first].start;
+    *end = list->spans[last].start + list->spans[last].len;
+    return true;
 }
 
 
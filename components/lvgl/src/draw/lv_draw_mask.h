@@ -29,6 +29,9 @@ extern "C" {
 # define _LV_MASK_MAX_NUM     1
 #endif
 
+/*Max number of spans in a span list. If more spans were required the last ones are merged.*/
+#define _LV_MASK_SPAN_MAX_NUM   16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -42,6 +45,31 @@ enum {
 
 typedef uint8_t lv_draw_mask_res_t;
 
+/**
+ * Describes how a run of pixels of a mask line looks like after applying the masks
+ */
+enum {
+    LV_DRAW_MASK_SPAN_TRANSP,       /*All pixels are transparent. `mask_buf` is zero here*/
+    LV_DRAW_MASK_SPAN_COVER,        /*The masks haven't touched these pixels. `mask_buf` has its initial value*/
+    LV_DRAW_MASK_SPAN_PARTIAL,      /*`mask_buf` stores the opacity of each pixel*/
+};
+
+typedef uint8_t lv_draw_mask_span_type_t;
+
+typedef struct {
+    lv_coord_t start;               /*First pixel of the span relative to the start of the mask line*/
+    lv_coord_t len;                 /*Number of pixels in the span*/
+    lv_draw_mask_span_type_t type;
+} lv_draw_mask_span_t;
+
+/**
+ * Run-length description of a mask line. The spans are continuous and cover the whole line.
+ */
+typedef struct {
+    lv_draw_mask_span_t spans[_LV_MASK_SPAN_MAX_NUM];
+    uint8_t cnt;
+} lv_draw_mask_span_list_t;
+
 typedef struct {
     void * param;
     void * custom_id;
@@ -93,10 +121,20 @@ typedef lv_draw_mask_res_t (*lv_draw_mask_xcb_t)(lv_opa_t * mask_buf, lv_coord_t
                                                  lv_coord_t len,
                                                  void * p);
 
+/**
+ * Same as `lv_draw_mask_xcb_t` but also describes the result as transparent, covered and partial spans.
+ * `spans` is relative to `abs_x` and valid only if `LV_DRAW_MASK_RES_CHANGED` is returned.
+ * Used internally by the library.
+ */
+typedef lv_draw_mask_res_t (*lv_draw_mask_span_xcb_t)(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
+                                                      lv_coord_t len,
+                                                      void * p, lv_draw_mask_span_list_t * spans);
+
 typedef uint8_t lv_draw_mask_line_side_t;
 
 typedef struct {
     lv_draw_mask_xcb_t cb;
+    lv_draw_mask_span_xcb_t span_cb;    /*Optional, NULL if the mask can't describe its result with spans*/
     lv_draw_mask_type_t type;
 } _lv_draw_mask_common_dsc_t;
 
@@ -154,10 +192,10 @@ typedef struct {
 } lv_draw_mask_angle_param_t;
 
 typedef struct  {
-    uint8_t * buf;
-    lv_opa_t * cir_opa;         /*Opacity of values on the circumference of an 1/4 circle*/
-    uint16_t * x_start_on_y;        /*The x coordinate of the circle for each y value*/
-    uint16_t * opa_start_on_y;      /*The index of `cir_opa` for each y value*/
+    uint8_t * buf;              /*The allocated memory of the data. NULL for the built-in tables*/
+    const lv_opa_t * cir_opa;         /*Opacity of values on the circumference of an 1/4 circle*/
+    const uint16_t * x_start_on_y;        /*The x coordinate of the circle for each y value*/
+    const uint16_t * opa_start_on_y;      /*The index of `cir_opa` for each y value*/
     int32_t life;               /*How many times the entry way used*/
     uint32_t used_cnt;          /*Like a semaphore to count the referencing masks*/
     lv_coord_t radius;          /*The radius of the entry*/
@@ -165,6 +203,25 @@ typedef struct  {
 
 typedef _lv_draw_mask_radius_circle_dsc_t _lv_draw_mask_radius_circle_dsc_arr_t[LV_CIRCLE_CACHE_SIZE];
 
+#if LV_CORNER_CACHE_SIZE > 0
+/*The corners are stored in one buffer of this size after `_lv_draw_corner_cache_t`*/
+#define _LV_DRAW_CORNER_CACHE_BUF_SIZE  (LV_CORNER_CACHE_SIZE * 1024)
+
+typedef struct {
+    lv_opa_t * buf;             /*Coverage of the top left corner in the buffer of the cache. NULL: unused entry*/
+    uint32_t buf_size;          /*Size of `buf` in bytes*/
+    uint32_t last_used;
+    lv_coord_t rout;
+    lv_coord_t rin;
+    lv_coord_t width;           /*Width of the border or 0 for a filled rectangle*/
+} _lv_draw_corner_cache_entry_t;
+
+typedef struct {
+    uint32_t use_cnt;
+    _lv_draw_corner_cache_entry_t entries[LV_CORNER_CACHE_SIZE];
+} _lv_draw_corner_cache_t;
+#endif
+
 typedef struct {
     /*The first element must be the common descriptor*/
     _lv_draw_mask_common_dsc_t dsc;
@@ -176,7 +233,7 @@ typedef struct {
         uint8_t outer: 1;
     } cfg;
 
-    _lv_draw_mask_radius_circle_dsc_t * circle;
+    const _lv_draw_mask_radius_circle_dsc_t * circle;
 } lv_draw_mask_radius_param_t;
 
 
@@ -260,6 +317,22 @@ LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply(lv_opa_t * mask_buf,
 LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply_ids(lv_opa_t * mask_buf, lv_coord_t abs_x, lv_coord_t abs_y,
                                                                 lv_coord_t len, const int16_t * ids, int16_t ids_count);
 
+/**
+ * Apply the added buffers on a line and describe the result as spans.
+ * Used internally by the library's drawing routines.
+ * The regions which are already transparent are skipped when applying the next masks.
+ * @param mask_buf store the result mask here. Has to be `len` byte long. Should be initialized with `0xFF`.
+ * @param abs_x absolute X coordinate where the line to calculate start
+ * @param abs_y absolute Y coordinate where the line to calculate start
+ * @param len length of the line to calculate (in pixel count)
+ * @param spans store the transparent, covered and partial spans of the line here.
+ *              Valid only if `LV_DRAW_MASK_RES_CHANGED` is returned.
+ * @return same as `lv_draw_mask_apply`
+ */
+LV_ATTRIBUTE_FAST_MEM lv_draw_mask_res_t lv_draw_mask_apply_spans(lv_opa_t * mask_buf, lv_coord_t abs_x,
+                                                                  lv_coord_t abs_y, lv_coord_t len,
+                                                                  lv_draw_mask_span_list_t * spans);
+
 //! @endcond
 
 /**
@@ -293,6 +366,29 @@ void lv_draw_mask_free_param(void * p);
  */
 void _lv_draw_mask_cleanup(void);
 
+/**
+ * Called by `lv_deinit()` to free the caches which are kept across the refreshes
+ */
+void _lv_draw_mask_deinit(void);
+
+#if LV_USE_CIRCLE_TABLES
+/**
+ * Get the built-in circle data of a radius.
+ * The tables are generated by `scripts/circle_table_gen.py` into `lv_draw_mask_circle_tables.c`
+ * @param radius    radius of the circle
+ * @return          pointer to the circle data or NULL if there is no built-in table for `radius`
+ */
+const _lv_draw_mask_radius_circle_dsc_t * _lv_draw_mask_circle_table_get(lv_coord_t radius);
+#endif
+
+/**
+ * Calculate the circle data of a radius at runtime.
+ * The built-in tables of `_lv_draw_mask_circle_table_get()` contain the same data.
+ * @param c         store the data here. Its previous `buf` is freed and a new one is allocated.
+ * @param radius    radius of the circle
+ */
+void _lv_draw_mask_circle_calc(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius);
+
 //! @cond Doxygen_Suppress
 
 /**
@@ -0,0 +1,343 @@
+/**
+ * GENERATED FILE, DO NOT EDIT IT!
+ * @file lv_draw_mask_circle_tables.c
+ * Built-in circle data of the radius masks.
+ * Regenerate with `scripts/circle_table_gen.py --radii 1-16,20,24,32`
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_mask.h"
+#if LV_DRAW_COMPLEX && LV_USE_CIRCLE_TABLES
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_opa_t cir_opa_1[] = {
+    180,
+};
+
+static const uint16_t opa_start_on_y_1[] = {
+    0, 1,
+};
+
+static const uint16_t x_start_on_y_1[] = {
+    0,
+};
+
+static const lv_opa_t cir_opa_2[] = {
+    0, 224, 80, 224, 0,
+};
+
+static const uint16_t opa_start_on_y_2[] = {
+    0, 2, 4,
+};
+
+static const uint16_t x_start_on_y_2[] = {
+    1, 0, 0,
+};
+
+static const lv_opa_t cir_opa_3[] = {
+    0, 240, 128, 0, 128, 240, 0,
+};
+
+static const uint16_t opa_start_on_y_3[] = {
+    0, 2, 3, 6,
+};
+
+static const uint16_t x_start_on_y_3[] = {
+    2, 2, 0, 0,
+};
+
+static const lv_opa_t cir_opa_4[] = {
+    0, 160, 240, 160, 0,
+};
+
+static const uint16_t opa_start_on_y_4[] = {
+    0, 1, 2, 3, 4,
+};
+
+static const uint16_t x_start_on_y_4[] = {
+    4, 3, 2, 1, 0,
+};
+
+static const lv_opa_t cir_opa_5[] = {
+    0, 176, 64, 128, 64, 176, 0,
+};
+
+static const uint16_t opa_start_on_y_5[] = {
+    0, 1, 2, 3, 4, 6,
+};
+
+static const uint16_t x_start_on_y_5[] = {
+    5, 4, 4, 3, 1, 0,
+};
+
+static const lv_opa_t cir_opa_6[] = {
+    0, 192, 96, 0, 208, 16, 208, 0, 96, 192, 0,
+};
+
+static const uint16_t opa_start_on_y_6[] = {
+    0, 1, 2, 3, 5, 7, 10,
+};
+
+static const uint16_t x_start_on_y_6[] = {
+    6, 5, 5, 4, 3, 1, 0,
+};
+
+static const lv_opa_t cir_opa_7[] = {
+    0, 0, 208, 128, 16, 240, 64, 240, 64, 240, 16, 128, 208, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_7[] = {
+    0, 1, 3, 4, 6, 8, 10, 13,
+};
+
+static const uint16_t x_start_on_y_7[] = {
+    7, 6, 6, 5, 4, 3, 1, 0,
+};
+
+static const lv_opa_t cir_opa_8[] = {
+    0, 0, 208, 144, 32, 128, 192, 128, 32, 144, 208, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_8[] = {
+    0, 1, 3, 4, 5, 6, 7, 8, 11,
+};
+
+static const uint16_t x_start_on_y_8[] = {
+    8, 7, 7, 7, 6, 5, 4, 1, 0,
+};
+
+static const lv_opa_t cir_opa_9[] = {
+    0, 0, 224, 160, 64, 0, 192, 32, 240, 64, 240, 32, 192, 0, 64, 160,
+    224, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_9[] = {
+    0, 1, 3, 4, 5, 7, 9, 11, 13, 17,
+};
+
+static const uint16_t x_start_on_y_9[] = {
+    9, 8, 8, 8, 7, 6, 5, 4, 1, 0,
+};
+
+static const lv_opa_t cir_opa_10[] = {
+    0, 0, 224, 160, 80, 0, 224, 64, 128, 0, 128, 64, 224, 0, 80, 160,
+    224, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_10[] = {
+    0, 1, 3, 4, 5, 7, 8, 9, 11, 13, 17,
+};
+
+static const uint16_t x_start_on_y_10[] = {
+    10, 9, 9, 9, 8, 8, 7, 6, 4, 1, 0,
+};
+
+static const lv_opa_t cir_opa_11[] = {
+    0, 0, 224, 176, 96, 16, 240, 128, 0, 208, 224, 208, 0, 128, 240, 16,
+    96, 176, 224, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_11[] = {
+    0, 1, 3, 4, 5, 7, 8, 10, 11, 12, 15, 19,
+};
+
+static const uint16_t x_start_on_y_11[] = {
+    11, 10, 10, 10, 9, 9, 8, 7, 6, 4, 1, 0,
+};
+
+static const lv_opa_t cir_opa_12[] = {
+    0, 0, 224, 176, 112, 32, 160, 16, 240, 64, 112, 64, 240, 16, 160, 32,
+    112, 176, 224, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_12[] = {
+    0, 1, 3, 4, 5, 6, 7, 9, 10, 11, 13, 15, 19,
+};
+
+static const uint16_t x_start_on_y_12[] = {
+    12, 11, 11, 11, 11, 10, 9, 9, 8, 6, 5, 1, 0,
+};
+
+static const lv_opa_t cir_opa_13[] = {
+    0, 0, 240, 192, 112, 32, 0, 192, 48, 128, 0, 176, 16, 176, 0, 128,
+    48, 192, 0, 32, 112, 192, 240, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_13[] = {
+    0, 1, 3, 4, 5, 6, 8, 9, 10, 12, 14, 16, 18, 23,
+};
+
+static const uint16_t x_start_on_y_13[] = {
+    13, 12, 12, 12, 12, 11, 11, 10, 9, 8, 7, 5, 1, 0,
+};
+
+static const lv_opa_t cir_opa_14[] = {
+    0, 0, 240, 192, 128, 48, 0, 224, 96, 0, 192, 32, 240, 240, 240, 32,
+    192, 0, 96, 224, 0, 48, 128, 192, 240, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_14[] = {
+    0, 1, 3, 4, 5, 6, 8, 9, 11, 13, 14, 15, 17, 20, 25,
+};
+
+static const uint16_t x_start_on_y_14[] = {
+    14, 13, 13, 13, 13, 12, 12, 11, 10, 9, 8, 7, 5, 1, 0,
+};
+
+static const lv_opa_t cir_opa_15[] = {
+    0, 0, 240, 192, 144, 80, 0, 224, 128, 16, 224, 64, 128, 160, 128, 64,
+    224, 16, 128, 224, 0, 80, 144, 192, 240, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_15[] = {
+    0, 1, 3, 4, 5, 6, 8, 9, 11, 12, 13, 14, 15, 17, 20, 25,
+};
+
+static const uint16_t x_start_on_y_15[] = {
+    15, 14, 14, 14, 14, 13, 13, 12, 12, 11, 10, 9, 7, 5, 1, 0,
+};
+
+static const lv_opa_t cir_opa_16[] = {
+    0, 0, 192, 144, 80, 0, 240, 144, 32, 240, 128, 0, 208, 16, 208, 32,
+    208, 16, 208, 0, 128, 240, 32, 144, 240, 0, 80, 144, 192, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_16[] = {
+    0, 1, 2, 3, 4, 5, 7, 8, 10, 11, 13, 15, 17, 19, 22, 25,
+    29,
+};
+
+static const uint16_t x_start_on_y_16[] = {
+    16, 16, 15, 15, 15, 14, 14, 13, 13, 12, 11, 10, 9, 7, 5, 2,
+    0,
+};
+
+static const lv_opa_t cir_opa_20[] = {
+    0, 0, 192, 176, 112, 48, 0, 224, 128, 16, 240, 128, 16, 224, 64, 128,
+    0, 160, 0, 160, 0, 128, 64, 224, 16, 128, 240, 16, 128, 224, 0, 48,
+    112, 176, 192, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_20[] = {
+    0, 1, 2, 3, 4, 5, 6, 8, 9, 11, 12, 14, 15, 16, 18, 20,
+    22, 24, 27, 30, 35,
+};
+
+static const uint16_t x_start_on_y_20[] = {
+    20, 20, 19, 19, 19, 19, 18, 18, 17, 17, 16, 16, 15, 14, 13, 12,
+    10, 8, 6, 2, 0,
+};
+
+static const lv_opa_t cir_opa_24[] = {
+    0, 0, 0, 208, 192, 128, 80, 16, 0, 208, 96, 16, 240, 128, 16, 240,
+    112, 0, 192, 32, 240, 48, 96, 240, 96, 48, 240, 32, 192, 0, 112, 240,
+    16, 128, 240, 16, 96, 208, 0, 16, 80, 128, 192, 208, 0, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_24[] = {
+    0, 1, 2, 4, 5, 6, 7, 8, 10, 11, 13, 14, 16, 17, 19, 21,
+    22, 24, 25, 27, 29, 32, 35, 38, 44,
+};
+
+static const uint16_t x_start_on_y_24[] = {
+    24, 24, 23, 23, 23, 23, 23, 22, 22, 21, 21, 20, 20, 19, 18, 18,
+    16, 16, 14, 13, 11, 9, 7, 2, 0,
+};
+
+static const lv_opa_t cir_opa_32[] = {
+    0, 0, 0, 240, 192, 176, 128, 80, 16, 0, 208, 144, 48, 0, 208, 96,
+    16, 240, 128, 16, 224, 80, 0, 192, 16, 240, 64, 112, 0, 160, 160, 160,
+    0, 112, 64, 240, 16, 192, 0, 80, 224, 16, 128, 240, 16, 96, 208, 0,
+    48, 144, 208, 0, 16, 80, 128, 176, 192, 240, 0, 0, 0,
+};
+
+static const uint16_t opa_start_on_y_32[] = {
+    0, 1, 2, 4, 5, 6, 7, 8, 9, 11, 12, 13, 15, 16, 18, 19,
+    21, 22, 24, 26, 27, 28, 30, 31, 32, 34, 36, 38, 41, 44, 47, 51,
+    58,
+};
+
+static const uint16_t x_start_on_y_32[] = {
+    32, 32, 31, 31, 31, 31, 31, 31, 30, 30, 30, 29, 29, 28, 28, 27,
+    27, 26, 25, 25, 24, 23, 22, 21, 20, 18, 17, 15, 13, 11, 8, 2,
+    0,
+};
+
+/*1321 bytes of circle data*/
+static const _lv_draw_mask_radius_circle_dsc_t circle_tables[] = {
+    {.cir_opa = cir_opa_1, .x_start_on_y = x_start_on_y_1, .opa_start_on_y = opa_start_on_y_1, .radius = 1},
+    {.cir_opa = cir_opa_2, .x_start_on_y = x_start_on_y_2, .opa_start_on_y = opa_start_on_y_2, .radius = 2},
+    {.cir_opa = cir_opa_3, .x_start_on_y = x_start_on_y_3, .opa_start_on_y = opa_start_on_y_3, .radius = 3},
+    {.cir_opa = cir_opa_4, .x_start_on_y = x_start_on_y_4, .opa_start_on_y = opa_start_on_y_4, .radius = 4},
+    {.cir_opa = cir_opa_5, .x_start_on_y = x_start_on_y_5, .opa_start_on_y = opa_start_on_y_5, .radius = 5},
+    {.cir_opa = cir_opa_6, .x_start_on_y = x_start_on_y_6, .opa_start_on_y = opa_start_on_y_6, .radius = 6},
+    {.cir_opa = cir_opa_7, .x_start_on_y = x_start_on_y_7, .opa_start_on_y = opa_start_on_y_7, .radius = 7},
+    {.cir_opa = cir_opa_8, .x_start_on_y = x_start_on_y_8, .opa_start_on_y = opa_start_on_y_8, .radius = 8},
+    {.cir_opa = cir_opa_9, .x_start_on_y = x_start_on_y_9, .opa_start_on_y = opa_start_on_y_9, .radius = 9},
+    {.cir_opa = cir_opa_10, .x_start_on_y = x_start_on_y_10, .opa_start_on_y = opa_start_on_y_10, .radius = 10},
+    {.cir_opa = cir_opa_11, .x_start_on_y = x_start_on_y_11, .opa_start_on_y = opa_start_on_y_11, .radius = 11},
+    {.cir_opa = cir_opa_12, .x_start_on_y = x_start_on_y_12, .opa_start_on_y = opa_start_on_y_12, .radius = 12},
+    {.cir_opa = cir_opa_13, .x_start_on_y = x_start_on_y_13, .opa_start_on_y = opa_start_on_y_13, .radius = 13},
+    {.cir_opa = cir_opa_14, .x_start_on_y = x_start_on_y_14, .opa_start_on_y = opa_start_on_y_14, .radius = 14},
+    {.cir_opa = cir_opa_15, .x_start_on_y = x_start_on_y_15, .opa_start_on_y = opa_start_on_y_15, .radius = 15},
+    {.cir_opa = cir_opa_16, .x_start_on_y = x_start_on_y_16, .opa_start_on_y = opa_start_on_y_16, .radius = 16},
+    {.cir_opa = cir_opa_20, .x_start_on_y = x_start_on_y_20, .opa_start_on_y = opa_start_on_y_20, .radius = 20},
+    {.cir_opa = cir_opa_24, .x_start_on_y = x_start_on_y_24, .opa_start_on_y = opa_start_on_y_24, .radius = 24},
+    {.cir_opa = cir_opa_32, .x_start_on_y = x_start_on_y_32, .opa_start_on_y = opa_start_on_y_32, .radius = 32},
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const _lv_draw_mask_radius_circle_dsc_t * _lv_draw_mask_circle_table_get(lv_coord_t radius)
+{
+    switch(radius) {
+        case 1:
+            return &circle_tables[0];
+        case 2:
+            return &circle_tables[1];
+        case 3:
+            return &circle_tables[2];
+        case 4:
+            return &circle_tables[3];
+        case 5:
+            return &circle_tables[4];
+        case 6:
+            return &circle_tables[5];
+        case 7:
+            return &circle_tables[6];
+        case 8:
+            return &circle_tables[7];
+        case 9:
+            return &circle_tables[8];
+        case 10:
+            return &circle_tables[9];
+        case 11:
+            return &circle_tables[10];
+        case 12:
+            return &circle_tables[11];
+        case 13:
+            return &circle_tables[12];
+        case 14:
+            return &circle_tables[13];
+        case 15:
+            return &circle_tables[14];
+        case 16:
+            return &circle_tables[15];
+        case 20:
+            return &circle_tables[16];
+        case 24:
+            return &circle_tables[17];
+        case 32:
+            return &circle_tables[18];
+        default:
+            return NULL;
+    }
+}
+
+#endif /*LV_DRAW_COMPLEX && LV_USE_CIRCLE_TABLES*/
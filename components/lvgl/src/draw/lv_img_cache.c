@@ -10,8 +10,12 @@
 #include "lv_img_cache.h"
 #include "lv_img_decoder.h"
 #include "lv_draw_img.h"
+#include "lv_draw.h"
 #include "../hal/lv_hal_tick.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_timer.h"
+#include "../core/lv_refr.h"
+#include "../core/lv_disp.h"
 
 /*********************
  *      DEFINES
@@ -26,23 +30,140 @@
  * "die" from very high values*/
 #define LV_IMG_CACHE_LIFE_LIMIT 1000
 
+/*Number of least recently used entries checked to find the entry with the least life to drop*/
+#define LV_IMG_CACHE_EVICT_WINDOW 8
+
+/*Minimal number of hash buckets. Must be a power of 2*/
+#define LV_IMG_CACHE_MIN_BUCKET_CNT 16
+
+/*Check the finished background decoding jobs this often [ms]*/
+#define LV_IMG_CACHE_JOB_PERIOD 10
+
+/*Number of images whose dominant color is remembered for the placeholders*/
+#define LV_IMG_CACHE_DOMINANT_CNT 16
+
+/*Number of failed decoding jobs kept to not decode the same broken images again and again*/
+#define LV_IMG_CACHE_FAILED_JOB_CNT 8
+
+/*Max. width and height of the transformed images. They are stored on 11 bits in `lv_img_header_t`.*/
+#define LV_IMG_CACHE_TRANSFORM_MAX_WH 2047
+
+/*Color format of the converted transparent images*/
+#if LV_COLOR_DEPTH == 16
+    #define LV_IMG_CACHE_CONVERT_CF LV_IMG_CF_RGB565A8
+#else
+    #define LV_IMG_CACHE_CONVERT_CF LV_IMG_CF_TRUE_COLOR_ALPHA
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_IMG_CACHE_DEF_SIZE
+#if LV_IMG_CACHE_ASYNC
+enum {
+    JOB_QUEUED,
+    JOB_RUNNING,
+    JOB_READY,
+    JOB_FAILED,
+};
+
+/*An image decoded in the background or a function to run on the worker. `state` is protected by the driver's lock.*/
+typedef struct _lv_img_cache_job_t {
+    struct _lv_img_cache_job_t * next;
+    void (*task_cb)(void *);            /*Call it instead of decoding an image*/
+    void * task_user_data;
+    _lv_img_cache_entry_t * entry;      /*Opened by the worker and added to the cache when ready*/
+    const void * src;                   /*Own copy of the path of files*/
+    lv_color_t color;
+    int32_t frame_id;
+    uint32_t hash;
+    lv_disp_t * disp;                   /*Invalidate `inv_area` on this display when ready*/
+    lv_area_t inv_area;
+    lv_color_t dominant;
+    uint8_t state;
+    uint8_t canceled : 1;
+    uint8_t inv_all : 1;                /*Drawn on more displays: invalidate all screens*/
+    uint8_t has_dominant : 1;
+} _lv_img_cache_job_t;
+
+typedef struct {
+    uint32_t hash;
+    lv_color_t color;
+    uint8_t valid;
+} _lv_img_cache_dominant_t;
+#endif
+
+struct _lv_img_cache_t {
+    _lv_img_cache_entry_t ** buckets;   /*Entries with the same source hash*/
+    uint32_t bucket_cnt;                /*Number of buckets, power of 2*/
+    _lv_img_cache_entry_t * head;       /*The most recently used entry*/
+    _lv_img_cache_entry_t * tail;       /*The least recently used entry*/
+    lv_ll_t pin_ll;                     /*Pinned sources. File paths are copied.*/
+    uint32_t entry_cnt;
+    uint32_t max_entry_cnt;
+    uint32_t size;                      /*Memory used by the entries and their decoded images*/
+    uint32_t max_size;                  /*0: no limit*/
+    uint32_t clock;                     /*Incremented on every open to age all entries at once*/
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+    uint32_t evict_cnt;
+#if LV_IMG_CACHE_ASYNC
+    lv_img_cache_async_drv_t * async_drv;
+    _lv_img_cache_job_t * jobs;         /*Images being decoded in the background in the order of the requests*/
+    lv_timer_t * job_timer;             /*Adds the decoded images to the cache*/
+    _lv_img_cache_dominant_t dominant[LV_IMG_CACHE_DOMINANT_CNT];
+#endif
+};
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static lv_res_t entry_open(_lv_img_cache_entry_t * entry, const void * src, lv_color_t color, int32_t frame_id);
 #if LV_IMG_CACHE_DEF_SIZE
+    static _lv_img_cache_t * get_cache(void);
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t src_hash(const void * src);
+    static uint32_t get_entry_size(const _lv_img_cache_entry_t * entry);
+    static bool is_pinned(_lv_img_cache_t * cache, const void * src);
+    static bool evict_one(_lv_img_cache_t * cache);
+    static _lv_img_cache_entry_t * entry_find(_lv_img_cache_t * cache, const void * src, uint32_t hash, lv_color_t color,
+                                              lv_opa_t recolor_opa, int32_t frame_id);
+    static void entry_use(_lv_img_cache_t * cache, _lv_img_cache_entry_t * entry);
+    static void entry_add(_lv_img_cache_t * cache, _lv_img_cache_entry_t * entry);
+    static void entry_drop(_lv_img_cache_t * cache, _lv_img_cache_entry_t * entry);
+    #if LV_IMG_CACHE_RECOLOR || LV_IMG_CACHE_TRANSFORM
+        static bool variant_src_set(_lv_img_cache_entry_t * variant, const _lv_img_cache_entry_t * base);
+    #endif
+    #if LV_IMG_CACHE_TRANSFORM
+        static bool same_image(const _lv_img_cache_entry_t * entry, const _lv_img_cache_entry_t * base);
+    #endif
+    #if LV_IMG_CACHE_ASYNC
+        static _lv_img_cache_job_t * job_find(_lv_img_cache_t * cache, const void * src, uint32_t hash, lv_color_t color,
+                                              int32_t frame_id);
+        static _lv_img_cache_job_t * job_add(_lv_img_cache_t * cache, const void * src, uint32_t hash, lv_color_t color,
+                                             int32_t frame_id);
+        static uint8_t job_get_state(_lv_img_cache_t * cache, _lv_img_cache_job_t * job);
+        static void job_add_area(_lv_img_cache_job_t * job, const lv_area_t * area);
+        static void job_invalidate(_lv_img_cache_job_t * job);
+        static void job_queue(_lv_img_cache_t * cache, _lv_img_cache_job_t * job);
+        static void job_free(_lv_img_cache_job_t * job);
+        static void job_cancel(_lv_img_cache_t * cache, const void * src);
+        static void job_timer_cb(lv_timer_t * t);
+        static bool get_dominant_color(const lv_img_decoder_dsc_t * dsc, lv_color_t * color);
+    #endif
+    #if LV_IMG_CACHE_CONVERT
+        static bool convert_needed(const lv_img_decoder_dsc_t * dsc);
+    #endif
+    #if LV_IMG_CACHE_CONVERT || LV_IMG_CACHE_RECOLOR
+        static bool convert_img(lv_img_decoder_dsc_t * dsc, lv_color_t recolor, lv_opa_t recolor_opa,
+                                const uint8_t ** img_data, lv_img_cf_t * cf);
+    #endif
 #endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
-#if LV_IMG_CACHE_DEF_SIZE
-    static uint16_t entry_cnt;
-#endif
 
 /**********************
  *      MACROS
@@ -66,78 +187,504 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     _lv_img_cache_entry_t * cached_src = NULL;
 
 #if LV_IMG_CACHE_DEF_SIZE
-    if(entry_cnt == 0) {
+    _lv_img_cache_t * cache = get_cache();
+    if(cache == NULL || cache->max_entry_cnt == 0) {
         LV_LOG_WARN("lv_img_cache_open: the cache size is 0");
         return NULL;
     }
 
-    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    /*Make all entries older*/
+    cache->clock += LV_IMG_CACHE_AGING;
+
+    uint32_t hash = src_hash(src);
+    cached_src = entry_find(cache, src, hash, color, LV_OPA_TRANSP, frame_id);
+    if(cached_src) {
+        entry_use(cache, cached_src);
+        LV_LOG_TRACE("image source found in the cache");
+        return cached_src;
+    }
+
+    /*The image is not cached then cache it now*/
+    cache->miss_cnt++;
+    cached_src = lv_mem_alloc(sizeof(_lv_img_cache_entry_t));
+    LV_ASSERT_MALLOC(cached_src);
+    if(cached_src == NULL) return NULL;
+    lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
+#else
+    cached_src = &LV_GC_ROOT(_lv_img_cache_single);
+#endif
+    lv_res_t open_res = entry_open(cached_src, src, color, frame_id);
+    if(open_res == LV_RES_INV) {
+        LV_LOG_WARN("Image draw cannot open the image resource");
+#if LV_IMG_CACHE_DEF_SIZE
+        lv_mem_free(cached_src);
+#else
+        lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
+        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
+#endif
+        return NULL;
+    }
+
+#if LV_IMG_CACHE_DEF_SIZE
+    cached_src->hash = hash;
+    entry_add(cache, cached_src);
+#else
+    cached_src->life = 0;
+#endif
+
+    return cached_src;
+}
+
+/**
+ * Open an image with recoloring already applied on its pixels and cache it.
+ * The recolored variants are built from the cached image once and cached beside it,
+ * so drawing them doesn't need to mix the colors again.
+ * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param recolor the color to mix to the pixels. It's also the color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param recolor_opa the opacity of the recoloring
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @return pointer to the cache entry or NULL if can open the image.
+ *         If `recolor_opa` of the entry is 0 the recoloring is not applied yet and it should be applied when drawing.
+ */
+_lv_img_cache_entry_t * _lv_img_cache_open_recolor(const void * src, lv_color_t recolor, lv_opa_t recolor_opa,
+                                                   int32_t frame_id)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_RECOLOR
+    _lv_img_cache_t * cache = get_cache();
+    if(recolor_opa == LV_OPA_TRANSP || cache == NULL || cache->max_entry_cnt == 0) {
+        return _lv_img_cache_open(src, recolor, frame_id);
+    }
+
+    uint32_t hash = src_hash(src);
+    _lv_img_cache_entry_t * variant = entry_find(cache, src, hash, recolor, recolor_opa, frame_id);
+    if(variant) {
+        cache->clock += LV_IMG_CACHE_AGING;
+        entry_use(cache, variant);
+        return variant;
+    }
+
+    /*Build the variant from the normal image*/
+    _lv_img_cache_entry_t * base = _lv_img_cache_open(src, recolor, frame_id);
+    if(base == NULL || base->dec_dsc.error_msg) return base;
+
+    cache->miss_cnt++;
+    variant = lv_mem_alloc(sizeof(_lv_img_cache_entry_t));
+    LV_ASSERT_MALLOC(variant);
+    if(variant == NULL) return base;
+    lv_memset_00(variant, sizeof(_lv_img_cache_entry_t));
+
+    uint32_t t_start = lv_tick_get();
+    lv_img_cf_t cf;
+    if(!convert_img(&base->dec_dsc, recolor, recolor_opa, &variant->dec_dsc.img_data, &cf)) {
+        lv_mem_free(variant);
+        return base;
+    }
+
+    if(!variant_src_set(variant, base)) {
+        lv_mem_free((void *)variant->dec_dsc.img_data);
+        lv_mem_free(variant);
+        return base;
+    }
+
+    variant->dec_dsc.header.cf = cf;
+    variant->dec_dsc.header.w = base->dec_dsc.header.w;
+    variant->dec_dsc.header.h = base->dec_dsc.header.h;
+    variant->dec_dsc.color = recolor;
+    variant->dec_dsc.frame_id = frame_id;
+    variant->dec_dsc.time_to_open = base->dec_dsc.time_to_open + lv_tick_elaps(t_start);
+    variant->recolor_opa = recolor_opa;
+    variant->converted = 1;
+    variant->variant = 1;
+    variant->hash = hash;
+    entry_add(cache, variant);
+
+    return variant;
+#else
+    LV_UNUSED(recolor_opa);
+    return _lv_img_cache_open(src, recolor, frame_id);
+#endif
+}
+
+/**
+ * Open the zoomed and/or rotated variant of a cached image and cache it.
+ * The variant is transformed once with the draw context and can be drawn without transformation at `ofs`.
+ * Only one transformed variant is kept per image, so a changing angle or zoom doesn't fill the cache.
+ * A variant is created only if the same transformation is requested twice in a row,
+ * so an animated angle or zoom is transformed while drawing and doesn't trash the cache.
+ * @param draw_ctx the draw context to transform the image with
+ * @param base an entry returned by `_lv_img_cache_open()` or `_lv_img_cache_open_recolor()` with `img_data`
+ * @param cf the color format to read `img_data` as (`LV_IMG_CF_TRUE_COLOR/_ALPHA/_CHROMA_KEYED` or `LV_IMG_CF_RGB565A8`)
+ * @param angle rotation angle in 0.1 degree
+ * @param zoom zoom factor, 256: no zoom
+ * @param pivot the pivot of the rotation and zoom
+ * @param antialias true: transform with antialiasing
+ * @return pointer to the cache entry or NULL if the image can't or shouldn't be transformed in advance.
+ *         `base` may be dropped from the cache when a new variant is created.
+ */
+_lv_img_cache_entry_t * _lv_img_cache_open_transformed(lv_draw_ctx_t * draw_ctx, _lv_img_cache_entry_t * base,
+                                                       lv_img_cf_t cf, int16_t angle, uint16_t zoom,
+                                                       const lv_point_t * pivot, bool antialias)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_TRANSFORM
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache == NULL || base == NULL || base->dec_dsc.img_data == NULL || zoom == 0) return NULL;
+    if(draw_ctx->draw_transform == NULL) return NULL;
 
-    /*Decrement all lifes. Make the entries older*/
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
+    /*Drop the variant of the image if it was transformed differently*/
+    _lv_img_cache_entry_t * variant = cache->buckets[base->hash & (cache->bucket_cnt - 1)];
+    while(variant) {
+        _lv_img_cache_entry_t * next = variant->bucket_next;
+        if(variant->zoom && same_image(variant, base)) {
+            if(variant->angle == angle && variant->zoom == zoom && variant->antialias == antialias &&
+               variant->pivot.x == pivot->x && variant->pivot.y == pivot->y) {
+                cache->clock += LV_IMG_CACHE_AGING;
+                entry_use(cache, variant);
+                return variant;
+            }
+            entry_drop(cache, variant);
         }
+        variant = next;
     }
 
-    for(i = 0; i < entry_cnt; i++) {
-        if(color.full == cache[i].dec_dsc.color.full &&
-           frame_id == cache[i].dec_dsc.frame_id &&
-           lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            /*If opened increment its life.
-             *Image difficult to open should live longer to keep avoid frequent their recaching.
-             *Therefore increase `life` with `time_to_open`*/
-            cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
-            LV_LOG_TRACE("image source found in the cache");
-            break;
+    /*Remember the first request and create the variant only if it's requested again*/
+    uint32_t key = (uint32_t)(uint16_t)angle ^ ((uint32_t)zoom << 16);
+    key ^= ((uint32_t)pivot->x * 0x9E3779B1) ^ ((uint32_t)pivot->y * 0x85EBCA77);
+    key = (key << 1) | (antialias ? 1 : 0);
+    if(!base->transform_requested || base->transform_key != key) {
+        base->transform_key = key;
+        base->transform_requested = 1;
+        return NULL;
+    }
+
+    lv_area_t area;
+    lv_coord_t w = base->dec_dsc.header.w;
+    lv_coord_t h = base->dec_dsc.header.h;
+    _lv_img_buf_get_transformed_area(&area, w, h, angle, zoom, pivot);
+    lv_coord_t dest_w = lv_area_get_width(&area);
+    lv_coord_t dest_h = lv_area_get_height(&area);
+    if(dest_w <= 0 || dest_h <= 0) return NULL;
+    if(dest_w > LV_IMG_CACHE_TRANSFORM_MAX_WH || dest_h > LV_IMG_CACHE_TRANSFORM_MAX_WH) return NULL;
+
+    /*Don't drop all the other images for one variant*/
+    uint32_t data_size = lv_img_buf_get_img_size(dest_w, dest_h, LV_IMG_CACHE_CONVERT_CF);
+    if(cache->max_size && data_size + sizeof(_lv_img_cache_entry_t) > cache->max_size) return NULL;
+
+    variant = lv_mem_alloc(sizeof(_lv_img_cache_entry_t));
+    LV_ASSERT_MALLOC(variant);
+    if(variant == NULL) return NULL;
+    lv_memset_00(variant, sizeof(_lv_img_cache_entry_t));
+
+    uint8_t * data = lv_mem_alloc(data_size);
+    LV_ASSERT_MALLOC(data);
+    if(data == NULL || !variant_src_set(variant, base)) {
+        if(data) lv_mem_free(data);
+        lv_mem_free(variant);
+        return NULL;
+    }
+
+    cache->miss_cnt++;
+    uint32_t t_start = lv_tick_get();
+
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    dsc.angle = angle;
+    dsc.zoom = zoom;
+    dsc.pivot = *pivot;
+    dsc.antialias = antialias;
+
+#if LV_COLOR_DEPTH == 16
+    /*RGB565A8: the colors and the alpha channel can be written in place*/
+    lv_opa_t * abuf = data + dest_w * dest_h * sizeof(lv_color_t);
+    lv_draw_transform(draw_ctx, &area, base->dec_dsc.img_data, w, h, w, &dsc, cf, (lv_color_t *)data, abuf);
+#else
+    /*Transform line by line and merge the alpha channel into the pixels*/
+    lv_color_t * cbuf = lv_mem_buf_get(dest_w * sizeof(lv_color_t));
+    lv_opa_t * abuf = lv_mem_buf_get(dest_w);
+    lv_area_t line = area;
+    uint8_t * px = data;
+    for(line.y1 = area.y1; line.y1 <= area.y2; line.y1++) {
+        line.y2 = line.y1;
+        lv_draw_transform(draw_ctx, &line, base->dec_dsc.img_data, w, h, w, &dsc, cf, cbuf, abuf);
+        lv_coord_t x;
+        for(x = 0; x < dest_w; x++) {
+            lv_memcpy_small(px, &cbuf[x], LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+            px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = abuf[x];
+            px += LV_IMG_PX_SIZE_ALPHA_BYTE;
         }
     }
+    lv_mem_buf_release(abuf);
+    lv_mem_buf_release(cbuf);
+#endif
 
-    /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
+    variant->dec_dsc.img_data = data;
+    variant->dec_dsc.header.cf = LV_IMG_CACHE_CONVERT_CF;
+    variant->dec_dsc.header.w = dest_w;
+    variant->dec_dsc.header.h = dest_h;
+    variant->dec_dsc.color = base->dec_dsc.color;
+    variant->dec_dsc.frame_id = base->dec_dsc.frame_id;
+    variant->dec_dsc.time_to_open = base->dec_dsc.time_to_open + lv_tick_elaps(t_start);
+    variant->recolor_opa = base->recolor_opa;
+    variant->converted = 1;
+    variant->variant = 1;
+    variant->angle = angle;
+    variant->zoom = zoom;
+    variant->pivot = *pivot;
+    variant->antialias = antialias;
+    variant->ofs.x = area.x1;
+    variant->ofs.y = area.y1;
+    variant->hash = base->hash;
+    entry_add(cache, variant);
+
+    return variant;
+#else
+    LV_UNUSED(draw_ctx);
+    LV_UNUSED(base);
+    LV_UNUSED(cf);
+    LV_UNUSED(angle);
+    LV_UNUSED(zoom);
+    LV_UNUSED(pivot);
+    LV_UNUSED(antialias);
+    return NULL;
+#endif
+}
+
+/**
+ * Check if an image is being decoded in the background.
+ * If a file or an image of an external decoder (e.g. PNG or JPG) is not cached a decoding job is started for it.
+ * The area is invalidated when the image is ready.
+ * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @param area the area of the image on the display being refreshed
+ * @param placeholder_color store the color to draw instead of the image here
+ * @param placeholder_opa store the opacity of the placeholder here
+ * @return true: the image is not ready, draw the placeholder; false: open the image normally
+ */
+bool _lv_img_cache_decode_async(const void * src, lv_color_t color, int32_t frame_id, const lv_area_t * area,
+                                lv_color_t * placeholder_color, lv_opa_t * placeholder_opa)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_ASYNC
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache == NULL || cache->async_drv == NULL || cache->max_entry_cnt == 0) return false;
 
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
-            cached_src = &cache[i];
+    uint32_t hash = src_hash(src);
+    if(entry_find(cache, src, hash, color, LV_OPA_TRANSP, frame_id)) return false;
+
+    _lv_img_cache_job_t * job = job_find(cache, src, hash, color, frame_id);
+    if(job == NULL) {
+        /*Files are read and decoded (e.g. PNG or JPG) but the variables are used in place
+         *unless an external decoder needs to decode them*/
+        lv_img_header_t header;
+        if(lv_img_decoder_get_info(src, &header) != LV_RES_OK) return false;
+        if(lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE && header.cf != LV_IMG_CF_RAW &&
+           header.cf != LV_IMG_CF_RAW_ALPHA && header.cf != LV_IMG_CF_RAW_CHROMA_KEYED) {
+            return false;
         }
+
+        job = job_add(cache, src, hash, color, frame_id);
+        if(job == NULL) return false;
+    }
+    /*Let the normal drawing show the error*/
+    else if(job_get_state(cache, job) == JOB_FAILED) {
+        return false;
     }
 
-    /*Close the decoder to reuse if it was opened (has a valid source)*/
-    if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
-        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
+    job_add_area(job, area);
+
+    _lv_img_cache_dominant_t * dominant = &cache->dominant[hash % LV_IMG_CACHE_DOMINANT_CNT];
+    if(dominant->valid && dominant->hash == hash) {
+        *placeholder_color = dominant->color;
+        *placeholder_opa = LV_OPA_COVER;
     }
     else {
-        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
+        *placeholder_color = cache->async_drv->placeholder_color;
+        *placeholder_opa = cache->async_drv->placeholder_opa;
     }
+
+    return true;
 #else
-    cached_src = &LV_GC_ROOT(_lv_img_cache_single);
+    LV_UNUSED(src);
+    LV_UNUSED(color);
+    LV_UNUSED(frame_id);
+    LV_UNUSED(area);
+    LV_UNUSED(placeholder_color);
+    LV_UNUSED(placeholder_opa);
+    return false;
 #endif
-    /*Open the image and measure the time to open*/
-    uint32_t t_start  = lv_tick_get();
-    lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
-    if(open_res == LV_RES_INV) {
-        LV_LOG_WARN("Image draw cannot open the image resource");
-        lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
-        return NULL;
+}
+
+/**
+ * Initialize a background decoding driver with default values.
+ * @param drv pointer to a driver to initialize
+ */
+void lv_img_cache_async_drv_init(lv_img_cache_async_drv_t * drv)
+{
+    lv_memset_00(drv, sizeof(lv_img_cache_async_drv_t));
+    drv->placeholder_color = lv_palette_lighten(LV_PALETTE_GREY, 3);
+    drv->placeholder_opa = LV_OPA_COVER;
+}
+
+/**
+ * Start decoding the images in the background.
+ * The lock is used for the memory management too, so register the driver before the worker is started.
+ * @param drv pointer to an initialized driver. Only its pointer is saved so it should be static or global.
+ */
+void lv_img_cache_async_drv_register(lv_img_cache_async_drv_t * drv)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_ASYNC
+    LV_ASSERT_NULL(drv->lock_cb);
+    LV_ASSERT_NULL(drv->unlock_cb);
+    LV_ASSERT_NULL(drv->wake_cb);
+
+    _lv_img_cache_t * cache = get_cache();
+    if(cache == NULL) return;
+
+    if(cache->job_timer == NULL) {
+        cache->job_timer = lv_timer_create(job_timer_cb, LV_IMG_CACHE_JOB_PERIOD, cache);
+        LV_ASSERT_MALLOC(cache->job_timer);
+        if(cache->job_timer == NULL) return;
+        lv_timer_pause(cache->job_timer);
     }
 
-    cached_src->life = 0;
+    cache->async_drv = drv;
+    _lv_mem_set_lock_cb(drv->lock_cb, drv->unlock_cb);
+#else
+    LV_UNUSED(drv);
+    LV_LOG_WARN("Background image decoding is disabled by LV_IMG_CACHE_ASYNC = 0");
+#endif
+}
 
-    /*If `time_to_open` was not set in the open function set it here*/
-    if(cached_src->dec_dsc.time_to_open == 0) {
-        cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
+/**
+ * Decode the next image waiting for background decoding. Call it from the worker thread.
+ * @return true: an image was decoded (or failed to decode); false: there was nothing to do
+ */
+bool lv_img_cache_async_work(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_ASYNC
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache == NULL || cache->async_drv == NULL) return false;
+
+    /*Take the oldest job. Only the LVGL thread modifies the list and it uses the lock to do so.*/
+    cache->async_drv->lock_cb();
+    _lv_img_cache_job_t * job;
+    for(job = cache->jobs; job; job = job->next) {
+        if(job->state == JOB_QUEUED && !job->canceled) break;
     }
+    if(job) job->state = JOB_RUNNING;
+    cache->async_drv->unlock_cb();
 
-    if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
+    if(job == NULL) return false;
 
-    return cached_src;
+    if(job->task_cb) {
+        job->task_cb(job->task_user_data);
+        cache->async_drv->lock_cb();
+        job->state = JOB_READY;
+        cache->async_drv->unlock_cb();
+        return true;
+    }
+
+    lv_res_t res = entry_open(job->entry, job->src, job->color, job->frame_id);
+    if(res == LV_RES_OK) job->has_dominant = get_dominant_color(&job->entry->dec_dsc, &job->dominant);
+
+    cache->async_drv->lock_cb();
+    job->state = res == LV_RES_OK ? JOB_READY : JOB_FAILED;
+    cache->async_drv->unlock_cb();
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Run a function on the background decoding worker, e.g. to decode the next part of an image drawn line by line.
+ * The function is called even if the image cache is invalidated meanwhile, so it can free the data of its owner.
+ * @param cb the function to call
+ * @param user_data parameter of `cb`
+ * @return true: `cb` will be called; false: there is no background decoding driver
+ */
+bool _lv_img_cache_async_call(void (*cb)(void * user_data), void * user_data)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_ASYNC
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache == NULL || cache->async_drv == NULL) return false;
+
+    _lv_img_cache_job_t * job = lv_mem_alloc(sizeof(_lv_img_cache_job_t));
+    LV_ASSERT_MALLOC(job);
+    if(job == NULL) return false;
+    lv_memset_00(job, sizeof(_lv_img_cache_job_t));
+    job->task_cb = cb;
+    job->task_user_data = user_data;
+    job->state = JOB_QUEUED;
+
+    job_queue(cache, job);
+    return true;
+#else
+    LV_UNUSED(cb);
+    LV_UNUSED(user_data);
+    return false;
+#endif
+}
+
+/**
+ * Lock the data shared with the functions running on the worker.
+ * Does nothing without a background decoding driver.
+ */
+void _lv_img_cache_async_lock(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_ASYNC
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache && cache->async_drv) cache->async_drv->lock_cb();
+#endif
+}
+
+/**
+ * Unlock the data shared with the functions running on the worker.
+ */
+void _lv_img_cache_async_unlock(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_ASYNC
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache && cache->async_drv) cache->async_drv->unlock_cb();
+#endif
+}
+
+/**
+ * Decode images before they are drawn, e.g. the images of the next screen.
+ * With a background decoding driver the images are decoded by the worker, else right away.
+ * The images are cached with the default `img_recolor` color (black).
+ * @param src_list array of image sources. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param src_cnt number of sources in `src_list`
+ */
+void lv_img_cache_prefetch(const void * const src_list[], uint32_t src_cnt)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    _lv_img_cache_t * cache = get_cache();
+    if(cache == NULL || cache->max_entry_cnt == 0) return;
+
+    lv_color_t color = lv_color_black();
+    uint32_t i;
+    for(i = 0; i < src_cnt; i++) {
+        const void * src = src_list[i];
+        lv_img_src_t src_type = lv_img_src_get_type(src);
+        if(src_type != LV_IMG_SRC_FILE && src_type != LV_IMG_SRC_VARIABLE) continue;
+
+#if LV_IMG_CACHE_ASYNC
+        if(cache->async_drv) {
+            uint32_t hash = src_hash(src);
+            if(entry_find(cache, src, hash, color, LV_OPA_TRANSP, 0) == NULL &&
+               job_find(cache, src, hash, color, 0) == NULL) {
+                job_add(cache, src, hash, color, 0);
+            }
+            continue;
+        }
+#endif
+        _lv_img_cache_open(src, color, 0);
+    }
+#else
+    LV_UNUSED(src_list);
+    LV_UNUSED(src_cnt);
+#endif
 }
 
 /**
@@ -152,23 +699,51 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
     LV_UNUSED(new_entry_cnt);
     LV_LOG_WARN("Can't change cache size because it's disabled by LV_IMG_CACHE_DEF_SIZE = 0");
 #else
-    if(LV_GC_ROOT(_lv_img_cache_array) != NULL) {
-        /*Clean the cache before free it*/
-        lv_img_cache_invalidate_src(NULL);
-        lv_mem_free(LV_GC_ROOT(_lv_img_cache_array));
-    }
+    _lv_img_cache_t * cache = get_cache();
+    if(cache == NULL) return;
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt);
-    LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_img_cache_array));
-    if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
-        entry_cnt = 0;
-        return;
+    /*Clean the cache*/
+    lv_img_cache_invalidate_src(NULL);
+
+    /*Have about 2 entries per bucket*/
+    uint32_t bucket_cnt = LV_IMG_CACHE_MIN_BUCKET_CNT;
+    while(bucket_cnt * 2 < new_entry_cnt) bucket_cnt <<= 1;
+
+    if(bucket_cnt != cache->bucket_cnt) {
+        lv_mem_free(cache->buckets);
+        cache->buckets = lv_mem_alloc(sizeof(_lv_img_cache_entry_t *) * bucket_cnt);
+        LV_ASSERT_MALLOC(cache->buckets);
+        if(cache->buckets == NULL) {
+            cache->bucket_cnt = 0;
+            cache->max_entry_cnt = 0;
+            return;
+        }
+        lv_memset_00(cache->buckets, sizeof(_lv_img_cache_entry_t *) * bucket_cnt);
+        cache->bucket_cnt = bucket_cnt;
     }
-    entry_cnt = new_entry_cnt;
 
-    /*Clean the cache*/
-    lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(_lv_img_cache_entry_t));
+    cache->max_entry_cnt = new_entry_cnt;
+#endif
+}
+
+/**
+ * Set the maximal memory used by the cached images.
+ * The entries and the decoded images (if the decoder allocated them) are counted.
+ * @param size the memory limit in bytes. 0: no limit, only the number of images is limited
+ */
+void lv_img_cache_set_mem_size(uint32_t size)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    LV_UNUSED(size);
+    LV_LOG_WARN("Can't change cache size because it's disabled by LV_IMG_CACHE_DEF_SIZE = 0");
+#else
+    _lv_img_cache_t * cache = get_cache();
+    if(cache == NULL) return;
+
+    cache->max_size = size;
+    while(cache->max_size && cache->size > cache->max_size) {
+        if(!evict_one(cache)) break;
+    }
 #endif
 }
 
@@ -181,26 +756,202 @@ void lv_img_cache_invalidate_src(const void * src)
 {
     LV_UNUSED(src);
 #if LV_IMG_CACHE_DEF_SIZE
-    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache == NULL) return;
 
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
+#if LV_IMG_CACHE_ASYNC
+    job_cancel(cache, src);
+#endif
+
+    if(src == NULL) {
+        while(cache->head) entry_drop(cache, cache->head);
+        return;
+    }
+
+    if(cache->bucket_cnt == 0) return;
 
-            lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
+    /*All entries of a source are in the same bucket*/
+    uint32_t hash = src_hash(src);
+    _lv_img_cache_entry_t * entry = cache->buckets[hash & (cache->bucket_cnt - 1)];
+    while(entry) {
+        _lv_img_cache_entry_t * next = entry->bucket_next;
+        if(entry->hash == hash && lv_img_cache_match(src, entry->dec_dsc.src)) {
+            entry_drop(cache, entry);
         }
+        entry = next;
     }
 #endif
 }
 
+/**
+ * Keep the images of a source in the cache. E.g. the images which are always on the screen.
+ * Pinned images are not dropped even if the cache exceeds its limits, only `lv_img_cache_invalidate_src()` removes them.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ */
+void lv_img_cache_pin(const void * src)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    _lv_img_cache_t * cache = get_cache();
+    if(cache == NULL || is_pinned(cache, src)) return;
+
+    const void ** pin = _lv_ll_ins_tail(&cache->pin_ll);
+    LV_ASSERT_MALLOC(pin);
+    if(pin == NULL) return;
+
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        size_t len = strlen(src) + 1;
+        char * path = lv_mem_alloc(len);
+        LV_ASSERT_MALLOC(path);
+        if(path == NULL) {
+            _lv_ll_remove(&cache->pin_ll, pin);
+            lv_mem_free(pin);
+            return;
+        }
+        lv_memcpy(path, src, len);
+        *pin = path;
+    }
+    else {
+        *pin = src;
+    }
+
+    _lv_img_cache_entry_t * entry;
+    for(entry = cache->head; entry; entry = entry->next) {
+        if(lv_img_cache_match(src, entry->dec_dsc.src)) entry->pinned = 1;
+    }
+#else
+    LV_UNUSED(src);
+#endif
+}
+
+/**
+ * Let the images of a pinned source to be dropped from the cache again.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ */
+void lv_img_cache_unpin(const void * src)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache == NULL) return;
+
+    const void ** pin;
+    _LV_LL_READ(&cache->pin_ll, pin) {
+        if(lv_img_cache_match(src, *pin)) {
+            if(lv_img_src_get_type(*pin) == LV_IMG_SRC_FILE) lv_mem_free((void *)*pin);
+            _lv_ll_remove(&cache->pin_ll, pin);
+            lv_mem_free(pin);
+            break;
+        }
+    }
+
+    _lv_img_cache_entry_t * entry;
+    for(entry = cache->head; entry; entry = entry->next) {
+        if(lv_img_cache_match(src, entry->dec_dsc.src)) entry->pinned = 0;
+    }
+
+    while(cache->entry_cnt > cache->max_entry_cnt || (cache->max_size && cache->size > cache->max_size)) {
+        if(!evict_one(cache)) break;
+    }
+#else
+    LV_UNUSED(src);
+#endif
+}
+
+/**
+ * Get the usage and the hit/miss/evict counters of the image cache.
+ * @param stats store the statistics here. All fields are 0 if the cache is disabled.
+ */
+void lv_img_cache_get_stats(lv_img_cache_stats_t * stats)
+{
+    lv_memset_00(stats, sizeof(lv_img_cache_stats_t));
+#if LV_IMG_CACHE_DEF_SIZE
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache == NULL) return;
+
+    stats->entry_cnt = cache->entry_cnt;
+    stats->max_entry_cnt = cache->max_entry_cnt;
+    stats->size = cache->size;
+    stats->max_size = cache->max_size;
+    stats->hit_cnt = cache->hit_cnt;
+    stats->miss_cnt = cache->miss_cnt;
+    stats->evict_cnt = cache->evict_cnt;
+#endif
+}
+
+/**
+ * Reset the hit, miss and evict counters of the image cache.
+ */
+void lv_img_cache_reset_stats(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache == NULL) return;
+
+    cache->hit_cnt = 0;
+    cache->miss_cnt = 0;
+    cache->evict_cnt = 0;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Open an image with the decoders and convert it if needed.
+ * It can be called from the background decoding worker too, so it must not change the cache.
+ * @param entry pointer to a zeroed entry
+ * @param src source of the image
+ * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame
+ * @return LV_RES_OK: the image is opened; LV_RES_INV: it couldn't be opened
+ */
+static lv_res_t entry_open(_lv_img_cache_entry_t * entry, const void * src, lv_color_t color, int32_t frame_id)
+{
+    /*Open the image and measure the time to open*/
+    uint32_t t_start  = lv_tick_get();
+    lv_res_t open_res = lv_img_decoder_open(&entry->dec_dsc, src, color, frame_id);
+    if(open_res == LV_RES_INV) return LV_RES_INV;
+
+    /*If `time_to_open` was not set in the open function set it here*/
+    if(entry->dec_dsc.time_to_open == 0) {
+        entry->dec_dsc.time_to_open = lv_tick_elaps(t_start);
+    }
+
+    if(entry->dec_dsc.time_to_open == 0) entry->dec_dsc.time_to_open = 1;
+
+#if LV_IMG_CACHE_DEF_SIZE && LV_IMG_CACHE_CONVERT
+    if(convert_needed(&entry->dec_dsc)) {
+        lv_img_cf_t cf;
+        if(convert_img(&entry->dec_dsc, color, LV_OPA_TRANSP, &entry->dec_dsc.img_data, &cf)) {
+            entry->dec_dsc.header.cf = cf;
+            entry->converted = 1;
+        }
+    }
+#else
+    LV_UNUSED(color);
+#endif
+
+    return LV_RES_OK;
+}
+
 #if LV_IMG_CACHE_DEF_SIZE
+
+static _lv_img_cache_t * get_cache(void)
+{
+    _lv_img_cache_t * cache = LV_GC_ROOT(_lv_img_cache);
+    if(cache) return cache;
+
+    cache = lv_mem_alloc(sizeof(_lv_img_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache == NULL) return NULL;
+
+    lv_memset_00(cache, sizeof(_lv_img_cache_t));
+    _lv_ll_init(&cache->pin_ll, sizeof(const void *));
+    cache->max_size = LV_IMG_CACHE_DEF_MEM_SIZE;
+    LV_GC_ROOT(_lv_img_cache) = cache;
+    return cache;
+}
+
 static bool lv_img_cache_match(const void * src1, const void * src2)
 {
     lv_img_src_t src_type = lv_img_src_get_type(src1);
@@ -212,4 +963,755 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+/**
+ * Hash an image source: the path of files (FNV-1a) or the address of variables
+ * @param src an image source
+ * @return the hash
+ */
+static uint32_t src_hash(const void * src)
+{
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        const uint8_t * s = src;
+        uint32_t hash = 2166136261U;
+        while(*s) {
+            hash ^= *s;
+            hash *= 16777619U;
+            s++;
+        }
+        return hash;
+    }
+
+    lv_uintptr_t p = (lv_uintptr_t)src;
+    uint32_t hash = (uint32_t)(p >> 3) ^ (uint32_t)(p >> 15);
+    return hash * 2654435761U;
+}
+
+/**
+ * Get the memory used by an entry.
+ * Variables with plain pixels are used in place so only the decoded images are counted.
+ * @param entry pointer to an opened entry
+ * @return size in bytes
+ */
+static uint32_t get_entry_size(const _lv_img_cache_entry_t * entry)
+{
+    uint32_t size = sizeof(_lv_img_cache_entry_t);
+    const lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+    if(dsc->img_data == NULL) return size;
+
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE && dsc->img_data == ((const lv_img_dsc_t *)dsc->src)->data) return size;
+
+    return size + lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+}
+
+static bool is_pinned(_lv_img_cache_t * cache, const void * src)
+{
+    const void ** pin;
+    _LV_LL_READ(&cache->pin_ll, pin) {
+        if(lv_img_cache_match(src, *pin)) return true;
+    }
+    return false;
+}
+
+static _lv_img_cache_entry_t * entry_find(_lv_img_cache_t * cache, const void * src, uint32_t hash, lv_color_t color,
+                                          lv_opa_t recolor_opa, int32_t frame_id)
+{
+    _lv_img_cache_entry_t * entry;
+    for(entry = cache->buckets[hash & (cache->bucket_cnt - 1)]; entry; entry = entry->bucket_next) {
+        if(entry->hash == hash &&
+           color.full == entry->dec_dsc.color.full &&
+           recolor_opa == entry->recolor_opa &&
+           frame_id == entry->dec_dsc.frame_id &&
+#if LV_IMG_CACHE_TRANSFORM
+           entry->zoom == 0 &&
+#endif
+           lv_img_cache_match(src, entry->dec_dsc.src)) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Make an entry live longer and move it to the front of the LRU list
+ * @param cache pointer to the cache
+ * @param entry pointer to an entry of the cache
+ */
+static void entry_use(_lv_img_cache_t * cache, _lv_img_cache_entry_t * entry)
+{
+    /*If opened increment its life.
+     *Image difficult to open should live longer to keep avoid frequent their recaching.
+     *Therefore increase `life` with `time_to_open`*/
+    int32_t life = (int32_t)((uint32_t)entry->life - cache->clock);
+    life += entry->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
+    if(life > LV_IMG_CACHE_LIFE_LIMIT) life = LV_IMG_CACHE_LIFE_LIMIT;
+    entry->life = (int32_t)(cache->clock + (uint32_t)life);
+
+    if(entry != cache->head) {
+        entry->prev->next = entry->next;
+        if(entry->next) entry->next->prev = entry->prev;
+        else cache->tail = entry->prev;
+
+        entry->prev = NULL;
+        entry->next = cache->head;
+        cache->head->prev = entry;
+        cache->head = entry;
+    }
+
+    cache->hit_cnt++;
+}
+
+/**
+ * Add a new entry to the cache and drop other entries if it doesn't fit
+ * @param cache pointer to the cache
+ * @param entry pointer to an opened entry with `hash` set
+ */
+static void entry_add(_lv_img_cache_t * cache, _lv_img_cache_entry_t * entry)
+{
+    if(entry->dec_dsc.time_to_open == 0) entry->dec_dsc.time_to_open = 1;
+    entry->life = (int32_t)cache->clock;
+    entry->size = get_entry_size(entry);
+    entry->pinned = is_pinned(cache, entry->dec_dsc.src);
+
+    /*Drop entries until the new one fits. Pinned entries are kept even if the limits are exceeded.*/
+    while(cache->entry_cnt + 1 > cache->max_entry_cnt ||
+          (cache->max_size && cache->size + entry->size > cache->max_size)) {
+        if(!evict_one(cache)) break;
+        LV_LOG_INFO("image draw: cache miss, drop an entry");
+    }
+
+    uint32_t bucket_id = entry->hash & (cache->bucket_cnt - 1);
+    entry->bucket_next = cache->buckets[bucket_id];
+    cache->buckets[bucket_id] = entry;
+
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if(cache->head) cache->head->prev = entry;
+    else cache->tail = entry;
+    cache->head = entry;
+
+    cache->entry_cnt++;
+    cache->size += entry->size;
+}
+
+/**
+ * Drop the entry with the least life from the least recently used not pinned entries
+ * @param cache pointer to the cache
+ * @return true: an entry was dropped; false: there is no entry to drop
+ */
+static bool evict_one(_lv_img_cache_t * cache)
+{
+    _lv_img_cache_entry_t * victim = NULL;
+    int32_t victim_life = 0;
+    uint32_t checked = 0;
+    _lv_img_cache_entry_t * entry;
+    for(entry = cache->tail; entry && checked < LV_IMG_CACHE_EVICT_WINDOW; entry = entry->prev) {
+        if(entry->pinned) continue;
+        int32_t life = (int32_t)((uint32_t)entry->life - cache->clock);
+        if(victim == NULL || life < victim_life) {
+            victim = entry;
+            victim_life = life;
+        }
+        checked++;
+    }
+
+    if(victim == NULL) return false;
+
+    entry_drop(cache, victim);
+    cache->evict_cnt++;
+    return true;
+}
+
+/**
+ * Remove an entry from the cache, close its image and free it
+ * @param cache pointer to the cache
+ * @param entry pointer to an entry of the cache
+ */
+static void entry_drop(_lv_img_cache_t * cache, _lv_img_cache_entry_t * entry)
+{
+    _lv_img_cache_entry_t ** link = &cache->buckets[entry->hash & (cache->bucket_cnt - 1)];
+    while(*link != entry) link = &(*link)->bucket_next;
+    *link = entry->bucket_next;
+
+    if(entry->prev) entry->prev->next = entry->next;
+    else cache->head = entry->next;
+    if(entry->next) entry->next->prev = entry->prev;
+    else cache->tail = entry->prev;
+
+    cache->entry_cnt--;
+    cache->size -= entry->size;
+
+    /*The decoder doesn't know about the converted image*/
+    if(entry->converted) {
+        lv_mem_free((void *)entry->dec_dsc.img_data);
+        entry->dec_dsc.img_data = NULL;
+    }
+
+    /*The variants are not opened by a decoder*/
+    if(entry->variant) {
+        if(entry->dec_dsc.src_type == LV_IMG_SRC_FILE) lv_mem_free((void *)entry->dec_dsc.src);
+    }
+    else {
+        lv_img_decoder_close(&entry->dec_dsc);
+    }
+    lv_mem_free(entry);
+}
+
+#if LV_IMG_CACHE_RECOLOR || LV_IMG_CACHE_TRANSFORM
+
+/**
+ * Set the source of a variant built from an other entry.
+ * The variant is not opened by a decoder so it needs its own copy of the path.
+ * @param variant pointer to the new variant
+ * @param base pointer to the entry the variant is built from
+ * @return true: success; false: out of memory
+ */
+static bool variant_src_set(_lv_img_cache_entry_t * variant, const _lv_img_cache_entry_t * base)
+{
+    if(base->dec_dsc.src_type == LV_IMG_SRC_FILE) {
+        size_t len = strlen(base->dec_dsc.src) + 1;
+        char * path = lv_mem_alloc(len);
+        LV_ASSERT_MALLOC(path);
+        if(path == NULL) return false;
+        lv_memcpy(path, base->dec_dsc.src, len);
+        variant->dec_dsc.src = path;
+    }
+    else {
+        variant->dec_dsc.src = base->dec_dsc.src;
+    }
+
+    variant->dec_dsc.src_type = base->dec_dsc.src_type;
+    return true;
+}
+
+#endif
+
+#if LV_IMG_CACHE_TRANSFORM
+
+/**
+ * Check if an entry has the same pixels as an other one before transformation
+ * @param entry pointer to an entry of the cache
+ * @param base pointer to an untransformed entry
+ * @return true: same source, color, recoloring and frame
+ */
+static bool same_image(const _lv_img_cache_entry_t * entry, const _lv_img_cache_entry_t * base)
+{
+    return entry->hash == base->hash &&
+           entry->dec_dsc.color.full == base->dec_dsc.color.full &&
+           entry->recolor_opa == base->recolor_opa &&
+           entry->dec_dsc.frame_id == base->dec_dsc.frame_id &&
+           lv_img_cache_match(base->dec_dsc.src, entry->dec_dsc.src);
+}
+
 #endif
+
+#if LV_IMG_CACHE_ASYNC
+
+static _lv_img_cache_job_t * job_find(_lv_img_cache_t * cache, const void * src, uint32_t hash, lv_color_t color,
+                                      int32_t frame_id)
+{
+    _lv_img_cache_job_t * job;
+    for(job = cache->jobs; job; job = job->next) {
+        if(job->task_cb == NULL &&
+           job->hash == hash &&
+           !job->canceled &&
+           color.full == job->color.full &&
+           frame_id == job->frame_id &&
+           lv_img_cache_match(src, job->src)) {
+            return job;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Add a decoding job to the end of the queue and wake up the worker
+ * @param cache pointer to the cache
+ * @param src source of the image
+ * @param hash hash of the source
+ * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame
+ * @return the new job or NULL on error
+ */
+static _lv_img_cache_job_t * job_add(_lv_img_cache_t * cache, const void * src, uint32_t hash, lv_color_t color,
+                                     int32_t frame_id)
+{
+    _lv_img_cache_job_t * job = lv_mem_alloc(sizeof(_lv_img_cache_job_t));
+    LV_ASSERT_MALLOC(job);
+    if(job == NULL) return NULL;
+    lv_memset_00(job, sizeof(_lv_img_cache_job_t));
+
+    job->entry = lv_mem_alloc(sizeof(_lv_img_cache_entry_t));
+    LV_ASSERT_MALLOC(job->entry);
+    if(job->entry == NULL) {
+        lv_mem_free(job);
+        return NULL;
+    }
+    lv_memset_00(job->entry, sizeof(_lv_img_cache_entry_t));
+
+    /*The worker might read the path after the caller has freed it*/
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        size_t len = strlen(src) + 1;
+        char * path = lv_mem_alloc(len);
+        LV_ASSERT_MALLOC(path);
+        if(path == NULL) {
+            lv_mem_free(job->entry);
+            lv_mem_free(job);
+            return NULL;
+        }
+        lv_memcpy(path, src, len);
+        job->src = path;
+    }
+    else {
+        job->src = src;
+    }
+
+    job->hash = hash;
+    job->color = color;
+    job->frame_id = frame_id;
+    job->state = JOB_QUEUED;
+
+    job_queue(cache, job);
+    cache->miss_cnt++;
+
+    return job;
+}
+
+/**
+ * Add a job to the end of the queue and wake up the worker
+ * @param cache pointer to the cache
+ * @param job pointer to a new job
+ */
+static void job_queue(_lv_img_cache_t * cache, _lv_img_cache_job_t * job)
+{
+    _lv_img_cache_job_t ** link = &cache->jobs;
+    while(*link) link = &(*link)->next;
+
+    cache->async_drv->lock_cb();
+    *link = job;
+    cache->async_drv->unlock_cb();
+
+    lv_timer_resume(cache->job_timer);
+    cache->async_drv->wake_cb();
+}
+
+static uint8_t job_get_state(_lv_img_cache_t * cache, _lv_img_cache_job_t * job)
+{
+    cache->async_drv->lock_cb();
+    uint8_t state = job->state;
+    cache->async_drv->unlock_cb();
+    return state;
+}
+
+/**
+ * Remember where the placeholder of a job was drawn
+ * @param job pointer to a job
+ * @param area the area of the image on the display being refreshed
+ */
+static void job_add_area(_lv_img_cache_job_t * job, const lv_area_t * area)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp == NULL || job->inv_all) return;
+
+    if(job->disp == NULL) {
+        job->disp = disp;
+        job->inv_area = *area;
+    }
+    else if(job->disp == disp) {
+        _lv_area_join(&job->inv_area, &job->inv_area, area);
+    }
+    else {
+        job->inv_all = 1;
+    }
+}
+
+/**
+ * Redraw the placeholders of a job
+ * @param job pointer to a job
+ */
+static void job_invalidate(_lv_img_cache_job_t * job)
+{
+    if(job->inv_all) {
+        lv_disp_t * disp;
+        for(disp = lv_disp_get_next(NULL); disp; disp = lv_disp_get_next(disp)) {
+            lv_obj_invalidate(lv_disp_get_scr_act(disp));
+        }
+    }
+    else if(job->disp) {
+        _lv_inv_area(job->disp, &job->inv_area);
+    }
+
+    job->disp = NULL;
+    job->inv_all = 0;
+}
+
+/**
+ * Free a job which is not in the list anymore and its entry if it wasn't added to the cache
+ * @param job pointer to a job
+ */
+static void job_free(_lv_img_cache_job_t * job)
+{
+    if(job->entry) {
+        if(job->state == JOB_READY) {
+            if(job->entry->converted) lv_mem_free((void *)job->entry->dec_dsc.img_data);
+            job->entry->dec_dsc.img_data = NULL;
+            lv_img_decoder_close(&job->entry->dec_dsc);
+        }
+        lv_mem_free(job->entry);
+    }
+
+    if(lv_img_src_get_type(job->src) == LV_IMG_SRC_FILE) lv_mem_free((void *)job->src);
+    lv_mem_free(job);
+}
+
+/**
+ * Cancel the jobs of a source. The running jobs are freed when they are finished. The tasks are not canceled.
+ * @param cache pointer to the cache
+ * @param src an image source or NULL to cancel all jobs
+ */
+static void job_cancel(_lv_img_cache_t * cache, const void * src)
+{
+    if(cache->jobs == NULL) return;
+
+    cache->async_drv->lock_cb();
+    _lv_img_cache_job_t * job;
+    for(job = cache->jobs; job; job = job->next) {
+        if(job->task_cb) continue;
+        if(src == NULL || lv_img_cache_match(src, job->src)) job->canceled = 1;
+    }
+    cache->async_drv->unlock_cb();
+
+    lv_timer_resume(cache->job_timer);
+}
+
+/**
+ * Add the decoded images to the cache and redraw their placeholders
+ * @param t pointer to the timer
+ */
+static void job_timer_cb(lv_timer_t * t)
+{
+    _lv_img_cache_t * cache = t->user_data;
+    bool busy = false;
+    uint32_t failed_cnt = 0;
+
+    _lv_img_cache_job_t ** link = &cache->jobs;
+    while(*link) {
+        _lv_img_cache_job_t * job = *link;
+        uint8_t state = job_get_state(cache, job);
+        if(state == JOB_RUNNING || (state == JOB_QUEUED && !job->canceled)) {
+            busy = true;
+            link = &job->next;
+            continue;
+        }
+
+        if(state == JOB_READY && !job->canceled && job->task_cb == NULL &&
+           entry_find(cache, job->src, job->hash, job->color, LV_OPA_TRANSP, job->frame_id) == NULL) {
+            job->entry->hash = job->hash;
+            entry_add(cache, job->entry);
+            job->entry = NULL;
+
+            if(job->has_dominant) {
+                _lv_img_cache_dominant_t * dominant = &cache->dominant[job->hash % LV_IMG_CACHE_DOMINANT_CNT];
+                dominant->hash = job->hash;
+                dominant->color = job->dominant;
+                dominant->valid = 1;
+            }
+        }
+
+        job_invalidate(job);
+
+        /*Keep the failed jobs to not try to decode them again and again*/
+        if(state == JOB_FAILED && !job->canceled) {
+            failed_cnt++;
+            link = &job->next;
+            continue;
+        }
+
+        cache->async_drv->lock_cb();
+        *link = job->next;
+        cache->async_drv->unlock_cb();
+        job_free(job);
+    }
+
+    /*Drop the oldest failed jobs if there are too many. Their images are decoded again if they are drawn.*/
+    link = &cache->jobs;
+    while(*link && failed_cnt > LV_IMG_CACHE_FAILED_JOB_CNT) {
+        _lv_img_cache_job_t * job = *link;
+        if(job_get_state(cache, job) != JOB_FAILED || job->canceled) {
+            link = &job->next;
+            continue;
+        }
+
+        cache->async_drv->lock_cb();
+        *link = job->next;
+        cache->async_drv->unlock_cb();
+        job_free(job);
+        failed_cnt--;
+    }
+
+    if(!busy) lv_timer_pause(t);
+}
+
+/**
+ * Get the average color of an image weighted by the opacity of the pixels
+ * @param dsc pointer to an opened decoder descriptor
+ * @param color store the color here
+ * @return true: the color is found; false: the pixels are not available or all are transparent
+ */
+static bool get_dominant_color(const lv_img_decoder_dsc_t * dsc, lv_color_t * color)
+{
+    const uint8_t * data = dsc->img_data;
+    lv_img_cf_t cf = dsc->header.cf;
+    uint32_t w = dsc->header.w;
+    uint32_t h = dsc->header.h;
+    if(data == NULL || w == 0 || h == 0) return false;
+
+    /*The external decoders return the pixels in the true color formats*/
+    if(cf == LV_IMG_CF_RAW) cf = LV_IMG_CF_TRUE_COLOR;
+    else if(cf == LV_IMG_CF_RAW_ALPHA) cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    else if(cf == LV_IMG_CF_RAW_CHROMA_KEYED) cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+
+    /*Check about 16x16 pixels*/
+    uint32_t step_x = w / 16 + 1;
+    uint32_t step_y = h / 16 + 1;
+    uint32_t r = 0;
+    uint32_t g = 0;
+    uint32_t b = 0;
+    uint32_t a_sum = 0;
+    uint32_t x;
+    uint32_t y;
+    for(y = step_y / 2; y < h; y += step_y) {
+        for(x = step_x / 2; x < w; x += step_x) {
+            uint32_t i = y * w + x;
+            lv_color_t c;
+            lv_opa_t a;
+            switch(cf) {
+                case LV_IMG_CF_TRUE_COLOR:
+                    c = ((const lv_color_t *)data)[i];
+                    a = LV_OPA_COVER;
+                    break;
+                case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+                    c = ((const lv_color_t *)data)[i];
+                    a = c.full == LV_COLOR_CHROMA_KEY.full ? LV_OPA_TRANSP : LV_OPA_COVER;
+                    break;
+                case LV_IMG_CF_TRUE_COLOR_ALPHA:
+                    lv_memcpy_small(&c, &data[i * LV_IMG_PX_SIZE_ALPHA_BYTE], sizeof(lv_color_t));
+                    a = data[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+                    break;
+#if LV_COLOR_DEPTH == 16
+                case LV_IMG_CF_RGB565A8:
+                    c = ((const lv_color_t *)data)[i];
+                    a = data[w * h * sizeof(lv_color_t) + i];
+                    break;
+#endif
+                default:
+                    return false;
+            }
+
+            lv_color32_t c32;
+            c32.full = lv_color_to32(c);
+            r += c32.ch.red * a;
+            g += c32.ch.green * a;
+            b += c32.ch.blue * a;
+            a_sum += a;
+        }
+    }
+
+    if(a_sum == 0) return false;
+
+    *color = lv_color_make(r / a_sum, g / a_sum, b / a_sum);
+    return true;
+}
+
+#endif
+
+#if LV_IMG_CACHE_CONVERT
+
+/**
+ * Check if an opened image is drawn pixel by pixel and should be converted.
+ * The images allocated by the decoders are kept as they are to not store them twice.
+ * @param dsc pointer to an opened decoder descriptor
+ * @return true: convert the image
+ */
+static bool convert_needed(const lv_img_decoder_dsc_t * dsc)
+{
+    if(dsc->error_msg || dsc->header.w == 0 || dsc->header.h == 0) return false;
+
+    if(dsc->img_data) {
+        if(dsc->src_type != LV_IMG_SRC_VARIABLE) return false;
+        if(dsc->img_data != ((const lv_img_dsc_t *)dsc->src)->data) return false;
+    }
+
+    switch(dsc->header.cf) {
+        case LV_IMG_CF_INDEXED_1BIT:
+        case LV_IMG_CF_INDEXED_2BIT:
+        case LV_IMG_CF_INDEXED_4BIT:
+        case LV_IMG_CF_INDEXED_8BIT:
+        case LV_IMG_CF_ALPHA_1BIT:
+        case LV_IMG_CF_ALPHA_2BIT:
+        case LV_IMG_CF_ALPHA_4BIT:
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+            return true;
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:
+            /*With other color depths it's the native format already*/
+            return LV_COLOR_DEPTH == 16;
+        default:
+            return false;
+    }
+}
+
+#endif /*LV_IMG_CACHE_CONVERT*/
+
+#if LV_IMG_CACHE_CONVERT || LV_IMG_CACHE_RECOLOR
+
+/**
+ * Convert an opened image to `LV_IMG_CF_TRUE_COLOR` if it's opaque or to `LV_IMG_CACHE_CONVERT_CF` and recolor it.
+ * The colors are copied as `lv_color_t` so they are already swapped if `LV_COLOR_16_SWAP` is enabled.
+ * @param dsc pointer to an opened decoder descriptor
+ * @param recolor mix this color to the pixels
+ * @param recolor_opa opacity of the recoloring. `LV_OPA_TRANSP`: keep the colors
+ * @param img_data store the converted image here. It should be freed with `lv_mem_free`.
+ * @param cf store the color format of the converted image here
+ * @return true: the image is converted; false: the color format is not supported or out of memory
+ */
+static bool convert_img(lv_img_decoder_dsc_t * dsc, lv_color_t recolor, lv_opa_t recolor_opa,
+                        const uint8_t ** img_data, lv_img_cf_t * cf)
+{
+    lv_coord_t w = dsc->header.w;
+    lv_coord_t h = dsc->header.h;
+    uint32_t px_cnt = (uint32_t)w * h;
+    if(px_cnt == 0) return false;
+
+    /*The decoder gives the lines in the true color formats*/
+    lv_img_cf_t src_cf = dsc->header.cf;
+    uint32_t src_px_size;
+    switch(src_cf) {
+        case LV_IMG_CF_TRUE_COLOR:
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+            src_px_size = sizeof(lv_color_t);
+            break;
+        case LV_IMG_CF_RGB565A8:
+            /*Planar so only the whole image can be used*/
+            if(dsc->img_data == NULL) return false;
+            src_px_size = sizeof(lv_color_t);
+            break;
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:
+            src_px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+            break;
+        case LV_IMG_CF_INDEXED_1BIT:
+        case LV_IMG_CF_INDEXED_2BIT:
+        case LV_IMG_CF_INDEXED_4BIT:
+        case LV_IMG_CF_INDEXED_8BIT:
+        case LV_IMG_CF_ALPHA_1BIT:
+        case LV_IMG_CF_ALPHA_2BIT:
+        case LV_IMG_CF_ALPHA_4BIT:
+            if(dsc->img_data) return false;
+            src_cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+            src_px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+            break;
+        default:
+            return false;
+    }
+
+    uint8_t * buf = lv_mem_alloc(lv_img_buf_get_img_size(w, h, LV_IMG_CACHE_CONVERT_CF));
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return false;
+
+    /*It can run on the background decoding worker, so don't take the temporary buffers of the LVGL thread*/
+    uint8_t * line_buf = NULL;
+    if(dsc->img_data == NULL) {
+        line_buf = lv_mem_alloc(w * src_px_size);
+        LV_ASSERT_MALLOC(line_buf);
+        if(line_buf == NULL) {
+            lv_mem_free(buf);
+            return false;
+        }
+    }
+
+    /*Mix the colors the same way as the drawing does*/
+    uint16_t premult_v[3];
+    lv_color_premult(recolor, recolor_opa, premult_v);
+    lv_opa_t recolor_opa_inv = 255 - recolor_opa;
+
+    lv_color_t chroma_key = LV_COLOR_CHROMA_KEY;
+    lv_opa_t opa_and = LV_OPA_COVER;
+#if LV_COLOR_DEPTH == 16
+    lv_color_t * color_p = (lv_color_t *)buf;
+    lv_opa_t * opa_p = buf + px_cnt * sizeof(lv_color_t);
+#else
+    uint8_t * px_p = buf;
+#endif
+
+    lv_coord_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * src_p;
+        if(line_buf) {
+            if(lv_img_decoder_read_line(dsc, 0, y, w, line_buf) != LV_RES_OK) {
+                LV_LOG_WARN("Image cache can't read the line to convert");
+                lv_mem_free(line_buf);
+                lv_mem_free(buf);
+                return false;
+            }
+            src_p = line_buf;
+        }
+        else {
+            src_p = dsc->img_data + (uint32_t)y * w * src_px_size;
+        }
+
+        const lv_opa_t * src_opa_p = NULL;
+        if(src_cf == LV_IMG_CF_RGB565A8) src_opa_p = dsc->img_data + px_cnt * sizeof(lv_color_t) + (uint32_t)y * w;
+
+        lv_coord_t x;
+        for(x = 0; x < w; x++) {
+            lv_color_t c;
+            lv_opa_t opa;
+            lv_memcpy_small(&c, src_p, sizeof(lv_color_t));
+            if(src_cf == LV_IMG_CF_TRUE_COLOR_ALPHA) opa = src_p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            else if(src_cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) opa = c.full == chroma_key.full ? LV_OPA_TRANSP : LV_OPA_COVER;
+            else if(src_opa_p) opa = src_opa_p[x];
+            else opa = LV_OPA_COVER;
+            opa_and &= opa;
+            src_p += src_px_size;
+
+            if(recolor_opa != LV_OPA_TRANSP) c = lv_color_mix_premult(premult_v, c, recolor_opa_inv);
+
+#if LV_COLOR_DEPTH == 16
+            *color_p = c;
+            *opa_p = opa;
+            color_p++;
+            opa_p++;
+#else
+            lv_memcpy_small(px_p, &c, sizeof(lv_color_t));
+            px_p[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = opa;
+            px_p += LV_IMG_PX_SIZE_ALPHA_BYTE;
+#endif
+        }
+    }
+
+    if(line_buf) lv_mem_free(line_buf);
+
+    *cf = LV_IMG_CACHE_CONVERT_CF;
+    if(opa_and == LV_OPA_COVER) {
+        /*Opaque: keep only the colors*/
+#if LV_COLOR_DEPTH != 16
+        if(LV_IMG_PX_SIZE_ALPHA_BYTE != sizeof(lv_color_t)) {
+            uint32_t i;
+            for(i = 1; i < px_cnt; i++) {
+                lv_memcpy_small(buf + i * sizeof(lv_color_t), buf + i * LV_IMG_PX_SIZE_ALPHA_BYTE, sizeof(lv_color_t));
+            }
+        }
+#endif
+        uint8_t * buf_shrunk = lv_mem_realloc(buf, px_cnt * sizeof(lv_color_t));
+        if(buf_shrunk) buf = buf_shrunk;
+        *cf = LV_IMG_CF_TRUE_COLOR;
+    }
+
+    *img_data = buf;
+    return true;
+}
+
+#endif /*LV_IMG_CACHE_CONVERT || LV_IMG_CACHE_RECOLOR*/
+
+#endif /*LV_IMG_CACHE_DEF_SIZE*/
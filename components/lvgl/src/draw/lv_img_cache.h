@@ -28,15 +28,77 @@ extern "C" {
  *
  * To avoid repeating this heavy load images can be cached.
  */
-typedef struct {
+typedef struct _lv_img_cache_entry_t {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
 
     /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused*/
+     * All lifes are decremented by one in every ::lv_img_cache_open.
+     * (With caching it's stored relative to the cache's clock so aging doesn't touch the entries.)
+     * The entry with the least life is reused first*/
     int32_t life;
+
+#if LV_IMG_CACHE_DEF_SIZE
+    struct _lv_img_cache_entry_t * bucket_next; /**< Next entry in the same hash bucket*/
+    struct _lv_img_cache_entry_t * prev;        /**< The more recently used neighbor*/
+    struct _lv_img_cache_entry_t * next;        /**< The less recently used neighbor*/
+    uint32_t hash;                              /**< Hash of the source*/
+    uint32_t size;                              /**< Memory used by the entry and its decoded image*/
+    uint8_t pinned : 1;                         /**< 1: don't drop it to make room for other images*/
+    uint8_t converted : 1;                      /**< 1: `dec_dsc.img_data` is a converted copy owned by the cache*/
+    uint8_t variant : 1;                        /**< 1: built from another entry, not opened by a decoder*/
+    lv_opa_t recolor_opa;                       /**< >0: a recolored variant of the image*/
+#if LV_IMG_CACHE_TRANSFORM
+    uint8_t antialias : 1;                      /**< Antialiasing of the transformed variant*/
+    uint8_t transform_requested : 1;            /**< 1: `transform_key` is set*/
+    uint32_t transform_key;                     /**< Hash of the last transformation requested for the image*/
+    uint16_t zoom;                              /**< >0: a transformed variant of the image with this zoom*/
+    int16_t angle;                              /**< Rotation of the transformed variant*/
+    lv_point_t pivot;                           /**< Pivot of the transformed variant*/
+    lv_point_t ofs;                             /**< Position of the transformed variant relative to the image*/
+#endif
+#endif
 } _lv_img_cache_entry_t;
 
+struct _lv_draw_ctx_t;
+
+/** The image cache. Hash table of the sources and a list of the entries in LRU order*/
+typedef struct _lv_img_cache_t _lv_img_cache_t;
+
+/** Usage and statistics of the image cache*/
+typedef struct {
+    uint32_t entry_cnt;         /**< Number of cached images*/
+    uint32_t max_entry_cnt;     /**< Maximal number of cached images*/
+    uint32_t size;              /**< Memory used by the cache in bytes*/
+    uint32_t max_size;          /**< Memory limit of the cache in bytes. 0: no limit*/
+    uint32_t hit_cnt;           /**< Number of images found in the cache*/
+    uint32_t miss_cnt;          /**< Number of images opened*/
+    uint32_t evict_cnt;         /**< Number of images dropped to make room for others*/
+} lv_img_cache_stats_t;
+
+/**
+ * Connect the image cache to a worker thread to decode the images in the background.
+ * The worker should wait until `wake_cb` is called and then call `lv_img_cache_async_work()` until it returns `false`.
+ * The image decoders and the file system drivers are called from the worker while the LVGL thread uses them too,
+ * so they need to be thread-safe: keep the state in the opened image/file or protect it with `_lv_img_cache_async_lock()`,
+ * and use `lv_mem_alloc()` instead of `lv_mem_buf_get()` as the temporary buffers belong to the LVGL thread.
+ */
+typedef struct {
+    /** Lock a recursive mutex. It protects the decoding jobs and (with the built-in allocator) `lv_mem_...()`.*/
+    void (*lock_cb)(void);
+
+    /** Unlock the mutex*/
+    void (*unlock_cb)(void);
+
+    /** Let the worker know that there are new jobs. Called from the LVGL thread.*/
+    void (*wake_cb)(void);
+
+    /** Color of the images which are being decoded if their dominant color is unknown yet*/
+    lv_color_t placeholder_color;
+
+    /** Opacity of the placeholder. 0: don't draw anything while an image is being decoded*/
+    lv_opa_t placeholder_opa;
+} lv_img_cache_async_drv_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -52,6 +114,100 @@ typedef struct {
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id);
 
+/**
+ * Open an image with recoloring already applied on its pixels and cache it.
+ * The recolored variants are built from the cached image once and cached beside it (requires `LV_IMG_CACHE_RECOLOR`).
+ * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param recolor the color to mix to the pixels. It's also the color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param recolor_opa the opacity of the recoloring
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @return pointer to the cache entry or NULL if can open the image.
+ *         If `recolor_opa` of the entry is 0 the recoloring is not applied yet and it should be applied when drawing.
+ */
+_lv_img_cache_entry_t * _lv_img_cache_open_recolor(const void * src, lv_color_t recolor, lv_opa_t recolor_opa,
+                                                   int32_t frame_id);
+
+/**
+ * Open the zoomed and/or rotated variant of a cached image and cache it (requires `LV_IMG_CACHE_TRANSFORM`).
+ * The variant is transformed once with the draw context and can be drawn without transformation at `ofs`.
+ * Only one transformed variant is kept per image, so a changing angle or zoom doesn't fill the cache.
+ * @param draw_ctx the draw context to transform the image with
+ * @param base an entry returned by `_lv_img_cache_open()` or `_lv_img_cache_open_recolor()` with `img_data`
+ * @param cf the color format to read `img_data` as (`LV_IMG_CF_TRUE_COLOR/_ALPHA/_CHROMA_KEYED` or `LV_IMG_CF_RGB565A8`)
+ * @param angle rotation angle in 0.1 degree
+ * @param zoom zoom factor, 256: no zoom
+ * @param pivot the pivot of the rotation and zoom
+ * @param antialias true: transform with antialiasing
+ * @return pointer to the cache entry or NULL if the image can't be transformed in advance.
+ *         `base` may be dropped from the cache when a new variant is created.
+ */
+_lv_img_cache_entry_t * _lv_img_cache_open_transformed(struct _lv_draw_ctx_t * draw_ctx, _lv_img_cache_entry_t * base,
+                                                       lv_img_cf_t cf, int16_t angle, uint16_t zoom,
+                                                       const lv_point_t * pivot, bool antialias);
+
+/**
+ * Check if an image is being decoded in the background (requires `LV_IMG_CACHE_ASYNC`).
+ * If a file or an image of an external decoder (e.g. PNG or JPG) is not cached a decoding job is started for it.
+ * The area is invalidated when the image is ready.
+ * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @param area the area of the image on the display being refreshed
+ * @param placeholder_color store the color to draw instead of the image here
+ * @param placeholder_opa store the opacity of the placeholder here
+ * @return true: the image is not ready, draw the placeholder; false: open the image normally
+ */
+bool _lv_img_cache_decode_async(const void * src, lv_color_t color, int32_t frame_id, const lv_area_t * area,
+                                lv_color_t * placeholder_color, lv_opa_t * placeholder_opa);
+
+/**
+ * Initialize a background decoding driver with default values.
+ * @param drv pointer to a driver to initialize
+ */
+void lv_img_cache_async_drv_init(lv_img_cache_async_drv_t * drv);
+
+/**
+ * Start decoding the images in the background.
+ * The lock is used for the memory management too, so register the driver before the worker is started.
+ * @param drv pointer to an initialized driver. Only its pointer is saved so it should be static or global.
+ */
+void lv_img_cache_async_drv_register(lv_img_cache_async_drv_t * drv);
+
+/**
+ * Decode the next image waiting for background decoding. Call it from the worker thread.
+ * @return true: an image was decoded (or failed to decode); false: there was nothing to do
+ */
+bool lv_img_cache_async_work(void);
+
+/**
+ * Run a function on the background decoding worker, e.g. to decode the next part of an image drawn line by line.
+ * The function is called even if the image cache is invalidated meanwhile, so it can free the data of its owner.
+ * @param cb the function to call
+ * @param user_data parameter of `cb`
+ * @return true: `cb` will be called; false: there is no background decoding driver
+ */
+bool _lv_img_cache_async_call(void (*cb)(void * user_data), void * user_data);
+
+/**
+ * Lock the data shared with the functions running on the worker.
+ * Does nothing without a background decoding driver.
+ */
+void _lv_img_cache_async_lock(void);
+
+/**
+ * Unlock the data shared with the functions running on the worker.
+ */
+void _lv_img_cache_async_unlock(void);
+
+/**
+ * Decode images before they are drawn, e.g. the images of the next screen.
+ * With a background decoding driver the images are decoded by the worker, else right away.
+ * The images are cached with the default `img_recolor` color (black).
+ * @param src_list array of image sources. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param src_cnt number of sources in `src_list`
+ */
+void lv_img_cache_prefetch(const void * const src_list[], uint32_t src_cnt);
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -60,6 +216,13 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
  */
 void lv_img_cache_set_size(uint16_t new_slot_num);
 
+/**
+ * Set the maximal memory used by the cached images.
+ * The entries and the decoded images (if the decoder allocated them) are counted.
+ * @param size the memory limit in bytes. 0: no limit, only the number of images is limited
+ */
+void lv_img_cache_set_mem_size(uint32_t size);
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
@@ -67,6 +230,30 @@ void lv_img_cache_set_size(uint16_t new_slot_num);
  */
 void lv_img_cache_invalidate_src(const void * src);
 
+/**
+ * Keep the images of a source in the cache. E.g. the images which are always on the screen.
+ * Pinned images are not dropped even if the cache exceeds its limits, only `lv_img_cache_invalidate_src()` removes them.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ */
+void lv_img_cache_pin(const void * src);
+
+/**
+ * Let the images of a pinned source to be dropped from the cache again.
+ * @param src an image source path to a file or pointer to an `lv_img_dsc_t` variable.
+ */
+void lv_img_cache_unpin(const void * src);
+
+/**
+ * Get the usage and the hit/miss/evict counters of the image cache.
+ * @param stats store the statistics here. All fields are 0 if the cache is disabled.
+ */
+void lv_img_cache_get_stats(lv_img_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss and evict counters of the image cache.
+ */
+void lv_img_cache_reset_stats(void);
+
 /**********************
  *      MACROS
  **********************/
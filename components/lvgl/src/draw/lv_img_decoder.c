@@ -26,6 +26,7 @@ typedef struct {
     lv_fs_file_t f;
     lv_color_t * palette;
     lv_opa_t * opa;
+    uint8_t * fs_buf;   /*A line read from the file. Not from `lv_mem_buf_get` as it can run on the worker too*/
 } lv_img_decoder_built_in_data_t;
 
 /**********************
@@ -37,6 +38,7 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
                                                    lv_coord_t len, uint8_t * buf);
 static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
                                                      lv_coord_t len, uint8_t * buf);
+static uint8_t * get_fs_buf(lv_img_decoder_built_in_data_t * user_data, uint32_t size);
 
 /**********************
  *  STATIC VARIABLES
@@ -499,6 +501,7 @@ void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_ds
         }
         if(user_data->palette) lv_mem_free(user_data->palette);
         if(user_data->opa) lv_mem_free(user_data->opa);
+        if(user_data->fs_buf) lv_mem_free(user_data->fs_buf);
 
         lv_mem_free(user_data);
         dsc->user_data = NULL;
@@ -594,8 +597,6 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
     }
 
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
-    uint8_t * fs_buf = lv_mem_buf_get(w);
-    if(fs_buf == NULL) return LV_RES_INV;
 
     const uint8_t * data_tmp = NULL;
     if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
@@ -604,6 +605,8 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
         data_tmp = img_dsc->data + ofs;
     }
     else {
+        uint8_t * fs_buf = get_fs_buf(user_data, w);
+        if(fs_buf == NULL) return LV_RES_INV;
         lv_fs_seek(&user_data->f, ofs + 4, LV_FS_SEEK_SET); /*+4 to skip the header*/
         lv_fs_read(&user_data->f, fs_buf, w, NULL);
         data_tmp = fs_buf;
@@ -621,7 +624,6 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
             data_tmp++;
         }
     }
-    lv_mem_buf_release(fs_buf);
     return LV_RES_OK;
 }
 
@@ -663,14 +665,14 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
 
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
 
-    uint8_t * fs_buf = lv_mem_buf_get(w);
-    if(fs_buf == NULL) return LV_RES_INV;
     const uint8_t * data_tmp = NULL;
     if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
         const lv_img_dsc_t * img_dsc = dsc->src;
         data_tmp                     = img_dsc->data + ofs;
     }
     else {
+        uint8_t * fs_buf = get_fs_buf(user_data, w);
+        if(fs_buf == NULL) return LV_RES_INV;
         lv_fs_seek(&user_data->f, ofs + 4, LV_FS_SEEK_SET); /*+4 to skip the header*/
         lv_fs_read(&user_data->f, fs_buf, w, NULL);
         data_tmp = fs_buf;
@@ -700,6 +702,20 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
             data_tmp++;
         }
     }
-    lv_mem_buf_release(fs_buf);
     return LV_RES_OK;
 }
+
+/**
+ * Get the buffer to read a line of the file into. It's allocated on the first read and kept until the image is closed.
+ * @param user_data the data of the opened image
+ * @param size the size of a line in bytes. It's the same for every line of the image.
+ * @return the buffer or NULL if out of memory
+ */
+static uint8_t * get_fs_buf(lv_img_decoder_built_in_data_t * user_data, uint32_t size)
+{
+    if(user_data->fs_buf == NULL) {
+        user_data->fs_buf = lv_mem_alloc(size);
+        LV_ASSERT_MALLOC(user_data->fs_buf);
+    }
+    return user_data->fs_buf;
+}
@@ -48,6 +48,8 @@ void lv_draw_sw_init_ctx(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
     draw_sw_ctx->base_draw.draw_rect = lv_draw_sw_rect;
     draw_sw_ctx->base_draw.draw_bg = lv_draw_sw_bg;
     draw_sw_ctx->base_draw.draw_letter = lv_draw_sw_letter;
+    draw_sw_ctx->base_draw.draw_letter_run = lv_draw_sw_letter_run;
+    draw_sw_ctx->base_draw.letter_run_to_a8 = lv_draw_sw_letter_run_to_a8;
     draw_sw_ctx->base_draw.draw_img_decoded = lv_draw_sw_img_decoded;
     draw_sw_ctx->base_draw.draw_line = lv_draw_sw_line;
     draw_sw_ctx->base_draw.draw_polygon = lv_draw_sw_polygon;
@@ -60,6 +60,11 @@ void lv_draw_sw_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, c
 void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
                        uint32_t letter);
+void lv_draw_sw_letter_run(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                           const uint32_t * letters, const lv_coord_t * pos_x, uint32_t letter_cnt);
+void lv_draw_sw_letter_run_to_a8(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                                 const uint32_t * letters, const lv_coord_t * pos_x, uint32_t letter_cnt,
+                                 lv_opa_t * buf, const lv_area_t * buf_area);
 
 LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc,
                                                   const lv_area_t * coords, const uint8_t * src_buf, lv_img_cf_t cf);
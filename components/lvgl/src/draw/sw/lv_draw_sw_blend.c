@@ -23,6 +23,10 @@
  *  STATIC PROTOTYPES
  **********************/
 
+#if LV_DRAW_COMPLEX
+static void blend_spans(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+#endif
+
 static void fill_set_px(lv_color_t * dest_buf, const lv_area_t * blend_area, lv_coord_t dest_stride,
                         lv_color_t color, lv_opa_t opa, const lv_opa_t * mask, lv_coord_t mask_stide);
 
@@ -109,6 +113,15 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_basic(lv_draw_ctx_t * draw_ctx, cons
     else if(dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) mask = NULL;
     else mask = dsc->mask_buf;
 
+#if LV_DRAW_COMPLEX
+    /*Blend the spans of a mask line one by one to skip the transparent parts and avoid masking the covered parts*/
+    if(mask && dsc->mask_spans && dsc->mask_area->y1 == dsc->mask_area->y2 &&
+       dsc->blend_area->y1 == dsc->blend_area->y2) {
+        blend_spans(draw_ctx, dsc);
+        return;
+    }
+#endif
+
     lv_coord_t dest_stride = lv_area_get_width(draw_ctx->buf_area);
 
     lv_area_t blend_area;
@@ -204,6 +217,47 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_sw_blend_basic(lv_draw_ctx_t * draw_ctx, cons
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_DRAW_COMPLEX
+static void blend_spans(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    const lv_draw_mask_span_list_t * spans = dsc->mask_spans;
+
+    lv_draw_sw_blend_dsc_t span_dsc;
+    lv_memcpy_small(&span_dsc, dsc, sizeof(span_dsc));
+    span_dsc.mask_spans = NULL;
+
+    lv_area_t span_area;
+    span_area.y1 = dsc->blend_area->y1;
+    span_area.y2 = dsc->blend_area->y2;
+    span_dsc.blend_area = &span_area;
+
+    uint32_t i;
+    for(i = 0; i < spans->cnt; i++) {
+        const lv_draw_mask_span_t * span = &spans->spans[i];
+        if(span->type == LV_DRAW_MASK_SPAN_TRANSP) continue;
+
+        span_area.x1 = LV_MAX(dsc->mask_area->x1 + span->start, dsc->blend_area->x1);
+        span_area.x2 = LV_MIN(dsc->mask_area->x1 + span->start + span->len - 1, dsc->blend_area->x2);
+        if(span_area.x1 > span_area.x2) continue;
+
+        if(dsc->src_buf) span_dsc.src_buf = dsc->src_buf + (span_area.x1 - dsc->blend_area->x1);
+
+        if(span->type == LV_DRAW_MASK_SPAN_COVER) {
+            /*The masks haven't touched this span so it has the same initial value everywhere (typically 0xFF)*/
+            lv_opa_t mask_opa = dsc->mask_buf[span->start];
+            if(mask_opa <= LV_OPA_MIN) continue;
+            span_dsc.opa = mask_opa >= LV_OPA_MAX ? dsc->opa : (uint32_t)((uint32_t)mask_opa * dsc->opa) >> 8;
+            span_dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+        }
+        else {
+            span_dsc.opa = dsc->opa;
+            span_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        }
+        lv_draw_sw_blend_basic(draw_ctx, &span_dsc);
+    }
+}
+#endif
+
 static void fill_set_px(lv_color_t * dest_buf, const lv_area_t * blend_area, lv_coord_t dest_stride,
                         lv_color_t color, lv_opa_t opa, const lv_opa_t * mask, lv_coord_t mask_stide)
 {
@@ -34,6 +34,9 @@ typedef struct {
     lv_opa_t * mask_buf;            /**< NULL if ignored, or an alpha mask to apply on `blend_area`*/
     lv_draw_mask_res_t mask_res;    /**< The result of the previous mask operation */
     const lv_area_t * mask_area;    /**< The area of `mask_buf` with absolute coordinates*/
+    const lv_draw_mask_span_list_t * mask_spans; /**< NULL if ignored, or the spans of a 1 px high `mask_buf`.
+                                                   *   Covered spans are blended without mask,
+                                                   *   transparent spans are skipped*/
     lv_opa_t opa;                   /**< The overall opacity*/
     lv_blend_mode_t blend_mode;     /**< E.g. LV_BLEND_MODE_ADDITIVE*/
 } lv_draw_sw_blend_dsc_t;
@@ -18,6 +18,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define LETTER_RUN_BUF_SIZE 4096    /*Max. size of the coverage buffer of a letter run. Larger runs are drawn in bands*/
 
 /**********************
  *      TYPEDEFS
@@ -29,6 +30,9 @@
 
 LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                                      const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p);
+static const uint8_t * get_opa_table(uint32_t bpp, lv_opa_t opa);
+LV_ATTRIBUTE_FAST_MEM static void letter_to_run_buf(lv_opa_t * buf, const lv_area_t * buf_area, const lv_point_t * pos,
+                                                    const lv_font_glyph_dsc_t * g, const uint8_t * map_p, lv_opa_t opa);
 
 
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
@@ -158,64 +162,205 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
     }
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
-LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
-                                                     const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p)
+/**
+ * Draw letters with the same style in one step: the coverage of the letters is collected
+ * in one buffer and it's blended to the screen at once.
+ * Sub-pixel rendered, image font and missing letters are drawn with `lv_draw_sw_letter()`.
+ * @param draw_ctx      pointer to a draw context
+ * @param dsc           descriptor of the label (font, color, opacity, etc.)
+ * @param pos_y         y coordinate of the line of the letters
+ * @param letters       the letters to draw
+ * @param pos_x         x coordinate of each letter
+ * @param letter_cnt    number of letters
+ */
+void lv_draw_sw_letter_run(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                           const uint32_t * letters, const lv_coord_t * pos_x, uint32_t letter_cnt)
 {
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+    lv_coord_t glyph_y_base = pos_y + (dsc->font->line_height - dsc->font->base_line);
+
+    lv_font_glyph_dsc_t * glyphs = lv_mem_buf_get(letter_cnt * sizeof(lv_font_glyph_dsc_t));
+
+    /*Get the glyphs and the area to draw. Draw the special letters one by one*/
+    lv_area_t run_area;
+    run_area.x1 = LV_COORD_MAX;
+    run_area.y1 = LV_COORD_MAX;
+    run_area.x2 = LV_COORD_MIN;
+    run_area.y2 = LV_COORD_MIN;
+
+    uint32_t i;
+    for(i = 0; i < letter_cnt; i++) {
+        lv_font_glyph_dsc_t * g = &glyphs[i];
+        bool g_ret = lv_font_get_glyph_dsc(dsc->font, g, letters[i], '\0');
+        if(g_ret == false || g->resolved_font->subpx || (g->bpp != 1 && g->bpp != 2 && g->bpp != 3 &&
+                                                         g->bpp != 4 && g->bpp != 8)) {
+            lv_point_t pos = {pos_x[i], pos_y};
+            lv_draw_sw_letter(draw_ctx, dsc, &pos, letters[i]);
+            g->box_w = 0;
+            continue;
+        }
 
-    const uint8_t * bpp_opa_table_p;
-    uint32_t bitmask_init;
-    uint32_t bitmask;
-    uint32_t bpp = g->bpp;
-    lv_opa_t opa = dsc->opa;
-    uint32_t shades;
-    if(bpp == 3) bpp = 4;
+        /*Don't draw anything if the character is empty (e.g. space) or it's out of the clip area*/
+        if(g->box_w == 0 || g->box_h == 0) {
+            g->box_w = 0;
+            continue;
+        }
 
-#if LV_USE_IMGFONT
-    if(bpp == LV_IMGFONT_BPP) { //is imgfont
-        lv_area_t fill_area;
-        fill_area.x1 = pos->x;
-        fill_area.y1 = pos->y;
-        fill_area.x2 = pos->x + g->box_w - 1;
-        fill_area.y2 = pos->y + g->box_h - 1;
-        lv_draw_img_dsc_t img_dsc;
-        lv_draw_img_dsc_init(&img_dsc);
-        img_dsc.angle = 0;
-        img_dsc.zoom = LV_IMG_ZOOM_NONE;
-        img_dsc.opa = dsc->opa;
-        img_dsc.blend_mode = dsc->blend_mode;
-        lv_draw_img(draw_ctx, &img_dsc, &fill_area, map_p);
+        lv_coord_t x = pos_x[i] + g->ofs_x;
+        lv_coord_t y = glyph_y_base - g->box_h - g->ofs_y;
+        if(x + g->box_w < clip_area->x1 || x > clip_area->x2 || y + g->box_h < clip_area->y1 || y > clip_area->y2) {
+            g->box_w = 0;
+            continue;
+        }
+
+        run_area.x1 = LV_MIN(run_area.x1, x);
+        run_area.y1 = LV_MIN(run_area.y1, y);
+        run_area.x2 = LV_MAX(run_area.x2, x + g->box_w - 1);
+        run_area.y2 = LV_MAX(run_area.y2, y + g->box_h - 1);
+    }
+
+    if(!_lv_area_intersect(&run_area, &run_area, clip_area)) {
+        lv_mem_buf_release(glyphs);
         return;
     }
+
+    /*Draw the run in bands which fit into the buffer*/
+    lv_coord_t run_w = lv_area_get_width(&run_area);
+    lv_coord_t band_h = LV_MAX(LETTER_RUN_BUF_SIZE / run_w, 1);
+    band_h = LV_MIN(band_h, lv_area_get_height(&run_area));
+    lv_opa_t * buf = lv_mem_buf_get(run_w * band_h);
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+    blend_dsc.mask_buf = buf;
+
+#if LV_DRAW_COMPLEX
+    bool mask_any = lv_draw_mask_is_any(&run_area);
+#endif
+
+    lv_area_t band_area;
+    band_area.x1 = run_area.x1;
+    band_area.x2 = run_area.x2;
+    for(band_area.y1 = run_area.y1; band_area.y1 <= run_area.y2; band_area.y1 += band_h) {
+        band_area.y2 = LV_MIN(band_area.y1 + band_h - 1, run_area.y2);
+        lv_memset_00(buf, run_w * lv_area_get_height(&band_area));
+
+        for(i = 0; i < letter_cnt; i++) {
+            const lv_font_glyph_dsc_t * g = &glyphs[i];
+            if(g->box_w == 0) continue;
+
+            lv_point_t gpos;
+            gpos.x = pos_x[i] + g->ofs_x;
+            gpos.y = glyph_y_base - g->box_h - g->ofs_y;
+            if(gpos.y > band_area.y2 || gpos.y + g->box_h - 1 < band_area.y1) continue;
+
+            /*Get the bitmap just before using it as it might be overwritten by the next glyph (e.g. cached glyphs)*/
+            const uint8_t * map_p = lv_font_get_glyph_bitmap(g->resolved_font, letters[i]);
+            if(map_p == NULL) {
+                LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
+                continue;
+            }
+            letter_to_run_buf(buf, &band_area, &gpos, g, map_p, dsc->opa);
+        }
+
+#if LV_DRAW_COMPLEX
+        /*Apply masks if any*/
+        if(mask_any) {
+            lv_coord_t y;
+            lv_opa_t * buf_row = buf;
+            for(y = band_area.y1; y <= band_area.y2; y++) {
+                lv_draw_mask_res_t mask_res = lv_draw_mask_apply(buf_row, band_area.x1, y, run_w);
+                if(mask_res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(buf_row, run_w);
+                buf_row += run_w;
+            }
+        }
 #endif
 
+        blend_dsc.blend_area = &band_area;
+        blend_dsc.mask_area = &band_area;
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+    }
+
+    lv_mem_buf_release(buf);
+    lv_mem_buf_release(glyphs);
+}
+
+/**
+ * Render the coverage of letters into an A8 buffer instead of drawing them.
+ * Sub-pixel rendered, image font and missing letters are skipped.
+ * @param draw_ctx      pointer to a draw context
+ * @param dsc           descriptor of the label (font, opacity, etc.)
+ * @param pos_y         y coordinate of the line of the letters
+ * @param letters       the letters to render
+ * @param pos_x         x coordinate of each letter
+ * @param letter_cnt    number of letters
+ * @param buf           the A8 buffer. Its stride is the width of `buf_area`.
+ * @param buf_area      the area of the buffer. The letters are clipped to it.
+ */
+void lv_draw_sw_letter_run_to_a8(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, lv_coord_t pos_y,
+                                 const uint32_t * letters, const lv_coord_t * pos_x, uint32_t letter_cnt,
+                                 lv_opa_t * buf, const lv_area_t * buf_area)
+{
+    LV_UNUSED(draw_ctx);
+
+    lv_coord_t glyph_y_base = pos_y + (dsc->font->line_height - dsc->font->base_line);
+
+    uint32_t i;
+    for(i = 0; i < letter_cnt; i++) {
+        lv_font_glyph_dsc_t g;
+        bool g_ret = lv_font_get_glyph_dsc(dsc->font, &g, letters[i], '\0');
+        if(g_ret == false || g.resolved_font->subpx) continue;
+        if(g.bpp != 1 && g.bpp != 2 && g.bpp != 3 && g.bpp != 4 && g.bpp != 8) continue;
+        if(g.box_w == 0 || g.box_h == 0) continue;
+
+        lv_point_t gpos;
+        gpos.x = pos_x[i] + g.ofs_x;
+        gpos.y = glyph_y_base - g.box_h - g.ofs_y;
+
+        const uint8_t * map_p = lv_font_get_glyph_bitmap(g.resolved_font, letters[i]);
+        if(map_p == NULL) continue;
+
+        letter_to_run_buf(buf, buf_area, &gpos, &g, map_p, dsc->opa);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get a table to convert the pixels of a glyph to opacity
+ * @param bpp       bit-per-pixel of the glyph (1, 2, 4 or 8)
+ * @param opa       opacity of the letter
+ * @return          a table with 2^bpp items or NULL if `bpp` is invalid
+ */
+static const uint8_t * get_opa_table(uint32_t bpp, lv_opa_t opa)
+{
+    const uint8_t * bpp_opa_table_p;
+    uint32_t shades;
     switch(bpp) {
         case 1:
             bpp_opa_table_p = _lv_bpp1_opa_table;
-            bitmask_init  = 0x80;
             shades = 2;
             break;
         case 2:
             bpp_opa_table_p = _lv_bpp2_opa_table;
-            bitmask_init  = 0xC0;
             shades = 4;
             break;
         case 4:
             bpp_opa_table_p = _lv_bpp4_opa_table;
-            bitmask_init  = 0xF0;
             shades = 16;
             break;
         case 8:
             bpp_opa_table_p = _lv_bpp8_opa_table;
-            bitmask_init  = 0xFF;
             shades = 256;
             break;       /*No opa table, pixel value will be used directly*/
         default:
-            LV_LOG_WARN("lv_draw_letter: invalid bpp");
-            return; /*Invalid bpp. Can't render the letter*/
+            return NULL;
     }
 
     static lv_opa_t opa_table[256];
@@ -233,6 +378,106 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
         prev_bpp = bpp;
     }
 
+    return bpp_opa_table_p;
+}
+
+/**
+ * Add the coverage of a glyph to the buffer of a letter run
+ * @param buf       the buffer. Its stride is the width of `buf_area`
+ * @param buf_area  the area of the buffer (absolute coordinates)
+ * @param pos       left-top coordinate of the glyph's box
+ * @param g         the glyph
+ * @param map_p     bitmap of the glyph
+ * @param opa       opacity of the letter
+ */
+LV_ATTRIBUTE_FAST_MEM static void letter_to_run_buf(lv_opa_t * buf, const lv_area_t * buf_area, const lv_point_t * pos,
+                                                    const lv_font_glyph_dsc_t * g, const uint8_t * map_p, lv_opa_t opa)
+{
+    uint32_t bpp = g->bpp;
+    if(bpp == 3) bpp = 4;
+    const uint8_t * opa_table = get_opa_table(bpp, opa);
+
+    int32_t box_w = g->box_w;
+    int32_t col_start = LV_MAX(buf_area->x1 - pos->x, 0);
+    int32_t col_end = LV_MIN(buf_area->x2 - pos->x + 1, box_w);
+    int32_t row_start = LV_MAX(buf_area->y1 - pos->y, 0);
+    int32_t row_end = LV_MIN(buf_area->y2 - pos->y + 1, (int32_t)g->box_h);
+    if(col_start >= col_end || row_start >= row_end) return;
+
+    lv_coord_t buf_w = lv_area_get_width(buf_area);
+    lv_opa_t * buf_row = buf + (pos->y + row_start - buf_area->y1) * buf_w + (pos->x + col_start - buf_area->x1);
+
+    uint32_t bitmask_init = (0xFF << (8 - bpp)) & 0xFF;
+    uint32_t col_bit_max = 8 - bpp;
+    int32_t row;
+    for(row = row_start; row < row_end; row++) {
+        uint32_t bit_ofs = (row * box_w + col_start) * bpp;
+        const uint8_t * map_row = map_p + (bit_ofs >> 3);
+        uint32_t col_bit = bit_ofs & 0x7;
+        uint32_t bitmask = bitmask_init >> col_bit;
+        lv_opa_t * buf_px = buf_row;
+        int32_t col;
+        for(col = col_start; col < col_end; col++) {
+            uint32_t letter_px = bpp == 8 ? *map_row : (*map_row & bitmask) >> (col_bit_max - col_bit);
+            if(letter_px) {
+                lv_opa_t px_opa = opa_table[letter_px];
+                /*Combine the overlapping parts of the letters as they were drawn on each other*/
+                if(*buf_px == 0) *buf_px = px_opa;
+                else *buf_px = *buf_px + LV_UDIV255((255 - *buf_px) * px_opa);
+            }
+
+            /*Go to the next column*/
+            if(col_bit < col_bit_max) {
+                col_bit += bpp;
+                bitmask = bitmask >> bpp;
+            }
+            else {
+                col_bit = 0;
+                bitmask = bitmask_init;
+                map_row++;
+            }
+            buf_px++;
+        }
+
+        buf_row += buf_w;
+    }
+}
+
+LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                     const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p)
+{
+
+    const uint8_t * bpp_opa_table_p;
+    uint32_t bitmask_init;
+    uint32_t bitmask;
+    uint32_t bpp = g->bpp;
+    if(bpp == 3) bpp = 4;
+
+#if LV_USE_IMGFONT
+    if(bpp == LV_IMGFONT_BPP) { //is imgfont
+        lv_area_t fill_area;
+        fill_area.x1 = pos->x;
+        fill_area.y1 = pos->y;
+        fill_area.x2 = pos->x + g->box_w - 1;
+        fill_area.y2 = pos->y + g->box_h - 1;
+        lv_draw_img_dsc_t img_dsc;
+        lv_draw_img_dsc_init(&img_dsc);
+        img_dsc.angle = 0;
+        img_dsc.zoom = LV_IMG_ZOOM_NONE;
+        img_dsc.opa = dsc->opa;
+        img_dsc.blend_mode = dsc->blend_mode;
+        lv_draw_img(draw_ctx, &img_dsc, &fill_area, map_p);
+        return;
+    }
+#endif
+
+    bpp_opa_table_p = get_opa_table(bpp, dsc->opa);
+    if(bpp_opa_table_p == NULL) {
+        LV_LOG_WARN("lv_draw_letter: invalid bpp");
+        return; /*Invalid bpp. Can't render the letter*/
+    }
+    bitmask_init = (0xFF << (8 - bpp)) & 0xFF;
+
     int32_t col, row;
     int32_t box_w = g->box_w;
     int32_t box_h = g->box_h;
@@ -286,30 +531,47 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
 #if LV_DRAW_COMPLEX
         int32_t mask_p_start = mask_p;
 #endif
-        bitmask = bitmask_init >> col_bit;
-        for(col = col_start; col < col_end; col++) {
-            /*Load the pixel's opacity into the mask*/
-            letter_px = (*map_p & bitmask) >> (col_bit_max - col_bit);
-            if(letter_px) {
-                mask_buf[mask_p] = bpp_opa_table_p[letter_px];
+        if(bpp == 8) {
+            /*The pixels are byte aligned (e.g. glyphs from the glyph cache) so no need to unpack them*/
+            if(bpp_opa_table_p == _lv_bpp8_opa_table) {
+                lv_memcpy(mask_buf + mask_p, map_p, col_end - col_start);
+                map_p += col_end - col_start;
+                mask_p += col_end - col_start;
             }
             else {
-                mask_buf[mask_p] = 0;
+                for(col = col_start; col < col_end; col++) {
+                    mask_buf[mask_p] = bpp_opa_table_p[*map_p];
+                    map_p++;
+                    mask_p++;
+                }
             }
+        }
+        else {
+            bitmask = bitmask_init >> col_bit;
+            for(col = col_start; col < col_end; col++) {
+                /*Load the pixel's opacity into the mask*/
+                letter_px = (*map_p & bitmask) >> (col_bit_max - col_bit);
+                if(letter_px) {
+                    mask_buf[mask_p] = bpp_opa_table_p[letter_px];
+                }
+                else {
+                    mask_buf[mask_p] = 0;
+                }
 
-            /*Go to the next column*/
-            if(col_bit < col_bit_max) {
-                col_bit += bpp;
-                bitmask = bitmask >> bpp;
-            }
-            else {
-                col_bit = 0;
-                bitmask = bitmask_init;
-                map_p++;
-            }
+                /*Go to the next column*/
+                if(col_bit < col_bit_max) {
+                    col_bit += bpp;
+                    bitmask = bitmask >> bpp;
+                }
+                else {
+                    col_bit = 0;
+                    bitmask = bitmask_init;
+                    map_p++;
+                }
 
-            /*Next mask byte*/
-            mask_p++;
+                /*Next mask byte*/
+                mask_p++;
+            }
         }
 
 #if LV_DRAW_COMPLEX
@@ -11,6 +11,7 @@
 #include "../../misc/lv_txt_ap.h"
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_assert.h"
+#include "../../misc/lv_gc.h"
 #include "lv_draw_sw_dither.h"
 
 /*********************
@@ -19,6 +20,7 @@
 #define SHADOW_UPSCALE_SHIFT    6
 #define SHADOW_ENHANCE          1
 #define SPLIT_LIMIT             50
+#define CORNER_CACHE_MAX_SIZE   64      /*Larger corners are drawn with masks*/
 
 
 /**********************
@@ -40,6 +42,17 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
 LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, lv_coord_t s,
                                                          lv_coord_t r);
 LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(lv_coord_t size, lv_coord_t sw, uint16_t * sh_ups_buf);
+
+static const lv_opa_t * corner_get(lv_coord_t size, lv_coord_t rout, lv_coord_t rin, lv_coord_t width);
+#if LV_CORNER_CACHE_SIZE > 0
+static void corner_calc(lv_opa_t * buf, lv_coord_t size, lv_coord_t rout, lv_coord_t rin, lv_coord_t width);
+#endif
+LV_ATTRIBUTE_FAST_MEM static void draw_corners(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc,
+                                               const lv_area_t * coords, const lv_opa_t * corner, lv_coord_t size,
+                                               lv_opa_t opa);
+static bool draw_border_rounded(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area, const lv_area_t * inner_area,
+                                lv_coord_t rout, lv_coord_t rin, lv_color_t color, lv_opa_t opa,
+                                lv_blend_mode_t blend_mode);
 #endif
 
 void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area, const lv_area_t * inner_area,
@@ -144,6 +157,42 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
     int32_t short_side = LV_MIN(coords_bg_w, coords_bg_h);
     int32_t rout = LV_MIN(dsc->radius, short_side >> 1);
 
+    /*Without other masks and gradient blend the corners from a cached coverage
+     *and the rest as simple rectangles*/
+    if(!mask_any && rout > 0 && grad_dir == LV_GRAD_DIR_NONE) {
+        const lv_opa_t * corner = corner_get(rout, rout, 0, 0);
+        if(corner) {
+            /*Multiply the coverage with opa and blend with LV_OPA_COVER as the masked lines would do*/
+            blend_dsc.opa = LV_OPA_COVER;
+            draw_corners(draw_ctx, &blend_dsc, &bg_coords, corner, rout, opa);
+
+            lv_area_t blend_area;
+            blend_dsc.blend_area = &blend_area;
+            blend_dsc.mask_buf = NULL;
+            blend_dsc.mask_area = NULL;
+            blend_dsc.opa = opa;
+
+            /*Between the top and bottom corners*/
+            blend_area.x1 = bg_coords.x1 + rout;
+            blend_area.x2 = bg_coords.x2 - rout;
+            blend_area.y1 = bg_coords.y1;
+            blend_area.y2 = bg_coords.y1 + rout - 1;
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+            blend_area.y1 = bg_coords.y2 - rout + 1;
+            blend_area.y2 = bg_coords.y2;
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+            /*Center*/
+            blend_area.x1 = bg_coords.x1;
+            blend_area.x2 = bg_coords.x2;
+            blend_area.y1 = bg_coords.y1 + rout;
+            blend_area.y2 = bg_coords.y2 - rout;
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            return;
+        }
+    }
+
     /*Add a radius mask if there is radius*/
     int32_t clipped_w = lv_area_get_width(&clipped_coords);
     int16_t mask_rout_id = LV_MASK_ID_INV;
@@ -217,8 +266,13 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
 #endif
 #endif
 
+    /* The spans of the masked lines. The covered parts of the lines are blended without mask
+     * and the transparent parts are skipped.*/
+    lv_draw_mask_span_list_t mask_spans;
+
     /*There is another mask too. Draw line by line. */
     if(mask_any) {
+        blend_dsc.mask_spans = &mask_spans;
         for(h = clipped_coords.y1; h <= clipped_coords.y2; h++) {
             blend_area.y1 = h;
             blend_area.y2 = h;
@@ -226,7 +280,7 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
             /* Initialize the mask to opa instead of 0xFF and blend with LV_OPA_COVER.
              * It saves calculating the final opa in lv_draw_sw_blend*/
             lv_memset(mask_buf, opa, clipped_w);
-            blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, clipped_coords.x1, h, clipped_w);
+            blend_dsc.mask_res = lv_draw_mask_apply_spans(mask_buf, clipped_coords.x1, h, clipped_w, &mask_spans);
             if(blend_dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
 
 #if _DITHER_GRADIENT
@@ -240,6 +294,7 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
 
 
     /* Draw the top of the rectangle line by line and mirror it to the bottom. */
+    blend_dsc.mask_spans = &mask_spans;
     for(h = 0; h < rout; h++) {
         lv_coord_t top_y = bg_coords.y1 + h;
         lv_coord_t bottom_y = bg_coords.y2 - h;
@@ -248,7 +303,7 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
         /* Initialize the mask to opa instead of 0xFF and blend with LV_OPA_COVER.
          * It saves calculating the final opa in lv_draw_sw_blend*/
         lv_memset(mask_buf, opa, clipped_w);
-        blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, blend_area.x1, top_y, clipped_w);
+        blend_dsc.mask_res = lv_draw_mask_apply_spans(mask_buf, blend_area.x1, top_y, clipped_w, &mask_spans);
         if(blend_dsc.mask_res == LV_DRAW_MASK_RES_FULL_COVER) blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
 
         if(top_y >= clipped_coords.y1) {
@@ -283,6 +338,7 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
     center_coords.y1 = bg_coords.y1 + rout;
     center_coords.y2 = bg_coords.y2 - rout;
     bool mask_any_center = lv_draw_mask_is_any(&center_coords);
+    if(!mask_any_center) blend_dsc.mask_spans = NULL;
     if(!mask_any_center && grad_dir == LV_GRAD_DIR_NONE) {
         blend_area.y1 = bg_coords.y1 + rout;
         blend_area.y2 = bg_coords.y2 - rout;
@@ -299,7 +355,7 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
             /*If there is no other mask do not apply mask as in the center there is no radius to mask*/
             if(mask_any_center) {
                 lv_memset(mask_buf, opa, clipped_w);
-                blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, clipped_coords.x1, h, clipped_w);
+                blend_dsc.mask_res = lv_draw_mask_apply_spans(mask_buf, clipped_coords.x1, h, clipped_w, &mask_spans);
             }
 
             blend_area.y1 = h;
@@ -1109,6 +1165,290 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(lv_coord_t size, lv_coord_t
 
     lv_mem_buf_release(sh_ups_blur_buf);
 }
+
+/**
+ * Get the anti-aliased coverage of the top left corner of a rounded rectangle or border.
+ * The other corners are the mirrored versions of it.
+ * @param size      width and height of the corner
+ * @param rout      radius of the outer edge
+ * @param rin       radius of the inner edge. Ignored if `width == 0`
+ * @param width     width of the border or 0 for a filled rectangle
+ * @return          `size * size` coverage values or NULL if the corner can't be cached
+ */
+static const lv_opa_t * corner_get(lv_coord_t size, lv_coord_t rout, lv_coord_t rin, lv_coord_t width)
+{
+#if LV_CORNER_CACHE_SIZE > 0
+    if(size <= 0 || size > CORNER_CACHE_MAX_SIZE) return NULL;
+    if(width == 0) rin = 0;
+
+    uint32_t buf_size = size * size;
+    if(buf_size > _LV_DRAW_CORNER_CACHE_BUF_SIZE) return NULL;
+
+    /*Allocate the entries and the buffer of the corners once and keep them until `lv_deinit()`*/
+    _lv_draw_corner_cache_t * cache = LV_GC_ROOT(_lv_corner_cache);
+    if(cache == NULL) {
+        cache = lv_mem_alloc(sizeof(_lv_draw_corner_cache_t) + _LV_DRAW_CORNER_CACHE_BUF_SIZE);
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return NULL;
+        lv_memset_00(cache, sizeof(_lv_draw_corner_cache_t));
+        LV_GC_ROOT(_lv_corner_cache) = cache;
+    }
+
+    cache->use_cnt++;
+
+    /*Search the corner and find the least recently used entry in the meantime*/
+    _lv_draw_corner_cache_entry_t * entry = &cache->entries[0];
+    uint32_t i;
+    for(i = 0; i < LV_CORNER_CACHE_SIZE; i++) {
+        _lv_draw_corner_cache_entry_t * e = &cache->entries[i];
+        if(e->buf && e->rout == rout && e->rin == rin && e->width == width) {
+            e->last_used = cache->use_cnt;
+            return e->buf;
+        }
+        if(e->last_used < entry->last_used) entry = e;
+    }
+
+    /*Drop the least recently used corners until the new one fits*/
+    entry->buf = NULL;
+    entry->buf_size = 0;
+    while(1) {
+        uint32_t used = 0;
+        _lv_draw_corner_cache_entry_t * lru = NULL;
+        for(i = 0; i < LV_CORNER_CACHE_SIZE; i++) {
+            _lv_draw_corner_cache_entry_t * e = &cache->entries[i];
+            if(e->buf == NULL) continue;
+            used += e->buf_size;
+            if(lru == NULL || e->last_used < lru->last_used) lru = e;
+        }
+        if(used + buf_size <= _LV_DRAW_CORNER_CACHE_BUF_SIZE) break;
+        lru->buf = NULL;
+        lru->buf_size = 0;
+    }
+
+    /*Move the kept corners to the beginning of the buffer in address order to put the free space at the end*/
+    lv_opa_t * wr = (lv_opa_t *)(cache + 1);
+    while(1) {
+        _lv_draw_corner_cache_entry_t * next = NULL;
+        for(i = 0; i < LV_CORNER_CACHE_SIZE; i++) {
+            _lv_draw_corner_cache_entry_t * e = &cache->entries[i];
+            if(e->buf && e->buf >= wr && (next == NULL || e->buf < next->buf)) next = e;
+        }
+        if(next == NULL) break;
+        if(next->buf != wr) {
+            /*The areas can overlap so copy forward byte by byte*/
+            uint32_t j;
+            for(j = 0; j < next->buf_size; j++) wr[j] = next->buf[j];
+            next->buf = wr;
+        }
+        wr += next->buf_size;
+    }
+
+    entry->buf = wr;
+    entry->buf_size = buf_size;
+    entry->rout = rout;
+    entry->rin = rin;
+    entry->width = width;
+    entry->last_used = cache->use_cnt;
+    corner_calc(entry->buf, size, rout, rin, width);
+
+    return entry->buf;
+#else
+    LV_UNUSED(size);
+    LV_UNUSED(rout);
+    LV_UNUSED(rin);
+    LV_UNUSED(width);
+    return NULL;
+#endif
+}
+
+#if LV_CORNER_CACHE_SIZE > 0
+/**
+ * Calculate the coverage of the top left corner of a rounded rectangle or border.
+ * The same radius masks are used as for drawing the corners line by line, so the result is exactly the same.
+ * @param buf       store the coverage here (`size * size` bytes)
+ * @param size      width and height of the corner
+ * @param rout      radius of the outer edge
+ * @param rin       radius of the inner edge. Ignored if `width == 0`
+ * @param width     width of the border or 0 for a filled rectangle
+ */
+static void corner_calc(lv_opa_t * buf, lv_coord_t size, lv_coord_t rout, lv_coord_t rin, lv_coord_t width)
+{
+    /*Use a rectangle which is large enough to keep the other corners away*/
+    lv_area_t outer_area;
+    outer_area.x1 = 0;
+    outer_area.y1 = 0;
+    outer_area.x2 = 2 * size + 1;
+    outer_area.y2 = 2 * size + 1;
+
+    lv_draw_mask_radius_param_t mask_rout_param;
+    if(rout > 0) lv_draw_mask_radius_init(&mask_rout_param, &outer_area, rout, false);
+
+    lv_draw_mask_radius_param_t mask_rin_param;
+    if(width > 0) {
+        lv_area_t inner_area;
+        lv_area_copy(&inner_area, &outer_area);
+        lv_area_increase(&inner_area, -width, -width);
+        lv_draw_mask_radius_init(&mask_rin_param, &inner_area, rin, true);
+    }
+
+    lv_coord_t y;
+    for(y = 0; y < size; y++) {
+        lv_opa_t * buf_line = &buf[y * size];
+        lv_memset_ff(buf_line, size);
+
+        /*Apply the masks in the same order as they are added when drawing with masks*/
+        lv_draw_mask_res_t res = LV_DRAW_MASK_RES_FULL_COVER;
+        if(rout > 0) res = mask_rout_param.dsc.cb(buf_line, 0, y, size, &mask_rout_param);
+        if(width > 0 && res != LV_DRAW_MASK_RES_TRANSP) {
+            res = mask_rin_param.dsc.cb(buf_line, 0, y, size, &mask_rin_param);
+        }
+
+        if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(buf_line, size);
+    }
+
+    if(rout > 0) lv_draw_mask_free_param(&mask_rout_param);
+    if(width > 0) lv_draw_mask_free_param(&mask_rin_param);
+}
+#endif
+
+/**
+ * Blend the four corners of a rectangle by mirroring the coverage of its top left corner.
+ * @param draw_ctx  pointer to a draw context
+ * @param blend_dsc blend descriptor with the color, opacity and blend mode to use.
+ *                  Its mask and area fields are overwritten.
+ * @param coords    coordinates of the rectangle
+ * @param corner    coverage of the top left corner (`size * size` bytes)
+ * @param size      width and height of a corner
+ * @param opa       multiply the coverage with this opacity. LV_OPA_COVER: use the coverage as it is
+ */
+LV_ATTRIBUTE_FAST_MEM static void draw_corners(lv_draw_ctx_t * draw_ctx, lv_draw_sw_blend_dsc_t * blend_dsc,
+                                               const lv_area_t * coords, const lv_opa_t * corner, lv_coord_t size,
+                                               lv_opa_t opa)
+{
+    lv_area_t corner_area;
+    lv_area_t blend_area;
+    lv_opa_t * mask_buf = lv_mem_buf_get(size * size);
+    blend_dsc->mask_buf = mask_buf;
+    blend_dsc->mask_area = &blend_area;
+    blend_dsc->blend_area = &blend_area;
+    blend_dsc->mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        bool right = i & 0x1 ? true : false;
+        bool bottom = i & 0x2 ? true : false;
+        corner_area.x1 = right ? coords->x2 - size + 1 : coords->x1;
+        corner_area.y1 = bottom ? coords->y2 - size + 1 : coords->y1;
+        corner_area.x2 = corner_area.x1 + size - 1;
+        corner_area.y2 = corner_area.y1 + size - 1;
+        if(!_lv_area_intersect(&blend_area, &corner_area, draw_ctx->clip_area)) continue;
+
+        /*Copy the visible part of the mirrored corner*/
+        lv_opa_t * mask_act = mask_buf;
+        lv_coord_t x;
+        lv_coord_t y;
+        for(y = blend_area.y1; y <= blend_area.y2; y++) {
+            const lv_opa_t * corner_line = &corner[(bottom ? corner_area.y2 - y : y - corner_area.y1) * size];
+            if(right) {
+                for(x = blend_area.x1; x <= blend_area.x2; x++) {
+                    *mask_act = corner_line[corner_area.x2 - x];
+                    mask_act++;
+                }
+            }
+            else {
+                lv_memcpy_small(mask_act, &corner_line[blend_area.x1 - corner_area.x1], lv_area_get_width(&blend_area));
+                mask_act += lv_area_get_width(&blend_area);
+            }
+        }
+
+        /*Multiply with opa exactly as a radius mask does when the mask line is initialized with opa*/
+        if(opa < LV_OPA_MAX) {
+            uint32_t mask_size = lv_area_get_size(&blend_area);
+            uint32_t j;
+            for(j = 0; j < mask_size; j++) {
+                mask_buf[j] = LV_UDIV255(mask_buf[j] * opa);
+            }
+        }
+
+        lv_draw_sw_blend(draw_ctx, blend_dsc);
+    }
+
+    lv_mem_buf_release(mask_buf);
+}
+
+/**
+ * Draw a border with rounded corners without masks if the border has the same width on all sides.
+ * The corners are blended from a cached coverage and the sides as simple rectangles.
+ * @param draw_ctx      pointer to a draw context
+ * @param outer_area    the outer area of the border
+ * @param inner_area    the inner area of the border
+ * @param rout          radius of the outer edge
+ * @param rin           radius of the inner edge
+ * @param color         color of the border
+ * @param opa           opacity of the border
+ * @param blend_mode    blend mode to use
+ * @return              true: the border was drawn; false: the border needs to be drawn with masks
+ */
+static bool draw_border_rounded(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area, const lv_area_t * inner_area,
+                                lv_coord_t rout, lv_coord_t rin, lv_color_t color, lv_opa_t opa,
+                                lv_blend_mode_t blend_mode)
+{
+    lv_coord_t width = inner_area->x1 - outer_area->x1;
+    if(width <= 0) return false;
+    if(inner_area->y1 - outer_area->y1 != width) return false;
+    if(outer_area->x2 - inner_area->x2 != width) return false;
+    if(outer_area->y2 - inner_area->y2 != width) return false;
+
+    /*The masks would reduce too large radii, it's not handled here*/
+    lv_coord_t outer_short_side = LV_MIN(lv_area_get_width(outer_area), lv_area_get_height(outer_area));
+    lv_coord_t inner_short_side = LV_MIN(lv_area_get_width(inner_area), lv_area_get_height(inner_area));
+    if(rout < 0 || rout > outer_short_side >> 1) return false;
+    if(rin < 0 || (rin > 0 && rin > inner_short_side >> 1)) return false;
+
+    /*The corners shouldn't overlap*/
+    lv_coord_t size = LV_MAX(rout, width);
+    if(outer_short_side < 2 * size) return false;
+
+    const lv_opa_t * corner = corner_get(size, rout, rin, width);
+    if(corner == NULL) return false;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = color;
+    blend_dsc.opa = opa;
+    blend_dsc.blend_mode = blend_mode;
+
+    draw_corners(draw_ctx, &blend_dsc, outer_area, corner, size, LV_OPA_COVER);
+
+    lv_area_t blend_area;
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_buf = NULL;
+    blend_dsc.mask_area = NULL;
+
+    /*Top and bottom*/
+    blend_area.x1 = outer_area->x1 + size;
+    blend_area.x2 = outer_area->x2 - size;
+    blend_area.y1 = outer_area->y1;
+    blend_area.y2 = inner_area->y1 - 1;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+    blend_area.y1 = inner_area->y2 + 1;
+    blend_area.y2 = outer_area->y2;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+    /*Left and right*/
+    blend_area.x1 = outer_area->x1;
+    blend_area.x2 = inner_area->x1 - 1;
+    blend_area.y1 = outer_area->y1 + size;
+    blend_area.y2 = outer_area->y2 - size;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+    blend_area.x1 = inner_area->x2 + 1;
+    blend_area.x2 = outer_area->x2;
+    lv_draw_sw_blend(draw_ctx, &blend_dsc);
+
+    return true;
+}
 #endif
 
 static void draw_outline(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords)
@@ -1166,6 +1506,10 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
         return;
     }
 
+    if(!mask_any && draw_border_rounded(draw_ctx, outer_area, inner_area, rout, rin, color, opa, blend_mode)) {
+        return;
+    }
+
     /*Get clipped draw area which is the real draw area.
      *It is always the same or inside `coords`*/
     lv_area_t draw_area;
@@ -1174,7 +1518,11 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
 
     lv_draw_sw_blend_dsc_t blend_dsc;
     lv_memset_00(&blend_dsc, sizeof(blend_dsc));
-    blend_dsc.mask_buf = lv_mem_buf_get(draw_area_w);;
+    blend_dsc.mask_buf = lv_mem_buf_get(draw_area_w);
+
+    /*Let the blending skip the transparent and unmask the covered parts of the lines*/
+    lv_draw_mask_span_list_t mask_spans;
+    blend_dsc.mask_spans = &mask_spans;
 
 
     /*Create mask for the outer area*/
@@ -1221,7 +1569,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
             blend_area.y2 = h;
 
             lv_memset_ff(blend_dsc.mask_buf, draw_area_w);
-            blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, draw_area.x1, h, draw_area_w);
+            blend_dsc.mask_res = lv_draw_mask_apply_spans(blend_dsc.mask_buf, draw_area.x1, h, draw_area_w,
+                                                          &mask_spans);
             lv_draw_sw_blend(draw_ctx, &blend_dsc);
         }
 
@@ -1294,7 +1643,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
             if(top_y < draw_area.y1 && bottom_y > draw_area.y2) continue;   /*This line is clipped now*/
 
             lv_memset_ff(blend_dsc.mask_buf, draw_area_w);
-            blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, top_y, draw_area_w);
+            blend_dsc.mask_res = lv_draw_mask_apply_spans(blend_dsc.mask_buf, blend_area.x1, top_y, draw_area_w,
+                                                          &mask_spans);
 
             if(top_y >= draw_area.y1) {
                 blend_area.y1 = top_y;
@@ -1321,7 +1671,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
                     blend_area.y2 = h;
 
                     lv_memset_ff(blend_dsc.mask_buf, blend_w);
-                    blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, h, blend_w);
+                    blend_dsc.mask_res = lv_draw_mask_apply_spans(blend_dsc.mask_buf, blend_area.x1, h, blend_w,
+                                                                  &mask_spans);
                     lv_draw_sw_blend(draw_ctx, &blend_dsc);
                 }
             }
@@ -1332,7 +1683,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
                     blend_area.y2 = h;
 
                     lv_memset_ff(blend_dsc.mask_buf, blend_w);
-                    blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, h, blend_w);
+                    blend_dsc.mask_res = lv_draw_mask_apply_spans(blend_dsc.mask_buf, blend_area.x1, h, blend_w,
+                                                                  &mask_spans);
                     lv_draw_sw_blend(draw_ctx, &blend_dsc);
                 }
             }
@@ -1350,7 +1702,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
                     blend_area.y2 = h;
 
                     lv_memset_ff(blend_dsc.mask_buf, blend_w);
-                    blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, h, blend_w);
+                    blend_dsc.mask_res = lv_draw_mask_apply_spans(blend_dsc.mask_buf, blend_area.x1, h, blend_w,
+                                                                  &mask_spans);
                     lv_draw_sw_blend(draw_ctx, &blend_dsc);
                 }
             }
@@ -1361,7 +1714,8 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
                     blend_area.y2 = h;
 
                     lv_memset_ff(blend_dsc.mask_buf, blend_w);
-                    blend_dsc.mask_res = lv_draw_mask_apply(blend_dsc.mask_buf, blend_area.x1, h, blend_w);
+                    blend_dsc.mask_res = lv_draw_mask_apply_spans(blend_dsc.mask_buf, blend_area.x1, h, blend_w,
+                                                                  &mask_spans);
                     lv_draw_sw_blend(draw_ctx, &blend_dsc);
                 }
             }
@@ -15,6 +15,9 @@
 /*********************
  *      DEFINES
  *********************/
+/*Rows processed together when a right angle rotation transposes the image.
+ *The source is read along its rows while the destination rows of a block stay in the cache.*/
+#define TRANSPOSE_BLOCK_H   16
 
 /**********************
  *      TYPEDEFS
@@ -65,6 +68,19 @@ static void argb_and_rgb_aa(const uint8_t * src, lv_coord_t src_w, lv_coord_t sr
                             int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                             int32_t x_end, lv_color_t * cbuf, uint8_t * abuf, lv_img_cf_t cf);
 
+static bool transform_axis_aligned(const lv_area_t * dest_area, const uint8_t * src, lv_coord_t src_w,
+                                   lv_coord_t src_h, lv_coord_t src_stride, const lv_draw_img_dsc_t * draw_dsc,
+                                   lv_img_cf_t cf, lv_color_t * cbuf, lv_opa_t * abuf);
+
+static inline void copy_px(const uint8_t * src, const lv_opa_t * src_a, uint32_t px_i, lv_img_cf_t cf, lv_color_t ck,
+                           lv_color_t * c, lv_opa_t * a);
+
+static void axis_map_fill(int32_t * map, lv_coord_t len, int32_t d, bool flip, lv_coord_t pivot, int32_t zoom_int,
+                          lv_coord_t max, int32_t px_step);
+
+static inline lv_color_t color_mix_bilinear(lv_color_t c_base, lv_color_t c_hor, lv_color_t c_ver,
+                                            int32_t xs_fract, int32_t ys_fract);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -83,6 +99,9 @@ void lv_draw_sw_transform(lv_draw_ctx_t * draw_ctx, const lv_area_t * dest_area,
 {
     LV_UNUSED(draw_ctx);
 
+    /*Right angle rotations and integer zooms map every pixel to exactly one source pixel so no filtering is required*/
+    if(transform_axis_aligned(dest_area, src_buf, src_w, src_h, src_stride, draw_dsc, cf, cbuf, abuf)) return;
+
     point_transform_dsc_t tr_dsc;
     tr_dsc.angle = -draw_dsc->angle;
     tr_dsc.zoom = (256 * 256) / draw_dsc->zoom;
@@ -422,9 +441,7 @@ static void argb_and_rgb_aa(const uint8_t * src, lv_coord_t src_w, lv_coord_t sr
                 cbuf[x] = c_base;
             }
             else {
-                c_ver = lv_color_mix(c_ver, c_base, ys_fract);
-                c_hor = lv_color_mix(c_hor, c_base, xs_fract);
-                cbuf[x] = lv_color_mix(c_hor, c_ver, LV_OPA_50);
+                cbuf[x] = color_mix_bilinear(c_base, c_hor, c_ver, xs_fract, ys_fract);
             }
         }
         /*Partially out of the image*/
@@ -466,6 +483,210 @@ static void argb_and_rgb_aa(const uint8_t * src, lv_coord_t src_w, lv_coord_t sr
     }
 }
 
+/**
+ * Handle the rotations by 0, 90, 180 and 270 degrees with integer zoom (1x, 2x, 3x, ...).
+ * Every destination pixel is a copy of a source pixel, the 90 and 270 degree rotations transpose the image.
+ * @return true: the transformation was handled; false: it needs the generic transformation
+ */
+static bool transform_axis_aligned(const lv_area_t * dest_area, const uint8_t * src, lv_coord_t src_w,
+                                   lv_coord_t src_h, lv_coord_t src_stride, const lv_draw_img_dsc_t * draw_dsc,
+                                   lv_img_cf_t cf, lv_color_t * cbuf, lv_opa_t * abuf)
+{
+    int32_t angle = draw_dsc->angle % 3600;
+    if(angle < 0) angle += 3600;
+    if(angle % 900 != 0) return false;
+    if(draw_dsc->zoom < LV_IMG_ZOOM_NONE || draw_dsc->zoom % LV_IMG_ZOOM_NONE != 0) return false;
+
+    switch(cf) {
+        case LV_IMG_CF_TRUE_COLOR:
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+#if LV_COLOR_DEPTH == 16
+        case LV_IMG_CF_RGB565A8:
+#endif
+            break;
+        default:
+            return false;
+    }
+
+    lv_coord_t dest_w = lv_area_get_width(dest_area);
+    lv_coord_t dest_h = lv_area_get_height(dest_area);
+
+    /*The source pixel offset of every destination column and row (-1: out of the image).
+     *A pixel is at `col_map[x] + row_map[y]`. With 90 and 270 degrees the columns select the source rows.*/
+    int32_t * col_map = lv_mem_buf_get((dest_w + dest_h) * sizeof(int32_t));
+    if(col_map == NULL) return false;
+    int32_t * row_map = col_map + dest_w;
+
+    int32_t zoom_int = draw_dsc->zoom / LV_IMG_ZOOM_NONE;
+    bool transpose = angle == 900 || angle == 2700;
+    lv_coord_t col_max = transpose ? src_h : src_w;
+    lv_coord_t row_max = transpose ? src_w : src_h;
+    lv_coord_t col_pivot = transpose ? draw_dsc->pivot.y : draw_dsc->pivot.x;
+    lv_coord_t row_pivot = transpose ? draw_dsc->pivot.x : draw_dsc->pivot.y;
+    bool col_flip = angle == 900 || angle == 1800;
+    bool row_flip = angle == 1800 || angle == 2700;
+
+    axis_map_fill(col_map, dest_w, dest_area->x1 - draw_dsc->pivot.x, col_flip, col_pivot, zoom_int, col_max,
+                  transpose ? src_stride : 1);
+    axis_map_fill(row_map, dest_h, dest_area->y1 - draw_dsc->pivot.y, row_flip, row_pivot, zoom_int, row_max,
+                  transpose ? 1 : src_stride);
+
+    const lv_opa_t * src_a = src + src_stride * src_h * sizeof(lv_color_t);    /*Alpha plane of RGB565A8*/
+    lv_color_t ck = {0};
+    if(cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
+        lv_disp_t * d = _lv_refr_get_disp_refreshing();
+        ck = d->driver->color_chroma_key;
+    }
+
+    lv_coord_t x;
+    lv_coord_t y;
+    if(!transpose || dest_h == 1) {
+        for(y = 0; y < dest_h; y++) {
+            int32_t row_ofs = row_map[y];
+            if(row_ofs < 0) {
+                lv_memset_00(abuf, dest_w);
+            }
+            else {
+                for(x = 0; x < dest_w; x++) {
+                    if(col_map[x] < 0) abuf[x] = 0x00;
+                    else copy_px(src, src_a, col_map[x] + row_ofs, cf, ck, &cbuf[x], &abuf[x]);
+                }
+            }
+            cbuf += dest_w;
+            abuf += dest_w;
+        }
+    }
+    else {
+        lv_coord_t y_block;
+        for(y_block = 0; y_block < dest_h; y_block += TRANSPOSE_BLOCK_H) {
+            lv_coord_t y_end = LV_MIN(y_block + TRANSPOSE_BLOCK_H, dest_h);
+            for(x = 0; x < dest_w; x++) {
+                int32_t col_ofs = col_map[x];
+                uint32_t dest_i = y_block * dest_w + x;
+                for(y = y_block; y < y_end; y++) {
+                    if(col_ofs < 0 || row_map[y] < 0) abuf[dest_i] = 0x00;
+                    else copy_px(src, src_a, col_ofs + row_map[y], cf, ck, &cbuf[dest_i], &abuf[dest_i]);
+                    dest_i += dest_w;
+                }
+            }
+        }
+    }
+
+    lv_mem_buf_release(col_map);
+    return true;
+}
+
+static inline void copy_px(const uint8_t * src, const lv_opa_t * src_a, uint32_t px_i, lv_img_cf_t cf, lv_color_t ck,
+                           lv_color_t * c, lv_opa_t * a)
+{
+    switch(cf) {
+        case LV_IMG_CF_TRUE_COLOR_ALPHA: {
+                const uint8_t * src_tmp = src + px_i * LV_IMG_PX_SIZE_ALPHA_BYTE;
+#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
+                c->full = src_tmp[0];
+#elif LV_COLOR_DEPTH == 16
+                c->full = src_tmp[0] + (src_tmp[1] << 8);
+#elif LV_COLOR_DEPTH == 32
+                c->full = *((uint32_t *)src_tmp);
+#endif
+                *a = src_tmp[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+                break;
+            }
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+            *c = ((const lv_color_t *)src)[px_i];
+            *a = c->full == ck.full ? 0x00 : 0xff;
+            break;
+        case LV_IMG_CF_RGB565A8:
+            *c = ((const lv_color_t *)src)[px_i];
+            *a = src_a[px_i];
+            break;
+        default:
+            *c = ((const lv_color_t *)src)[px_i];
+            *a = 0xff;
+            break;
+    }
+}
+
+/**
+ * Get the source pixel offsets of consecutive destination pixels along an axis.
+ * A destination offset `d` from the pivot is mapped to `floor(d / zoom_int + 0.5)`, as the generic transformation rounds.
+ * @param map       store the source pixel offsets here, -1 if out of the image
+ * @param len       number of destination pixels
+ * @param d         offset of the first destination pixel from the pivot
+ * @param flip      true: the source coordinates decrease (rotated by 180 degree on this axis)
+ * @param pivot     source coordinate of the pivot
+ * @param zoom_int  integer zoom (1, 2, 3, ...)
+ * @param max       size of the source on this axis
+ * @param px_step   pixel offset between the source coordinates (1 or the stride)
+ */
+static void axis_map_fill(int32_t * map, lv_coord_t len, int32_t d, bool flip, lv_coord_t pivot, int32_t zoom_int,
+                          lv_coord_t max, int32_t px_step)
+{
+    /*Every source pixel is repeated `zoom_int` times, only the first run can be shorter*/
+    int32_t den = 2 * zoom_int;
+    int32_t num = 2 * (flip ? -d : d) + zoom_int;
+    int32_t q = num >= 0 ? num / den : -((-num + den - 1) / den);
+    int32_t r = num - q * den;
+    int32_t run = flip ? r / 2 + 1 : (den - r + 1) / 2;
+    int32_t v = pivot + q;
+    int32_t v_step = flip ? -1 : 1;
+
+    lv_coord_t i = 0;
+    while(i < len) {
+        int32_t ofs = (uint32_t)v < (uint32_t)max ? v * px_step : -1;
+        lv_coord_t run_end = LV_MIN(i + run, len);
+        for(; i < run_end; i++) map[i] = ofs;
+
+        v += v_step;
+        run = zoom_int;
+    }
+}
+
+/**
+ * Mix the base pixel with its horizontal and vertical neighbors in one step.
+ * Gives the same as mixing `c_hor` and `c_ver` with `c_base` and mixing the results with 50% opacity.
+ * @param xs_fract weight of `c_hor` (0..255)
+ * @param ys_fract weight of `c_ver` (0..255)
+ */
+static inline lv_color_t color_mix_bilinear(lv_color_t c_base, lv_color_t c_hor, lv_color_t c_ver,
+                                            int32_t xs_fract, int32_t ys_fract)
+{
+    lv_color_t ret;
+#if LV_COLOR_DEPTH == 16
+    /*Mix all channels at once with 1/32 weights (like `lv_color_mix()`)*/
+#if LV_COLOR_16_SWAP == 1
+    c_base.full = c_base.full << 8 | c_base.full >> 8;
+    c_hor.full = c_hor.full << 8 | c_hor.full >> 8;
+    c_ver.full = c_ver.full << 8 | c_ver.full >> 8;
+#endif
+    uint32_t w_hor = (xs_fract + 8) >> 4;
+    uint32_t w_ver = (ys_fract + 8) >> 4;
+    uint32_t w_base = 32 - w_hor - w_ver;
+    uint32_t base = ((uint32_t)c_base.full | ((uint32_t)c_base.full << 16)) & 0x7E0F81F;
+    uint32_t hor = ((uint32_t)c_hor.full | ((uint32_t)c_hor.full << 16)) & 0x7E0F81F;
+    uint32_t ver = ((uint32_t)c_ver.full | ((uint32_t)c_ver.full << 16)) & 0x7E0F81F;
+    uint32_t result = ((base * w_base + hor * w_hor + ver * w_ver) >> 5) & 0x7E0F81F;
+    ret.full = (uint16_t)((result >> 16) | result);
+#if LV_COLOR_16_SWAP == 1
+    ret.full = ret.full << 8 | ret.full >> 8;
+#endif
+#elif LV_COLOR_DEPTH == 32
+    /*Mix red with blue and green with alpha in one multiplication each. The weights are 1/256.*/
+    uint32_t w_hor = xs_fract >> 1;
+    uint32_t w_ver = ys_fract >> 1;
+    uint32_t w_base = 256 - w_hor - w_ver;
+    uint32_t rb = (c_base.full & 0xFF00FF) * w_base + (c_hor.full & 0xFF00FF) * w_hor + (c_ver.full & 0xFF00FF) * w_ver;
+    uint32_t g = (c_base.full & 0x00FF00) * w_base + (c_hor.full & 0x00FF00) * w_hor + (c_ver.full & 0x00FF00) * w_ver;
+    ret.full = 0xFF000000 | ((rb >> 8) & 0xFF00FF) | ((g >> 8) & 0x00FF00);
+#else
+    c_ver = lv_color_mix(c_ver, c_base, ys_fract);
+    c_hor = lv_color_mix(c_hor, c_base, xs_fract);
+    ret = lv_color_mix(c_hor, c_ver, LV_OPA_50);
+#endif
+    return ret;
+}
+
 static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
                                      int32_t * yout)
 {
@@ -90,6 +90,8 @@ void lv_draw_swm341_dma2d_ctx_init(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx
     dma2d_draw_ctx->blend = lv_draw_swm341_dma2d_blend;
     //    dma2d_draw_ctx->base_draw.draw_img_decoded = lv_draw_swm341_dma2d_img_decoded;
     dma2d_draw_ctx->base_draw.wait_for_finish = lv_gpu_swm341_dma2d_wait_cb;
+    /*Letter runs are rendered by the SW renderer only, draw the letters one by one*/
+    dma2d_draw_ctx->base_draw.draw_letter_run = NULL;
 }
 
 void lv_draw_swm341_dma2d_ctx_deinit(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
@@ -0,0 +1,523 @@
+/**
+ * @file lv_asset_pack.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_asset_pack.h"
+#if LV_USE_ASSET_PACK
+
+#include <string.h>
+#if LV_ASSET_PACK_MMAP
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const uint8_t * data;
+    uint32_t size;
+    uint32_t pos;
+} asset_file_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static const lv_asset_pack_entry_t * find_entry(const lv_asset_pack_t * pack, const char * name);
+static const lv_asset_pack_entry_t * find_entry_all(const char * name, const lv_asset_pack_t ** pack);
+static bool check_pack(const uint8_t * data, uint32_t size);
+static bool check_img(const uint8_t * data, uint32_t size);
+static lv_asset_pack_t * pack_create(const uint8_t * data, uint32_t size);
+static const lv_img_dsc_t * get_file_img(const void * src);
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf);
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+
+#if LV_ASSET_PACK_LETTER != '\0'
+    static void * fs_open(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode);
+    static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p);
+    static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br);
+    static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
+    static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_ll_t pack_ll;     /*The opened packs, the last opened first*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_asset_pack_init(void)
+{
+    _lv_ll_init(&pack_ll, sizeof(lv_asset_pack_t *));
+
+    /*Tried before the built-in decoder so the images from the packs are used in place*/
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, decoder_info);
+    lv_img_decoder_set_open_cb(dec, decoder_open);
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+    lv_img_decoder_set_close_cb(dec, decoder_close);
+
+#if LV_ASSET_PACK_LETTER != '\0'
+    static lv_fs_drv_t fs_drv;
+    lv_fs_drv_init(&fs_drv);
+
+    fs_drv.letter = LV_ASSET_PACK_LETTER;
+    fs_drv.open_cb = fs_open;
+    fs_drv.close_cb = fs_close;
+    fs_drv.read_cb = fs_read;
+    fs_drv.seek_cb = fs_seek;
+    fs_drv.tell_cb = fs_tell;
+
+    lv_fs_drv_register(&fs_drv);
+#endif
+}
+
+lv_asset_pack_t * lv_asset_pack_open(const char * path)
+{
+#if LV_ASSET_PACK_MMAP
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        LV_LOG_WARN("Can't open %s", path);
+        return NULL;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(lv_asset_pack_header_t) || st.st_size > (off_t)UINT32_MAX) {
+        LV_LOG_WARN("%s is not an asset pack", path);
+        close(fd);
+        return NULL;
+    }
+
+    uint32_t size = (uint32_t)st.st_size;
+    void * map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(map == MAP_FAILED) {
+        LV_LOG_WARN("Can't map %s", path);
+        return NULL;
+    }
+
+    lv_asset_pack_t * pack = pack_create(map, size);
+    if(pack == NULL) {
+        munmap(map, size);
+        return NULL;
+    }
+    pack->mapped = 1;
+#else
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, path, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        LV_LOG_WARN("Can't open %s", path);
+        return NULL;
+    }
+
+    uint32_t size = 0;
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, &size);
+    lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+
+    uint8_t * data = size >= sizeof(lv_asset_pack_header_t) ? lv_mem_alloc(size) : NULL;
+    uint32_t br = 0;
+    if(data) lv_fs_read(&f, data, size, &br);
+    lv_fs_close(&f);
+
+    if(data == NULL || br != size) {
+        LV_LOG_WARN("Can't load %s", path);
+        if(data) lv_mem_free(data);
+        return NULL;
+    }
+
+    lv_asset_pack_t * pack = pack_create(data, size);
+    if(pack == NULL) {
+        lv_mem_free(data);
+        return NULL;
+    }
+    pack->allocated = 1;
+#endif
+
+    return pack;
+}
+
+lv_asset_pack_t * lv_asset_pack_open_mem(const void * data, uint32_t size)
+{
+    return pack_create(data, size);
+}
+
+void lv_asset_pack_close(lv_asset_pack_t * pack)
+{
+    if(pack == NULL) return;
+
+    /*The images from the pack can't be cached anymore*/
+    uint32_t i;
+    for(i = 0; i < pack->entry_cnt; i++) {
+        if(pack->entries[i].type != LV_ASSET_TYPE_IMG) continue;
+        lv_img_cache_invalidate_src(&pack->imgs[i]);
+
+#if LV_ASSET_PACK_LETTER != '\0'
+        const char * name = (const char *)pack->data + pack->entries[i].name_ofs;
+        size_t len = strlen(name);
+        char * path = lv_mem_buf_get(len + 3);
+        if(path) {
+            path[0] = LV_ASSET_PACK_LETTER;
+            path[1] = ':';
+            lv_memcpy(path + 2, name, len + 1);
+            lv_img_cache_invalidate_src(path);
+            lv_mem_buf_release(path);
+        }
+#endif
+    }
+
+    lv_asset_pack_t ** pack_p;
+    _lv_img_cache_async_lock();
+    _LV_LL_READ(&pack_ll, pack_p) {
+        if(*pack_p == pack) {
+            _lv_ll_remove(&pack_ll, pack_p);
+            lv_mem_free(pack_p);
+            break;
+        }
+    }
+    _lv_img_cache_async_unlock();
+
+#if LV_ASSET_PACK_MMAP
+    if(pack->mapped) munmap((void *)pack->data, pack->size);
+#endif
+    if(pack->allocated) lv_mem_free((void *)pack->data);
+
+    lv_mem_free(pack->imgs);
+    lv_mem_free(pack);
+}
+
+const void * lv_asset_pack_get(const lv_asset_pack_t * pack, const char * name, lv_asset_type_t type, uint32_t * size)
+{
+    const lv_asset_pack_entry_t * entry = pack ? find_entry(pack, name) : find_entry_all(name, &pack);
+    if(entry == NULL || entry->type != type) return NULL;
+
+    if(size) *size = entry->data_size;
+    return pack->data + entry->data_ofs;
+}
+
+const lv_img_dsc_t * lv_asset_pack_get_img(const lv_asset_pack_t * pack, const char * name)
+{
+    const lv_asset_pack_entry_t * entry = pack ? find_entry(pack, name) : find_entry_all(name, &pack);
+    if(entry == NULL || entry->type != LV_ASSET_TYPE_IMG) return NULL;
+
+    return &pack->imgs[entry - pack->entries];
+}
+
+const char * lv_asset_pack_get_str(const lv_asset_pack_t * pack, const char * name)
+{
+    return lv_asset_pack_get(pack, name, LV_ASSET_TYPE_STR, NULL);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Find an entry with binary search
+ * @param pack pointer to a pack
+ * @param name name of the entry
+ * @return the entry or NULL if not found
+ */
+static const lv_asset_pack_entry_t * find_entry(const lv_asset_pack_t * pack, const char * name)
+{
+    uint32_t first = 0;
+    uint32_t last = pack->entry_cnt;
+    while(first < last) {
+        uint32_t mid = first + (last - first) / 2;
+        int cmp = strcmp(name, (const char *)pack->data + pack->entries[mid].name_ofs);
+        if(cmp == 0) return &pack->entries[mid];
+        if(cmp < 0) last = mid;
+        else first = mid + 1;
+    }
+
+    return NULL;
+}
+
+static const lv_asset_pack_entry_t * find_entry_all(const char * name, const lv_asset_pack_t ** pack)
+{
+    /*It's called from the decoding worker too (through the file system driver and the decoder)*/
+    const lv_asset_pack_entry_t * entry = NULL;
+    lv_asset_pack_t ** pack_p;
+    _lv_img_cache_async_lock();
+    _LV_LL_READ(&pack_ll, pack_p) {
+        entry = find_entry(*pack_p, name);
+        if(entry) {
+            *pack = *pack_p;
+            break;
+        }
+    }
+    _lv_img_cache_async_unlock();
+
+    return entry;
+}
+
+/**
+ * Check that everything in the pack is in bounds, so it can be used without further checks
+ * @param data pointer to the pack
+ * @param size size of the available memory
+ * @return true: valid pack
+ */
+static bool check_pack(const uint8_t * data, uint32_t size)
+{
+    if(data == NULL || ((lv_uintptr_t)data & 0x3) || size < sizeof(lv_asset_pack_header_t)) return false;
+
+    const lv_asset_pack_header_t * header = (const lv_asset_pack_header_t *)data;
+    if(header->magic != LV_ASSET_PACK_MAGIC || header->version != LV_ASSET_PACK_VERSION) return false;
+    if(header->size > size || header->size < sizeof(lv_asset_pack_header_t)) return false;
+    size = header->size;
+
+    uint32_t max_entry_cnt = (size - sizeof(lv_asset_pack_header_t)) / sizeof(lv_asset_pack_entry_t);
+    if(header->entry_cnt > max_entry_cnt) return false;
+
+    const lv_asset_pack_entry_t * entries = (const lv_asset_pack_entry_t *)(header + 1);
+    const char * prev_name = NULL;
+    uint32_t i;
+    for(i = 0; i < header->entry_cnt; i++) {
+        const lv_asset_pack_entry_t * entry = &entries[i];
+        if(entry->name_ofs >= size || memchr(data + entry->name_ofs, '\0', size - entry->name_ofs) == NULL) return false;
+        if(entry->data_ofs > size || entry->data_size > size - entry->data_ofs || (entry->data_ofs & 0x3)) return false;
+
+        /*Sorted and unique names are required by the binary search*/
+        const char * name = (const char *)data + entry->name_ofs;
+        if(prev_name && strcmp(prev_name, name) >= 0) return false;
+        prev_name = name;
+
+        if(entry->type == LV_ASSET_TYPE_IMG && !check_img(data + entry->data_ofs, entry->data_size)) return false;
+        if(entry->type == LV_ASSET_TYPE_STR) {
+            if(entry->data_size == 0 || data[entry->data_ofs + entry->data_size - 1] != '\0') return false;
+        }
+    }
+
+    return true;
+}
+
+static bool check_img(const uint8_t * data, uint32_t size)
+{
+    if(size < sizeof(lv_img_header_t)) return false;
+
+    lv_img_header_t header;
+    lv_memcpy_small(&header, data, sizeof(lv_img_header_t));
+    uint32_t px_size;
+    if(header.cf >= LV_IMG_CF_INDEXED_1BIT && header.cf <= LV_IMG_CF_ALPHA_8BIT) {
+        /*`lv_img_buf_get_img_size()` rounds up these formats more than needed*/
+        uint32_t bpp = lv_img_cf_get_px_size(header.cf);
+        px_size = ((header.w * bpp + 7) >> 3) * header.h;
+        if(header.cf <= LV_IMG_CF_INDEXED_8BIT) px_size += (1 << bpp) * sizeof(lv_color32_t);
+    }
+    else {
+        px_size = lv_img_buf_get_img_size(header.w, header.h, header.cf);
+    }
+
+    /*Unknown formats are checked by their decoders*/
+    return px_size == 0 || px_size <= size - sizeof(lv_img_header_t);
+}
+
+static lv_asset_pack_t * pack_create(const uint8_t * data, uint32_t size)
+{
+    if(!check_pack(data, size)) {
+        LV_LOG_WARN("Invalid asset pack");
+        return NULL;
+    }
+
+    const lv_asset_pack_header_t * header = (const lv_asset_pack_header_t *)data;
+    lv_asset_pack_t * pack = lv_mem_alloc(sizeof(lv_asset_pack_t));
+    LV_ASSERT_MALLOC(pack);
+    if(pack == NULL) return NULL;
+    lv_memset_00(pack, sizeof(lv_asset_pack_t));
+
+    pack->data = data;
+    pack->size = size;
+    pack->entries = (const lv_asset_pack_entry_t *)(header + 1);
+    pack->entry_cnt = header->entry_cnt;
+
+    if(header->entry_cnt) {
+        pack->imgs = lv_mem_alloc(sizeof(lv_img_dsc_t) * header->entry_cnt);
+        LV_ASSERT_MALLOC(pack->imgs);
+        if(pack->imgs == NULL) {
+            lv_mem_free(pack);
+            return NULL;
+        }
+    }
+
+    uint32_t i;
+    for(i = 0; i < pack->entry_cnt; i++) {
+        const lv_asset_pack_entry_t * entry = &pack->entries[i];
+        lv_img_dsc_t * img = &pack->imgs[i];
+        lv_memset_00(img, sizeof(lv_img_dsc_t));
+        if(entry->type != LV_ASSET_TYPE_IMG) continue;
+
+        lv_memcpy_small(&img->header, data + entry->data_ofs, sizeof(lv_img_header_t));
+        img->data_size = entry->data_size - sizeof(lv_img_header_t);
+        img->data = data + entry->data_ofs + sizeof(lv_img_header_t);
+    }
+
+    /*Add it only when it's ready as the file system driver can search the list from the decoding worker*/
+    _lv_img_cache_async_lock();
+    lv_asset_pack_t ** pack_p = _lv_ll_ins_head(&pack_ll);
+    if(pack_p) *pack_p = pack;
+    _lv_img_cache_async_unlock();
+    LV_ASSERT_MALLOC(pack_p);
+    if(pack_p == NULL) {
+        if(pack->imgs) lv_mem_free(pack->imgs);
+        lv_mem_free(pack);
+        return NULL;
+    }
+
+    return pack;
+}
+
+/**
+ * Get the image of a file path on the drive of the packs
+ * @param src an image source
+ * @return the image from a pack or NULL
+ */
+static const lv_img_dsc_t * get_file_img(const void * src)
+{
+#if LV_ASSET_PACK_LETTER != '\0'
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return NULL;
+
+    const char * path = src;
+    if(path[0] != LV_ASSET_PACK_LETTER || path[1] != ':') return NULL;
+    path += 2;
+    while(*path == '/') path++;
+
+    return lv_asset_pack_get_img(NULL, path);
+#else
+    LV_UNUSED(src);
+    return NULL;
+#endif
+}
+
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    const lv_img_dsc_t * img = get_file_img(src);
+    if(img == NULL) return LV_RES_INV;
+
+    return lv_img_decoder_built_in_info(decoder, img, header);
+}
+
+/*The images are passed to the built-in decoder as variables so it uses them in place too.
+ *The formats which can't be drawn directly (e.g. indexed) are read line by line from the pack.*/
+
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    const lv_img_dsc_t * img = get_file_img(dsc->src);
+    if(img == NULL) return LV_RES_INV;
+
+    const void * src = dsc->src;
+    dsc->src = img;
+    dsc->src_type = LV_IMG_SRC_VARIABLE;
+    lv_res_t res = lv_img_decoder_built_in_open(decoder, dsc);
+    dsc->src = src;
+    dsc->src_type = LV_IMG_SRC_FILE;
+    return res;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf)
+{
+    const lv_img_dsc_t * img = get_file_img(dsc->src);
+    if(img == NULL) return LV_RES_INV;
+
+    const void * src = dsc->src;
+    dsc->src = img;
+    dsc->src_type = LV_IMG_SRC_VARIABLE;
+    lv_res_t res = lv_img_decoder_built_in_read_line(decoder, dsc, x, y, len, buf);
+    dsc->src = src;
+    dsc->src_type = LV_IMG_SRC_FILE;
+    return res;
+}
+
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    /*Don't let the built-in decoder close a file*/
+    dsc->src_type = LV_IMG_SRC_VARIABLE;
+    lv_img_decoder_built_in_close(decoder, dsc);
+    dsc->src_type = LV_IMG_SRC_FILE;
+}
+
+#if LV_ASSET_PACK_LETTER != '\0'
+
+static void * fs_open(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+    if(mode != LV_FS_MODE_RD) return NULL;
+
+    while(*path == '/') path++;
+
+    const lv_asset_pack_t * pack;
+    const lv_asset_pack_entry_t * entry = find_entry_all(path, &pack);
+    if(entry == NULL) return NULL;
+
+    asset_file_t * f = lv_mem_alloc(sizeof(asset_file_t));
+    LV_ASSERT_MALLOC(f);
+    if(f == NULL) return NULL;
+
+    f->data = pack->data + entry->data_ofs;
+    f->size = entry->data_size;
+    f->pos = 0;
+    return f;
+}
+
+static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p)
+{
+    LV_UNUSED(drv);
+    lv_mem_free(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(drv);
+    asset_file_t * f = file_p;
+    if(btr > f->size - f->pos) btr = f->size - f->pos;
+
+    lv_memcpy(buf, f->data + f->pos, btr);
+    f->pos += btr;
+    *br = btr;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+    asset_file_t * f = file_p;
+    if(whence == LV_FS_SEEK_CUR) pos += f->pos;
+    else if(whence == LV_FS_SEEK_END) pos += f->size;
+
+    if(pos > f->size) return LV_FS_RES_INV_PARAM;
+
+    f->pos = pos;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(drv);
+    *pos_p = ((asset_file_t *)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+#endif /*LV_ASSET_PACK_LETTER != '\0'*/
+
+#endif /*LV_USE_ASSET_PACK*/
@@ -0,0 +1,132 @@
+/**
+ * @file lv_asset_pack.h
+ *
+ */
+
+#ifndef LV_ASSET_PACK_H
+#define LV_ASSET_PACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+#if LV_USE_ASSET_PACK
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_ASSET_PACK_MAGIC     0x5041564CU     /*"LVAP"*/
+#define LV_ASSET_PACK_VERSION   1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_ASSET_TYPE_DATA = 0,     /**< Any binary data*/
+    LV_ASSET_TYPE_IMG,          /**< `lv_img_header_t` and the pixels, like the `.bin` images*/
+    LV_ASSET_TYPE_FONT,         /**< Binary font, like the `.bin` fonts of lv_font_conv*/
+    LV_ASSET_TYPE_STR,          /**< '\0' terminated UTF-8 string*/
+};
+typedef uint32_t lv_asset_type_t;
+
+/** Header at the beginning of the pack. All fields are little endian.*/
+typedef struct {
+    uint32_t magic;             /**< LV_ASSET_PACK_MAGIC*/
+    uint32_t version;           /**< LV_ASSET_PACK_VERSION*/
+    uint32_t entry_cnt;         /**< Number of entries after the header*/
+    uint32_t size;              /**< Size of the whole pack in bytes*/
+} lv_asset_pack_header_t;
+
+/** An entry of the index. The entries are sorted by name.*/
+typedef struct {
+    uint32_t name_ofs;          /**< Offset of the '\0' terminated name from the beginning of the pack*/
+    uint32_t data_ofs;          /**< Offset of the data from the beginning of the pack, 4 bytes aligned*/
+    uint32_t data_size;         /**< Size of the data in bytes*/
+    lv_asset_type_t type;
+} lv_asset_pack_entry_t;
+
+typedef struct {
+    const uint8_t * data;                   /**< The mapped or loaded pack*/
+    uint32_t size;
+    const lv_asset_pack_entry_t * entries;
+    uint32_t entry_cnt;
+    lv_img_dsc_t * imgs;                    /**< An image descriptor for every entry. The pixels are in the pack.*/
+    uint8_t mapped : 1;                     /**< 1: `data` is mapped by `lv_asset_pack_open()`*/
+    uint8_t allocated : 1;                  /**< 1: `data` is loaded by `lv_asset_pack_open()`*/
+} lv_asset_pack_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register the file system driver (if `LV_ASSET_PACK_LETTER` is set) and the image decoder of the asset packs.
+ * Called by `lv_init()`.
+ */
+void lv_asset_pack_init(void);
+
+/**
+ * Open an asset pack file.
+ * With `LV_ASSET_PACK_MMAP` it's mapped with `mmap()`, else it's loaded to the RAM through `lv_fs`.
+ * @param path path of the file. With `LV_ASSET_PACK_MMAP` a path of the OS, else an LVGL path with drive letter.
+ * @return the opened pack or NULL if the file can't be opened or it's not a valid asset pack
+ */
+lv_asset_pack_t * lv_asset_pack_open(const char * path);
+
+/**
+ * Open an asset pack which is already in the memory. E.g. a flash partition mapped to the address space.
+ * The assets are used in place so the memory needs to be valid until the pack is closed.
+ * @param data pointer to the pack, aligned to 4 bytes
+ * @param size size of the memory. Can be larger than the pack (e.g. the size of the partition).
+ * @return the opened pack or NULL if it's not a valid asset pack
+ */
+lv_asset_pack_t * lv_asset_pack_open_mem(const void * data, uint32_t size);
+
+/**
+ * Close an asset pack. Its assets can't be used after it.
+ * @param pack pointer to an opened pack
+ */
+void lv_asset_pack_close(lv_asset_pack_t * pack);
+
+/**
+ * Get an asset
+ * @param pack pointer to an opened pack or NULL to search in all packs, starting with the last opened one
+ * @param name name of the asset
+ * @param type type of the asset
+ * @param size store the size of the asset here (can be NULL)
+ * @return pointer to the data of the asset in the pack or NULL if not found
+ */
+const void * lv_asset_pack_get(const lv_asset_pack_t * pack, const char * name, lv_asset_type_t type, uint32_t * size);
+
+/**
+ * Get an image from a pack. The descriptor and the pixels are used in place, nothing is copied.
+ * @param pack pointer to an opened pack or NULL to search in all packs
+ * @param name name of the image
+ * @return an image descriptor to use as an image source or NULL if not found
+ */
+const lv_img_dsc_t * lv_asset_pack_get_img(const lv_asset_pack_t * pack, const char * name);
+
+/**
+ * Get a string from a pack
+ * @param pack pointer to an opened pack or NULL to search in all packs
+ * @param name name of the string
+ * @return the string or NULL if not found
+ */
+const char * lv_asset_pack_get_str(const lv_asset_pack_t * pack, const char * name);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_ASSET_PACK*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_ASSET_PACK_H*/
@@ -20,6 +20,9 @@
 /*********************
  *      DEFINES
  *********************/
+#define GLYPH_CACHE_BUCKET_CNT  64  /*Number of hash buckets of the glyph cache. Must be a power of 2.*/
+#define GLYPH_CACHE_BUCKET_ID(dsc, letter) \
+    (((letter) ^ (uint32_t)((lv_uintptr_t)(dsc) >> 4)) & (GLYPH_CACHE_BUCKET_CNT - 1))
 
 /**********************
  *      TYPEDEFS
@@ -45,12 +48,43 @@ typedef struct {
     uint16_t    height;
 } lv_font_fmt_ft_dsc_t;
 
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+typedef struct _glyph_cache_entry_t {
+    struct _glyph_cache_entry_t * bucket_next;  /*Next entry in the same hash bucket*/
+    struct _glyph_cache_entry_t * prev;         /*The more recently used neighbor*/
+    struct _glyph_cache_entry_t * next;         /*The less recently used neighbor*/
+    const lv_font_fmt_ft_dsc_t * dsc;
+    uint32_t letter;
+    uint32_t size;                              /*Size of the entry with the bitmap in bytes*/
+    uint16_t adv_w;
+    uint16_t box_w;
+    uint16_t box_h;
+    int16_t ofs_x;
+    int16_t ofs_y;
+    bool is_placeholder;
+    /*The A8 bitmap is stored right after the entry*/
+} glyph_cache_entry_t;
+
+typedef struct {
+    glyph_cache_entry_t * buckets[GLYPH_CACHE_BUCKET_CNT];
+    glyph_cache_entry_t * head;                 /*The most recently used entry*/
+    glyph_cache_entry_t * tail;                 /*The least recently used entry, dropped first*/
+    uint32_t size;                              /*Sum of the entry sizes*/
+    uint32_t glyph_cnt;
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+    uint32_t evict_cnt;
+} glyph_cache_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 #if LV_FREETYPE_CACHE_SIZE >= 0
 static FT_Error font_face_requester(FTC_FaceID face_id,
                                     FT_Library library_is, FT_Pointer req_data, FT_Face * aface);
+static bool get_glyph_dsc_cache(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter);
+static const uint8_t * get_glyph_bitmap_cache(const lv_font_t * font, int32_t * pitch, uint8_t * pixel_mode);
 static bool lv_ft_font_init_cache(lv_ft_info_t * info);
 static void lv_ft_font_destroy_cache(lv_font_t * font);
 #else
@@ -58,10 +92,25 @@ static FT_Face face_find_in_list(lv_ft_info_t * info);
 static void face_add_to_list(FT_Face face);
 static void face_remove_from_list(FT_Face face);
 static void face_generic_finalizer(void * object);
+static bool get_glyph_dsc_nocache(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter);
+static const uint8_t * get_glyph_bitmap_nocache(const lv_font_t * font, int32_t * pitch, uint8_t * pixel_mode);
 static bool lv_ft_font_init_nocache(lv_ft_info_t * info);
 static void lv_ft_font_destroy_nocache(lv_font_t * font);
 #endif
 
+static bool get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out,
+                             uint32_t unicode_letter, uint32_t unicode_letter_next);
+static const uint8_t * get_glyph_bitmap_cb(const lv_font_t * font, uint32_t unicode_letter);
+
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+static bool glyph_cache_get(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter);
+static glyph_cache_entry_t * glyph_cache_find(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode_letter);
+static void glyph_cache_drop(glyph_cache_entry_t * entry);
+static void glyph_cache_drop_font(const lv_font_fmt_ft_dsc_t * dsc);
+static bool bitmap_to_a8(const uint8_t * src, int32_t pitch, uint8_t pixel_mode, uint8_t * out,
+                         uint16_t w, uint16_t h);
+#endif
+
 static const char * name_refer_save(const char * name);
 static void name_refer_del(const char * name);
 static const char * name_refer_find(const char * name);
@@ -89,6 +138,10 @@ static lv_ll_t names_ll;
     static lv_faces_control_t face_control;
 #endif
 
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+    static glyph_cache_t glyph_cache;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -152,6 +205,9 @@ Fail:
 
 void lv_freetype_destroy(void)
 {
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+    glyph_cache_drop_font(NULL);
+#endif
 #if LV_FREETYPE_CACHE_SIZE >= 0
     FTC_Manager_Done(cache_manager);
 #endif
@@ -169,6 +225,9 @@ bool lv_ft_font_init(lv_ft_info_t * info)
 
 void lv_ft_font_destroy(lv_font_t * font)
 {
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+    if(font) glyph_cache_drop_font(font->dsc);
+#endif
 #if LV_FREETYPE_CACHE_SIZE >= 0
     lv_ft_font_destroy_cache(font);
 #else
@@ -176,6 +235,42 @@ void lv_ft_font_destroy(lv_font_t * font)
 #endif
 }
 
+const char * lv_ft_font_prewarm(const lv_font_t * font, const char * charset, uint32_t max_cnt)
+{
+    uint32_t i = 0;
+    uint32_t cnt = 0;
+    while(charset[i] != '\0' && (max_cnt == 0 || cnt < max_cnt)) {
+        uint32_t letter = _lv_txt_encoded_next(charset, &i);
+        lv_font_glyph_dsc_t g;
+        font->get_glyph_dsc(font, &g, letter, ' ');
+        cnt++;
+    }
+
+    return &charset[i];
+}
+
+void lv_ft_glyph_cache_get_stats(lv_ft_glyph_cache_stats_t * stats)
+{
+    lv_memset_00(stats, sizeof(lv_ft_glyph_cache_stats_t));
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+    stats->size = glyph_cache.size;
+    stats->max_size = LV_FREETYPE_GLYPH_CACHE_SIZE;
+    stats->glyph_cnt = glyph_cache.glyph_cnt;
+    stats->hit_cnt = glyph_cache.hit_cnt;
+    stats->miss_cnt = glyph_cache.miss_cnt;
+    stats->evict_cnt = glyph_cache.evict_cnt;
+#endif
+}
+
+void lv_ft_glyph_cache_reset_stats(void)
+{
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+    glyph_cache.hit_cnt = 0;
+    glyph_cache.miss_cnt = 0;
+    glyph_cache.evict_cnt = 0;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -232,20 +327,8 @@ static bool get_bold_glyph(const lv_font_t * font, FT_Face face,
     return true;
 }
 
-static bool get_glyph_dsc_cb_cache(const lv_font_t * font,
-                                   lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter, uint32_t unicode_letter_next)
+static bool get_glyph_dsc_cache(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter)
 {
-    LV_UNUSED(unicode_letter_next);
-    if(unicode_letter < 0x20) {
-        dsc_out->adv_w = 0;
-        dsc_out->box_h = 0;
-        dsc_out->box_w = 0;
-        dsc_out->ofs_x = 0;
-        dsc_out->ofs_y = 0;
-        dsc_out->bpp = 0;
-        return true;
-    }
-
     lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
 
     FTC_FaceID face_id = (FTC_FaceID)dsc;
@@ -279,7 +362,7 @@ static bool get_glyph_dsc_cb_cache(const lv_font_t * font,
             current_face = NULL;
             return false;
         }
-        goto end;
+        return true;
     }
 
     FTC_ImageTypeRec desc_type;
@@ -322,30 +405,36 @@ static bool get_glyph_dsc_cb_cache(const lv_font_t * font,
     dsc_out->bpp = 8;         /*Bit per pixel: 1/2/4/8*/
 #endif
 
-end:
-    if((dsc->style & FT_FONT_STYLE_ITALIC) && (unicode_letter_next == '\0')) {
-        dsc_out->adv_w = dsc_out->box_w + dsc_out->ofs_x;
-    }
-
     return true;
 }
 
-static const uint8_t * get_glyph_bitmap_cb_cache(const lv_font_t * font, uint32_t unicode_letter)
+/**
+ * Get the bitmap of the glyph loaded by the last `get_glyph_dsc_cache()`
+ * @param font pointer to a font
+ * @param pitch store the bytes per row of the bitmap here
+ * @param pixel_mode store the FreeType pixel mode of the bitmap here
+ * @return pointer to the bitmap or NULL on error
+ */
+static const uint8_t * get_glyph_bitmap_cache(const lv_font_t * font, int32_t * pitch, uint8_t * pixel_mode)
 {
-    LV_UNUSED(unicode_letter);
-
     lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
     if(dsc->style & FT_FONT_STYLE_BOLD) {
         if(current_face && current_face->glyph->format == FT_GLYPH_FORMAT_BITMAP) {
+            *pitch = current_face->glyph->bitmap.pitch;
+            *pixel_mode = current_face->glyph->bitmap.pixel_mode;
             return (const uint8_t *)(current_face->glyph->bitmap.buffer);
         }
         return NULL;
     }
 
 #if LV_FREETYPE_SBIT_CACHE
+    *pitch = sbit->pitch;
+    *pixel_mode = sbit->format;
     return (const uint8_t *)sbit->buffer;
 #else
     FT_BitmapGlyph glyph_bitmap = (FT_BitmapGlyph)image_glyph;
+    *pitch = glyph_bitmap->bitmap.pitch;
+    *pixel_mode = glyph_bitmap->bitmap.pixel_mode;
     return (const uint8_t *)glyph_bitmap->bitmap.buffer;
 #endif
 }
@@ -379,8 +468,8 @@ static bool lv_ft_font_init_cache(lv_ft_info_t * info)
 
     lv_font_t * font = dsc->font;
     font->dsc = dsc;
-    font->get_glyph_dsc = get_glyph_dsc_cb_cache;
-    font->get_glyph_bitmap = get_glyph_bitmap_cb_cache;
+    font->get_glyph_dsc = get_glyph_dsc_cb;
+    font->get_glyph_bitmap = get_glyph_bitmap_cb;
     font->subpx = LV_FONT_SUBPX_NONE;
     font->line_height = (face_size->face->size->metrics.height >> 6);
     font->base_line = -(face_size->face->size->metrics.descender >> 6);
@@ -457,20 +546,8 @@ static void face_generic_finalizer(void * object)
     LV_LOG_INFO("face finalizer(%p)\n", face);
 }
 
-static bool get_glyph_dsc_cb_nocache(const lv_font_t * font,
-                                     lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter, uint32_t unicode_letter_next)
+static bool get_glyph_dsc_nocache(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter)
 {
-    LV_UNUSED(unicode_letter_next);
-    if(unicode_letter < 0x20) {
-        dsc_out->adv_w = 0;
-        dsc_out->box_h = 0;
-        dsc_out->box_w = 0;
-        dsc_out->ofs_x = 0;
-        dsc_out->ofs_y = 0;
-        dsc_out->bpp = 0;
-        return true;
-    }
-
     FT_Error error;
     lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
     FT_Face face = dsc->size->face;
@@ -516,18 +593,22 @@ static bool get_glyph_dsc_cb_nocache(const lv_font_t * font,
                      face->glyph->bitmap.rows;         /*Y offset of the bitmap measured from the as line*/
     dsc_out->bpp = 8;         /*Bit per pixel: 1/2/4/8*/
 
-    if((dsc->style & FT_FONT_STYLE_ITALIC) && (unicode_letter_next == '\0')) {
-        dsc_out->adv_w = dsc_out->box_w + dsc_out->ofs_x;
-    }
-
     return true;
 }
 
-static const uint8_t * get_glyph_bitmap_cb_nocache(const lv_font_t * font, uint32_t unicode_letter)
+/**
+ * Get the bitmap of the glyph loaded by the last `get_glyph_dsc_nocache()`
+ * @param font pointer to a font
+ * @param pitch store the bytes per row of the bitmap here
+ * @param pixel_mode store the FreeType pixel mode of the bitmap here
+ * @return pointer to the bitmap
+ */
+static const uint8_t * get_glyph_bitmap_nocache(const lv_font_t * font, int32_t * pitch, uint8_t * pixel_mode)
 {
-    LV_UNUSED(unicode_letter);
     lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
     FT_Face face = dsc->size->face;
+    *pitch = face->glyph->bitmap.pitch;
+    *pixel_mode = face->glyph->bitmap.pixel_mode;
     return (const uint8_t *)(face->glyph->bitmap.buffer);
 }
 
@@ -579,8 +660,8 @@ static bool lv_ft_font_init_nocache(lv_ft_info_t * info)
 
     lv_font_t * font = dsc->font;
     font->dsc = dsc;
-    font->get_glyph_dsc = get_glyph_dsc_cb_nocache;
-    font->get_glyph_bitmap = get_glyph_bitmap_cb_nocache;
+    font->get_glyph_dsc = get_glyph_dsc_cb;
+    font->get_glyph_bitmap = get_glyph_bitmap_cb;
     font->line_height = (face->size->metrics.height >> 6);
     font->base_line = -(face->size->metrics.descender >> 6);
     font->subpx = LV_FONT_SUBPX_NONE;
@@ -616,6 +697,262 @@ static void lv_ft_font_destroy_nocache(lv_font_t * font)
 
 #endif/* LV_FREETYPE_CACHE_SIZE */
 
+static bool get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out,
+                             uint32_t unicode_letter, uint32_t unicode_letter_next)
+{
+    if(unicode_letter < 0x20) {
+        dsc_out->adv_w = 0;
+        dsc_out->box_h = 0;
+        dsc_out->box_w = 0;
+        dsc_out->ofs_x = 0;
+        dsc_out->ofs_y = 0;
+        dsc_out->bpp = 0;
+        return true;
+    }
+
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+    if(!glyph_cache_get(font, dsc_out, unicode_letter)) return false;
+#elif LV_FREETYPE_CACHE_SIZE >= 0
+    if(!get_glyph_dsc_cache(font, dsc_out, unicode_letter)) return false;
+#else
+    if(!get_glyph_dsc_nocache(font, dsc_out, unicode_letter)) return false;
+#endif
+
+    lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
+    if((dsc->style & FT_FONT_STYLE_ITALIC) && (unicode_letter_next == '\0')) {
+        dsc_out->adv_w = dsc_out->box_w + dsc_out->ofs_x;
+    }
+
+    return true;
+}
+
+static const uint8_t * get_glyph_bitmap_cb(const lv_font_t * font, uint32_t unicode_letter)
+{
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+    glyph_cache_entry_t * entry = glyph_cache_find(font->dsc, unicode_letter);
+    if(entry) return (const uint8_t *)(entry + 1);
+#else
+    LV_UNUSED(unicode_letter);
+#endif
+
+    /*Not cached: use the glyph loaded by the last `get_glyph_dsc_cb()`*/
+    int32_t pitch;
+    uint8_t pixel_mode;
+#if LV_FREETYPE_CACHE_SIZE >= 0
+    return get_glyph_bitmap_cache(font, &pitch, &pixel_mode);
+#else
+    return get_glyph_bitmap_nocache(font, &pitch, &pixel_mode);
+#endif
+}
+
+#if LV_FREETYPE_GLYPH_CACHE_SIZE > 0
+
+/**
+ * Get the descriptor of a glyph from the glyph cache.
+ * If it's not cached yet, render it, convert it to A8 and drop the least recently used glyphs to make room for it.
+ * @param font pointer to a font
+ * @param dsc_out store the glyph descriptor here
+ * @param unicode_letter the letter (>= 0x20)
+ * @return true: the descriptor is found; false: error
+ */
+static bool glyph_cache_get(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter)
+{
+    lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
+    glyph_cache_entry_t * entry = glyph_cache_find(dsc, unicode_letter);
+    if(entry) {
+        glyph_cache.hit_cnt++;
+        dsc_out->adv_w = entry->adv_w;
+        dsc_out->box_w = entry->box_w;
+        dsc_out->box_h = entry->box_h;
+        dsc_out->ofs_x = entry->ofs_x;
+        dsc_out->ofs_y = entry->ofs_y;
+        dsc_out->bpp = 8;
+        dsc_out->is_placeholder = entry->is_placeholder;
+        return true;
+    }
+
+    glyph_cache.miss_cnt++;
+#if LV_FREETYPE_CACHE_SIZE >= 0
+    if(!get_glyph_dsc_cache(font, dsc_out, unicode_letter)) return false;
+#else
+    if(!get_glyph_dsc_nocache(font, dsc_out, unicode_letter)) return false;
+#endif
+
+    /*If the glyph can't be cached, its bitmap is get directly from FreeType*/
+    uint32_t px_cnt = (uint32_t)dsc_out->box_w * dsc_out->box_h;
+    const uint8_t * bitmap = NULL;
+    int32_t pitch = 0;
+    uint8_t pixel_mode = FT_PIXEL_MODE_GRAY;
+    if(px_cnt) {
+#if LV_FREETYPE_CACHE_SIZE >= 0
+        bitmap = get_glyph_bitmap_cache(font, &pitch, &pixel_mode);
+#else
+        bitmap = get_glyph_bitmap_nocache(font, &pitch, &pixel_mode);
+#endif
+        if(bitmap == NULL) return true;
+    }
+
+    uint32_t size = sizeof(glyph_cache_entry_t) + px_cnt;
+    if(size > LV_FREETYPE_GLYPH_CACHE_SIZE) return true;
+
+    while(glyph_cache.size + size > LV_FREETYPE_GLYPH_CACHE_SIZE) {
+        glyph_cache_drop(glyph_cache.tail);
+        glyph_cache.evict_cnt++;
+    }
+
+    entry = lv_mem_alloc(size);
+    if(entry == NULL) return true;
+
+    if(px_cnt && !bitmap_to_a8(bitmap, pitch, pixel_mode, (uint8_t *)(entry + 1), dsc_out->box_w, dsc_out->box_h)) {
+        lv_mem_free(entry);
+        return true;
+    }
+
+    entry->dsc = dsc;
+    entry->letter = unicode_letter;
+    entry->size = size;
+    entry->adv_w = dsc_out->adv_w;
+    entry->box_w = dsc_out->box_w;
+    entry->box_h = dsc_out->box_h;
+    entry->ofs_x = dsc_out->ofs_x;
+    entry->ofs_y = dsc_out->ofs_y;
+    entry->is_placeholder = dsc_out->is_placeholder;
+
+    uint32_t bucket_id = GLYPH_CACHE_BUCKET_ID(dsc, unicode_letter);
+    entry->bucket_next = glyph_cache.buckets[bucket_id];
+    glyph_cache.buckets[bucket_id] = entry;
+
+    entry->prev = NULL;
+    entry->next = glyph_cache.head;
+    if(glyph_cache.head) glyph_cache.head->prev = entry;
+    else glyph_cache.tail = entry;
+    glyph_cache.head = entry;
+    glyph_cache.size += size;
+    glyph_cache.glyph_cnt++;
+
+    return true;
+}
+
+/**
+ * Find a glyph in the glyph cache and make it the most recently used
+ * @param dsc pointer to a FreeType font descriptor
+ * @param unicode_letter the letter
+ * @return pointer to the entry or NULL if not cached
+ */
+static glyph_cache_entry_t * glyph_cache_find(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode_letter)
+{
+    uint32_t bucket_id = GLYPH_CACHE_BUCKET_ID(dsc, unicode_letter);
+    glyph_cache_entry_t * entry;
+    for(entry = glyph_cache.buckets[bucket_id]; entry; entry = entry->bucket_next) {
+        if(entry->letter == unicode_letter && entry->dsc == dsc) break;
+    }
+
+    /*Move it to the front of the LRU list*/
+    if(entry && entry != glyph_cache.head) {
+        entry->prev->next = entry->next;
+        if(entry->next) entry->next->prev = entry->prev;
+        else glyph_cache.tail = entry->prev;
+
+        entry->prev = NULL;
+        entry->next = glyph_cache.head;
+        glyph_cache.head->prev = entry;
+        glyph_cache.head = entry;
+    }
+
+    return entry;
+}
+
+/**
+ * Remove an entry from the glyph cache and free it
+ * @param entry pointer to an entry of the cache
+ */
+static void glyph_cache_drop(glyph_cache_entry_t * entry)
+{
+    uint32_t bucket_id = GLYPH_CACHE_BUCKET_ID(entry->dsc, entry->letter);
+    glyph_cache_entry_t ** link = &glyph_cache.buckets[bucket_id];
+    while(*link != entry) link = &(*link)->bucket_next;
+    *link = entry->bucket_next;
+
+    if(entry->prev) entry->prev->next = entry->next;
+    else glyph_cache.head = entry->next;
+    if(entry->next) entry->next->prev = entry->prev;
+    else glyph_cache.tail = entry->prev;
+
+    glyph_cache.size -= entry->size;
+    glyph_cache.glyph_cnt--;
+    lv_mem_free(entry);
+}
+
+/**
+ * Remove the glyphs of a font from the glyph cache
+ * @param dsc pointer to a FreeType font descriptor or NULL to remove all glyphs
+ */
+static void glyph_cache_drop_font(const lv_font_fmt_ft_dsc_t * dsc)
+{
+    glyph_cache_entry_t * entry = glyph_cache.head;
+    while(entry) {
+        glyph_cache_entry_t * next = entry->next;
+        if(dsc == NULL || entry->dsc == dsc) glyph_cache_drop(entry);
+        entry = next;
+    }
+}
+
+/**
+ * Convert a FreeType bitmap to a continuous A8 bitmap
+ * @param src the FreeType bitmap
+ * @param pitch bytes per row, negative if the rows are stored from the bottom
+ * @param pixel_mode the FreeType pixel mode
+ * @param out store the A8 bitmap here (`w * h` bytes)
+ * @param w width of the bitmap
+ * @param h height of the bitmap
+ * @return true: converted; false: unsupported pixel mode
+ */
+static bool bitmap_to_a8(const uint8_t * src, int32_t pitch, uint8_t pixel_mode, uint8_t * out,
+                         uint16_t w, uint16_t h)
+{
+    uint8_t bpp;
+    switch(pixel_mode) {
+        case FT_PIXEL_MODE_MONO:
+            bpp = 1;
+            break;
+        case FT_PIXEL_MODE_GRAY2:
+            bpp = 2;
+            break;
+        case FT_PIXEL_MODE_GRAY4:
+            bpp = 4;
+            break;
+        case FT_PIXEL_MODE_GRAY:
+            bpp = 8;
+            break;
+        default:
+            return false;
+    }
+
+    const uint8_t * row = pitch < 0 ? src - (int32_t)(h - 1) * pitch : src;
+    uint16_t y;
+    for(y = 0; y < h; y++) {
+        if(bpp == 8) {
+            lv_memcpy(out, row, w);
+        }
+        else {
+            uint8_t mask = (1 << bpp) - 1;
+            uint8_t mul = 255 / mask;
+            uint16_t x;
+            for(x = 0; x < w; x++) {
+                uint32_t bit = (uint32_t)x * bpp;
+                uint8_t v = (row[bit >> 3] >> (8 - bpp - (bit & 0x7))) & mask;
+                out[x] = v * mul;
+            }
+        }
+        out += w;
+        row += pitch;
+    }
+
+    return true;
+}
+
+#endif /*LV_FREETYPE_GLYPH_CACHE_SIZE > 0*/
+
 /**
  * find name string in names list.name string cnt += 1 if find.
  * @param name name string
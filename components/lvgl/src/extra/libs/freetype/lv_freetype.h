@@ -37,6 +37,16 @@ typedef struct {
     uint16_t style;     /* font style */
 } lv_ft_info_t;
 
+/** Statistics of the A8 glyph cache (`LV_FREETYPE_GLYPH_CACHE_SIZE`)*/
+typedef struct {
+    uint32_t size;          /**< Bytes used by the cached glyphs*/
+    uint32_t max_size;      /**< The byte budget of the cache*/
+    uint32_t glyph_cnt;     /**< Number of cached glyphs*/
+    uint32_t hit_cnt;       /**< Number of glyphs found in the cache*/
+    uint32_t miss_cnt;      /**< Number of glyphs rendered by FreeType*/
+    uint32_t evict_cnt;     /**< Number of glyphs dropped to make room for new ones*/
+} lv_ft_glyph_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -70,6 +80,27 @@ bool lv_ft_font_init(lv_ft_info_t * info);
  */
 void lv_ft_font_destroy(lv_font_t * font);
 
+/**
+ * Render the glyphs of a charset in advance to have them in the caches when they are drawn.
+ * Can be called at startup or in parts in idle time (e.g. from a timer).
+ * @param font pointer to a FreeType font
+ * @param charset UTF-8 string with the letters to render
+ * @param max_cnt render at most this many letters. 0: render all of them
+ * @return pointer to the not processed part of `charset`. Points to the closing `'\0'` when all letters are rendered.
+ */
+const char * lv_ft_font_prewarm(const lv_font_t * font, const char * charset, uint32_t max_cnt);
+
+/**
+ * Get the statistics of the A8 glyph cache
+ * @param stats store the statistics here. All fields are 0 if the glyph cache is disabled.
+ */
+void lv_ft_glyph_cache_get_stats(lv_ft_glyph_cache_stats_t * stats);
+
+/**
+ * Reset the hit, miss and evict counters of the A8 glyph cache
+ */
+void lv_ft_glyph_cache_reset_stats(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -2,6 +2,7 @@
 #include "../../../misc/lv_log.h"
 #include "../../../misc/lv_mem.h"
 #include "../../../misc/lv_color.h"
+#include "../../../draw/lv_img_buf.h"
 #if LV_USE_GIF
 
 #include <stdlib.h>
@@ -11,23 +12,25 @@
 #define MIN(A, B) ((A) < (B) ? (A) : (B))
 #define MAX(A, B) ((A) > (B) ? (A) : (B))
 
-typedef struct Entry {
-    uint16_t length;
-    uint16_t prefix;
-    uint8_t  suffix;
-} Entry;
-
-typedef struct Table {
-    int bulk;
-    int nentries;
-    Entry *entries;
-} Table;
+/* Flat LZW code table and buffers of the decoder. It's a temporary buffer used while a frame is decoded. */
+typedef struct Lzw {
+    uint16_t prefix[0x1000];    /* The code of the string without the last index. 0xFFF for the roots */
+    uint8_t suffix[0x1000];     /* The last index of the string */
+    uint8_t stack[0x1000];      /* A string of the table in output order */
+    uint8_t block[0xFF];        /* The current data sub-block */
+    uint8_t block_len;
+    uint8_t block_pos;
+    uint8_t ended;              /* The block terminator was read */
+    uint8_t bit_cnt;
+    uint32_t bits;
+} Lzw;
 
 static gd_GIF *  gif_open(gd_GIF * gif);
 static bool f_gif_open(gd_GIF * gif, const void * path, bool is_file);
 static void f_gif_read(gd_GIF * gif, void * buf, size_t len);
 static int f_gif_seek(gd_GIF * gif, size_t pos, int k);
 static void f_gif_close(gd_GIF * gif);
+static void discard_sub_blocks(gd_GIF *gif);
 
 static uint16_t
 read_num(gd_GIF * gif)
@@ -65,14 +68,83 @@ gd_open_gif_data(const void *data)
     return gif_open(&gif_base);
 }
 
+static void
+read_palette(gd_GIF *gif, gd_Palette *palette, int size)
+{
+    uint8_t rgb[0x100 * 3];
+    int i;
+
+    f_gif_read(gif, rgb, 3 * size);
+    palette->size = size;
+    for (i = 0; i < size; i++)
+        palette->colors[i] = lv_color_make(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+}
+
+/* Check whether a frame uses transparency, so the canvas needs an alpha channel.
+ * The read position is restored. */
+static bool
+has_transparency(gd_GIF *gif)
+{
+    uint8_t sep, label, byte;
+    uint8_t desc[9];
+    bool found = false;
+    size_t start = f_gif_seek(gif, 0, LV_FS_SEEK_CUR);
+
+    while (!found) {
+        sep = 0;
+        f_gif_read(gif, &sep, 1);
+        if (sep == '!') {
+            label = 0;
+            f_gif_read(gif, &label, 1);
+            if (label == 0xF9) {
+                /* Block size and packed fields of the Graphic Control Extension */
+                f_gif_read(gif, &byte, 1);
+                f_gif_read(gif, &byte, 1);
+                found = byte & 1;
+                f_gif_seek(gif, 3, LV_FS_SEEK_CUR);
+            }
+            discard_sub_blocks(gif);
+        } else if (sep == ',') {
+            /* Image Descriptor, Local Color Table, LZW Minimum Code Size and the image data */
+            f_gif_read(gif, desc, 9);
+            if (desc[8] & 0x80)
+                f_gif_seek(gif, 3 * (1 << ((desc[8] & 0x07) + 1)), LV_FS_SEEK_CUR);
+            f_gif_seek(gif, 1, LV_FS_SEEK_CUR);
+            discard_sub_blocks(gif);
+        } else break;
+    }
+
+    f_gif_seek(gif, start, LV_FS_SEEK_SET);
+    return found;
+}
+
+/* Set a pixel of the canvas */
+static inline void
+canvas_set_px(gd_GIF *gif, uint32_t i, lv_color_t c, uint8_t opa)
+{
+#if LV_COLOR_DEPTH == 32
+    c.ch.alpha = opa;
+    ((lv_color_t *) gif->canvas)[i] = c;
+#elif LV_COLOR_DEPTH == 16
+    ((lv_color_t *) gif->canvas)[i] = c;
+    if (gif->alpha) gif->alpha[i] = opa;
+#else
+    if (gif->has_alpha) {
+        gif->canvas[i * 2] = c.full;
+        gif->canvas[i * 2 + 1] = opa;
+    } else gif->canvas[i] = c.full;
+#endif
+}
+
 static gd_GIF * gif_open(gd_GIF * gif_base)
 {
     uint8_t sigver[3];
     uint16_t width, height, depth;
     uint8_t fdsz, bgidx, aspect;
-    int i;
-    uint8_t *bgcolor;
+    uint32_t i;
+    lv_color_t bgcolor;
     int gct_sz;
+    uint32_t px_size;
     gd_GIF *gif = NULL;
 
     /* Header */
@@ -106,59 +178,27 @@ static gd_GIF * gif_open(gd_GIF * gif_base)
     f_gif_read(gif_base, &bgidx, 1);
     /* Aspect Ratio */
     f_gif_read(gif_base, &aspect, 1);
+    /* Read GCT */
+    read_palette(gif_base, &gif_base->gct, gct_sz);
+    /* Alpha channel is needed only if there is transparency */
+    gif_base->has_alpha = has_transparency(gif_base);
+    px_size = gif_base->has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
     /* Create gd_GIF Structure. */
-#if LV_COLOR_DEPTH == 32
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 5 * width * height);
-#elif LV_COLOR_DEPTH == 16
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 4 * width * height);
-#elif LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 3 * width * height);
-#endif
-
+    gif = lv_mem_alloc(sizeof(gd_GIF) + px_size * width * height);
     if (!gif) goto fail;
     memcpy(gif, gif_base, sizeof(gd_GIF));
     gif->width  = width;
     gif->height = height;
     gif->depth  = depth;
-    /* Read GCT */
-    gif->gct.size = gct_sz;
-    f_gif_read(gif, gif->gct.colors, 3 * gif->gct.size);
     gif->palette = &gif->gct;
     gif->bgindex = bgidx;
     gif->canvas = (uint8_t *) &gif[1];
-#if LV_COLOR_DEPTH == 32
-    gif->frame = &gif->canvas[4 * width * height];
-#elif LV_COLOR_DEPTH == 16
-    gif->frame = &gif->canvas[3 * width * height];
-#elif LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
-    gif->frame = &gif->canvas[2 * width * height];
+#if LV_COLOR_DEPTH == 16
+    if (gif->has_alpha) gif->alpha = &gif->canvas[sizeof(lv_color_t) * width * height];
 #endif
-    if (gif->bgindex) {
-        memset(gif->frame, gif->bgindex, gif->width * gif->height);
-    }
-    bgcolor = &gif->palette->colors[gif->bgindex*3];
-
-    for (i = 0; i < gif->width * gif->height; i++) {
-#if LV_COLOR_DEPTH == 32
-        gif->canvas[i*4 + 0] = *(bgcolor + 2);
-        gif->canvas[i*4 + 1] = *(bgcolor + 1);
-        gif->canvas[i*4 + 2] = *(bgcolor + 0);
-        gif->canvas[i*4 + 3] = 0xff;
-#elif LV_COLOR_DEPTH == 16
-        lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-        gif->canvas[i*3 + 0] = c.full & 0xff;
-        gif->canvas[i*3 + 1] = (c.full >> 8) & 0xff;
-        gif->canvas[i*3 + 2] = 0xff;
-#elif LV_COLOR_DEPTH == 8
-        lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-        gif->canvas[i*2 + 0] = c.full;
-        gif->canvas[i*2 + 1] = 0xff;
-#elif LV_COLOR_DEPTH == 1
-        lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-        gif->canvas[i*2 + 0] = c.ch.red > 128 ? 1 : 0;
-        gif->canvas[i*2 + 1] = 0xff;
-#endif
-    }
+    bgcolor = bgidx < gif->gct.size ? gif->gct.colors[bgidx] : lv_color_black();
+    for (i = 0; i < (uint32_t) width * height; i++)
+        canvas_set_px(gif, i, bgcolor, 0xff);
     gif->anim_start = f_gif_seek(gif, 0, LV_FS_SEEK_CUR);
     gif->loop_count = -1;
     goto ok;
@@ -174,6 +214,7 @@ discard_sub_blocks(gd_GIF *gif)
     uint8_t size;
 
     do {
+        size = 0;
         f_gif_read(gif, &size, 1);
         f_gif_seek(gif, size, LV_FS_SEEK_CUR);
     } while (size);
@@ -296,70 +337,30 @@ read_ext(gd_GIF *gif)
     }
 }
 
-static Table *
-new_table(int key_size)
-{
-    int key;
-    int init_bulk = MAX(1 << (key_size + 1), 0x100);
-    Table *table = lv_mem_alloc(sizeof(*table) + sizeof(Entry) * init_bulk);
-    if (table) {
-        table->bulk = init_bulk;
-        table->nentries = (1 << key_size) + 2;
-        table->entries = (Entry *) &table[1];
-        for (key = 0; key < (1 << key_size); key++)
-            table->entries[key] = (Entry) {1, 0xFFF, key};
-    }
-    return table;
-}
-
-/* Add table entry. Return value:
- *  0 on success
- *  +1 if key size must be incremented after this addition
- *  -1 if could not realloc table */
-static int
-add_entry(Table **tablep, uint16_t length, uint16_t prefix, uint8_t suffix)
-{
-    Table *table = *tablep;
-    if (table->nentries == table->bulk) {
-        table->bulk *= 2;
-        table = lv_mem_realloc(table, sizeof(*table) + sizeof(Entry) * table->bulk);
-        if (!table) return -1;
-        table->entries = (Entry *) &table[1];
-        *tablep = table;
-    }
-    table->entries[table->nentries] = (Entry) {length, prefix, suffix};
-    table->nentries++;
-    if ((table->nentries & (table->nentries - 1)) == 0)
-        return 1;
-    return 0;
-}
-
+/* Read the next code from the data sub-blocks. Return 0x1000 at the end of the data. */
 static uint16_t
-get_key(gd_GIF *gif, int key_size, uint8_t *sub_len, uint8_t *shift, uint8_t *byte)
+get_key(gd_GIF *gif, Lzw *lzw, int key_size)
 {
-    int bits_read;
-    int rpad;
-    int frag_size;
     uint16_t key;
 
-    key = 0;
-    for (bits_read = 0; bits_read < key_size; bits_read += frag_size) {
-        rpad = (*shift + bits_read) % 8;
-        if (rpad == 0) {
-            /* Update byte. */
-            if (*sub_len == 0) {
-                f_gif_read(gif, sub_len, 1); /* Must be nonzero! */
-                if (*sub_len == 0) return 0x1000;
+    while (lzw->bit_cnt < key_size) {
+        if (lzw->block_pos == lzw->block_len) {
+            /* Read a whole sub-block at once */
+            lzw->block_len = 0;
+            lzw->block_pos = 0;
+            if (!lzw->ended) f_gif_read(gif, &lzw->block_len, 1);
+            if (lzw->block_len == 0) {
+                lzw->ended = 1;
+                return 0x1000;
             }
-            f_gif_read(gif, byte, 1);
-            (*sub_len)--;
+            f_gif_read(gif, lzw->block, lzw->block_len);
         }
-        frag_size = MIN(key_size - bits_read, 8 - rpad);
-        key |= ((uint16_t) ((*byte) >> rpad)) << bits_read;
+        lzw->bits |= (uint32_t) lzw->block[lzw->block_pos++] << lzw->bit_cnt;
+        lzw->bit_cnt += 8;
     }
-    /* Clear extra bits to the left. */
-    key &= (1 << key_size) - 1;
-    *shift = (*shift + key_size) % 8;
+    key = lzw->bits & ((1 << key_size) - 1);
+    lzw->bits >>= key_size;
+    lzw->bit_cnt -= key_size;
     return key;
 }
 
@@ -385,77 +386,112 @@ interlaced_line_index(int h, int y)
     return y * 2 + 1;
 }
 
-/* Decompress image pixels.
+/* Decompress image pixels directly into the canvas.
  * Return 0 on success or -1 on out-of-memory (w.r.t. LZW code table). */
 static int
 read_image_data(gd_GIF *gif, int interlace)
 {
-    uint8_t sub_len, shift, byte;
-    int init_key_size, key_size, table_is_full=0;
-    int frm_off, frm_size, str_len=0, i, p, x, y;
-    uint16_t key, clear, stop;
-    int ret;
-    Table *table;
-    Entry entry = {0};
-    size_t start, end;
+    uint8_t byte;
+    int init_key_size, key_size;
+    uint16_t key, clear, stop, next, prev, code;
+    uint8_t first = 0;
+    int str_len, i, x, y, vis_w, row_w;
+    uint32_t row;
+    uint8_t tindex = gif->gce.tindex;
+    bool transparency = gif->gce.transparency;
+    lv_color_t *colors = gif->palette->colors;
+    Lzw *lzw;
 
     f_gif_read(gif, &byte, 1);
-    key_size = (int) byte;
-    start = f_gif_seek(gif, 0, LV_FS_SEEK_CUR);
-    discard_sub_blocks(gif);
-    end = f_gif_seek(gif, 0, LV_FS_SEEK_CUR);
-    f_gif_seek(gif, start, LV_FS_SEEK_SET);
+    key_size = MIN((int) byte, 11);
+    lzw = lv_mem_buf_get(sizeof(Lzw));
+    if (!lzw) {
+        discard_sub_blocks(gif);
+        return -1;
+    }
+    lzw->block_len = lzw->block_pos = 0;
+    lzw->ended = 0;
+    lzw->bit_cnt = 0;
+    lzw->bits = 0;
+
     clear = 1 << key_size;
     stop = clear + 1;
-    table = new_table(key_size);
+    for (i = 0; i < clear; i++) {
+        lzw->prefix[i] = 0xFFF;
+        lzw->suffix[i] = i;
+    }
     key_size++;
     init_key_size = key_size;
-    sub_len = shift = 0;
-    key = get_key(gif, key_size, &sub_len, &shift, &byte); /* clear code */
-    frm_off = 0;
-    ret = 0;
-    frm_size = gif->fw*gif->fh;
-    while (frm_off < frm_size) {
+    next = clear + 2;
+    prev = 0xFFF;
+
+    /* The visible part of the frame's rows */
+    vis_w = gif->fx < gif->width ? MIN(gif->fw, gif->width - gif->fx) : 0;
+    x = 0;
+    y = 0;
+    row = (uint32_t) gif->fy * gif->width + gif->fx;
+    row_w = gif->fy < gif->height ? vis_w : 0;
+
+    while (y < gif->fh) {
+        key = get_key(gif, lzw, key_size);
         if (key == clear) {
             key_size = init_key_size;
-            table->nentries = (1 << (key_size - 1)) + 2;
-            table_is_full = 0;
-        } else if (!table_is_full) {
-            ret = add_entry(&table, str_len + 1, key, entry.suffix);
-            if (ret == -1) {
-                lv_mem_free(table);
-                return -1;
-            }
-            if (table->nentries == 0x1000) {
-                ret = 0;
-                table_is_full = 1;
-            }
+            next = clear + 2;
+            prev = 0xFFF;
+            continue;
         }
-        key = get_key(gif, key_size, &sub_len, &shift, &byte);
-        if (key == clear) continue;
         if (key == stop || key == 0x1000) break;
-        if (ret == 1) key_size++;
-        entry = table->entries[key];
-        str_len = entry.length;
-        for (i = 0; i < str_len; i++) {
-            p = frm_off + entry.length - 1;
-            x = p % gif->fw;
-            y = p / gif->fw;
-            if (interlace)
-                y = interlaced_line_index((int) gif->fh, y);
-            gif->frame[(gif->fy + y) * gif->width + gif->fx + x] = entry.suffix;
-            if (entry.prefix == 0xFFF)
-                break;
-            else
-                entry = table->entries[entry.prefix];
+
+        if (prev == 0xFFF) {
+            /* The first code after a clear is a root */
+            if (key >= clear) break;
+            code = key;
+        } else if (key < next) {
+            code = key;
+        } else if (key == next && next < 0x1000) {
+            /* The string of the previous code and its first index */
+            code = prev;
+        } else break;
+
+        /* Put the string on the stack in output order */
+        str_len = 0;
+        if (key == next) lzw->stack[0x1000 - ++str_len] = first;
+        while (1) {
+            lzw->stack[0x1000 - ++str_len] = lzw->suffix[code];
+            if (lzw->prefix[code] == 0xFFF || str_len == 0x1000) break;
+            code = lzw->prefix[code];
+        }
+        first = lzw->suffix[code];
+
+        if (prev != 0xFFF && next < 0x1000) {
+            lzw->prefix[next] = prev;
+            lzw->suffix[next] = first;
+            next++;
+            if (next == (1 << key_size) && key_size < 12) key_size++;
+        }
+        prev = key;
+
+        for (i = 0x1000 - str_len; i < 0x1000 && y < gif->fh; i++) {
+            byte = lzw->stack[i];
+            if (x < row_w && (!transparency || byte != tindex))
+                canvas_set_px(gif, row + x, colors[byte], 0xff);
+            x++;
+            if (x == gif->fw) {
+                x = 0;
+                y++;
+                if (y < gif->fh) {
+                    int line = interlace ? interlaced_line_index((int) gif->fh, y) : y;
+                    /* Rows out of the canvas are decoded but not drawn */
+                    row = (uint32_t) (gif->fy + line) * gif->width + gif->fx;
+                    row_w = gif->fy + line < gif->height ? vis_w : 0;
+                }
+            }
         }
-        frm_off += str_len;
-        if (key < table->nentries - 1 && !table_is_full)
-            table->entries[table->nentries - 1].suffix = entry.suffix;
     }
-    lv_mem_free(table);
-    if (key == stop) f_gif_read(gif, &sub_len, 1); /* Must be zero! */
-    f_gif_seek(gif, end, LV_FS_SEEK_SET);
+
+    /* Skip the rest of the sub-blocks */
+    if (!lzw->ended) discard_sub_blocks(gif);
+    lv_mem_buf_release(lzw);
     return 0;
 }
 
@@ -478,8 +514,7 @@ read_image(gd_GIF *gif)
     /* Local Color Table? */
     if (fisrz & 0x80) {
         /* Read LCT */
-        gif->lct.size = 1 << ((fisrz & 0x07) + 1);
-        f_gif_read(gif, gif->lct.colors, 3 * gif->lct.size);
+        read_palette(gif, &gif->lct, 1 << ((fisrz & 0x07) + 1));
         gif->palette = &gif->lct;
     } else
         gif->palette = &gif->gct;
@@ -487,85 +522,36 @@ read_image(gd_GIF *gif)
     return read_image_data(gif, interlace);
 }
 
+/* Dispose the previous frame. The frames are decoded into the canvas so only
+ * restoring to the background color changes the canvas. */
 static void
-render_frame_rect(gd_GIF *gif, uint8_t *buffer)
+dispose(gd_GIF *gif, const gd_GCE *gce)
 {
-    int i, j, k;
-    uint8_t index, *color;
-    i = gif->fy * gif->width + gif->fx;
-    for (j = 0; j < gif->fh; j++) {
-        for (k = 0; k < gif->fw; k++) {
-            index = gif->frame[(gif->fy + j) * gif->width + gif->fx + k];
-            color = &gif->palette->colors[index*3];
-            if (!gif->gce.transparency || index != gif->gce.tindex) {
-#if LV_COLOR_DEPTH == 32
-                buffer[(i+k)*4 + 0] = *(color + 2);
-                buffer[(i+k)*4 + 1] = *(color + 1);
-                buffer[(i+k)*4 + 2] = *(color + 0);
-                buffer[(i+k)*4 + 3] = 0xFF;
-#elif LV_COLOR_DEPTH == 16
-                lv_color_t c = lv_color_make(*(color + 0), *(color + 1), *(color + 2));
-                buffer[(i+k)*3 + 0] = c.full & 0xff;
-                buffer[(i+k)*3 + 1] = (c.full >> 8) & 0xff;
-                buffer[(i+k)*3 + 2] = 0xff;
-#elif LV_COLOR_DEPTH == 8
-                lv_color_t c = lv_color_make(*(color + 0), *(color + 1), *(color + 2));
-                buffer[(i+k)*2 + 0] = c.full;
-                buffer[(i+k)*2 + 1] = 0xff;
-#elif LV_COLOR_DEPTH == 1
-                uint8_t b = (*(color + 0)) | (*(color + 1)) | (*(color + 2));
-                buffer[(i+k)*2 + 0] = b > 128 ? 1 : 0;
-                buffer[(i+k)*2 + 1] = 0xff;
-#endif
-            }
-        }
-        i += gif->width;
-    }
-}
+    int j, k;
+    uint32_t i;
+    lv_color_t bgcolor;
+    uint8_t opa;
+    int w, h;
 
-static void
-dispose(gd_GIF *gif)
-{
-    int i, j, k;
-    uint8_t *bgcolor;
-    switch (gif->gce.disposal) {
+    switch (gce->disposal) {
     case 2: /* Restore to background color. */
-        bgcolor = &gif->palette->colors[gif->bgindex*3];
-
-        uint8_t opa = 0xff;
-        if(gif->gce.transparency) opa = 0x00;
-
-        i = gif->fy * gif->width + gif->fx;
-        for (j = 0; j < gif->fh; j++) {
-            for (k = 0; k < gif->fw; k++) {
-#if LV_COLOR_DEPTH == 32
-                gif->canvas[(i+k)*4 + 0] = *(bgcolor + 2);
-                gif->canvas[(i+k)*4 + 1] = *(bgcolor + 1);
-                gif->canvas[(i+k)*4 + 2] = *(bgcolor + 0);
-                gif->canvas[(i+k)*4 + 3] = opa;
-#elif LV_COLOR_DEPTH == 16
-                lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-                gif->canvas[(i+k)*3 + 0] = c.full & 0xff;
-                gif->canvas[(i+k)*3 + 1] = (c.full >> 8) & 0xff;
-                gif->canvas[(i+k)*3 + 2] = opa;
-#elif LV_COLOR_DEPTH == 8
-                lv_color_t c = lv_color_make(*(bgcolor + 0), *(bgcolor + 1), *(bgcolor + 2));
-                gif->canvas[(i+k)*2 + 0] = c.full;
-                gif->canvas[(i+k)*2 + 1] = opa;
-#elif LV_COLOR_DEPTH == 1
-                uint8_t b = (*(bgcolor + 0)) | (*(bgcolor + 1)) | (*(bgcolor + 2));
-                gif->canvas[(i+k)*2 + 0] = b > 128 ? 1 : 0;
-                gif->canvas[(i+k)*2 + 1] = opa;
-#endif
-            }
+        bgcolor = gif->bgindex < gif->palette->size ? gif->palette->colors[gif->bgindex] : lv_color_black();
+        opa = gce->transparency ? 0x00 : 0xff;
+        w = gif->fx < gif->width ? MIN(gif->fw, gif->width - gif->fx) : 0;
+        h = gif->fy < gif->height ? MIN(gif->fh, gif->height - gif->fy) : 0;
+
+        i = (uint32_t) gif->fy * gif->width + gif->fx;
+        for (j = 0; j < h; j++) {
+            for (k = 0; k < w; k++)
+                canvas_set_px(gif, i + k, bgcolor, opa);
             i += gif->width;
         }
         break;
     case 3: /* Restore to previous, i.e., don't update canvas.*/
         break;
     default:
-        /* Add frame non-transparent pixels to canvas. */
-        render_frame_rect(gif, gif->canvas);
+        /* The frame's non-transparent pixels are already on the canvas. */
+        break;
     }
 }
 
@@ -574,8 +560,9 @@ int
 gd_get_frame(gd_GIF *gif)
 {
     char sep;
+    /* The extensions of the next frame overwrite it */
+    gd_GCE prev_gce = gif->gce;
 
-    dispose(gif);
     f_gif_read(gif, &sep, 1);
     while (sep != ',') {
         if (sep == ';') {
@@ -592,26 +579,13 @@ gd_get_frame(gd_GIF *gif)
         else return -1;
         f_gif_read(gif, &sep, 1);
     }
+    /* Dispose only if there is a next frame so the last one stays visible */
+    dispose(gif, &prev_gce);
     if (read_image(gif) == -1)
         return -1;
     return 1;
 }
 
-void
-gd_render_frame(gd_GIF *gif, uint8_t *buffer)
-{
-//    uint32_t i;
-//    uint32_t j;
-//    for(i = 0, j = 0; i < gif->width * gif->height * 3; i+= 3, j+=4) {
-//        buffer[j + 0] = gif->canvas[i + 2];
-//        buffer[j + 1] = gif->canvas[i + 1];
-//        buffer[j + 2] = gif->canvas[i + 0];
-//        buffer[j + 3] = 0xFF;
-//    }
-//    memcpy(buffer, gif->canvas, gif->width * gif->height * 3);
-    render_frame_rect(gif, buffer);
-}
-
 void
 gd_rewind(gd_GIF *gif)
 {
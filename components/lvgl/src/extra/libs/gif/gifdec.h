@@ -3,12 +3,13 @@
 
 #include <stdint.h>
 #include "../../../misc/lv_fs.h"
+#include "../../../misc/lv_color.h"
 
 #if LV_USE_GIF
 
 typedef struct gd_Palette {
     int size;
-    uint8_t colors[0x100 * 3];
+    lv_color_t colors[0x100];   /* Converted to the native color format when read */
 } gd_Palette;
 
 typedef struct gd_GCE {
@@ -42,15 +43,17 @@ typedef struct gd_GIF {
     void (*application)(struct gd_GIF *gif, char id[8], char auth[3]);
     uint16_t fx, fy, fw, fh;
     uint8_t bgindex;
-    uint8_t *canvas, *frame;
+    uint8_t has_alpha;  /* Transparency is used by a frame */
+    /* The frames are decoded directly into the canvas. Its format is LV_IMG_CF_TRUE_COLOR without alpha.
+     * With alpha it's LV_IMG_CF_RGB565A8 with 16 bit color depth, else LV_IMG_CF_TRUE_COLOR_ALPHA. */
+    uint8_t *canvas;
+    uint8_t *alpha;     /* The alpha plane of LV_IMG_CF_RGB565A8 or NULL */
 } gd_GIF;
 
 gd_GIF * gd_open_gif_file(const char *fname);
 
 gd_GIF * gd_open_gif_data(const void *data);
 
-void gd_render_frame(gd_GIF *gif, uint8_t *buffer);
-
 int gd_get_frame(gd_GIF *gif);
 void gd_rewind(gd_GIF *gif);
 void gd_close_gif(gd_GIF *gif);
@@ -11,6 +11,7 @@
 
 #include "lv_png.h"
 #include "lodepng.h"
+#include "lv_png_stream.h"
 #include <stdlib.h>
 
 /*********************
@@ -27,6 +28,11 @@
 static lv_res_t decoder_info(struct _lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
 static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
 static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
+#if LV_PNG_STREAM
+static lv_res_t decoder_open_stream(lv_img_decoder_dsc_t * dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf);
+#endif
 static void convert_color_depth(uint8_t * img, uint32_t px_cnt);
 
 /**********************
@@ -50,6 +56,9 @@ void lv_png_init(void)
     lv_img_decoder_set_info_cb(dec, decoder_info);
     lv_img_decoder_set_open_cb(dec, decoder_open);
     lv_img_decoder_set_close_cb(dec, decoder_close);
+#if LV_PNG_STREAM
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+#endif
 }
 
 /**********************
@@ -136,6 +145,10 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
         const char * fn = dsc->src;
         if(strcmp(lv_fs_get_ext(fn), "png") == 0) {              /*Check the extension*/
 
+#if LV_PNG_STREAM
+            if(decoder_open_stream(dsc) == LV_RES_OK) return LV_RES_OK;
+#endif
+
             /*Load the PNG file into buffer. It's still compressed (not decoded)*/
             unsigned char * png_data;      /*Pointer to the loaded data. Same as the original file just loaded into the RAM*/
             size_t png_data_size;          /*Size of `png_data` in bytes*/
@@ -170,6 +183,11 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
     /*If it's a PNG file in a  C array...*/
     else if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
         const lv_img_dsc_t * img_dsc = dsc->src;
+
+#if LV_PNG_STREAM
+        if(decoder_open_stream(dsc) == LV_RES_OK) return LV_RES_OK;
+#endif
+
         uint32_t png_width;             /*No used, just required by he decoder*/
         uint32_t png_height;            /*No used, just required by he decoder*/
 
@@ -203,7 +221,80 @@ static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc
         lv_mem_free((uint8_t *)dsc->img_data);
         dsc->img_data = NULL;
     }
+
+#if LV_PNG_STREAM
+    if(dsc->user_data) {
+        _lv_png_stream_close(dsc->user_data);
+        dsc->user_data = NULL;
+    }
+#endif
+}
+
+#if LV_PNG_STREAM
+/**
+ * Decode the image row by row directly into the native color format.
+ * Without image cache only the stream is opened and the rows are decoded when they are drawn.
+ * @param dsc decoder descriptor of a PNG image
+ * @return LV_RES_OK: opened; LV_RES_INV: the image can't be streamed (e.g. it's interlaced)
+ */
+static lv_res_t decoder_open_stream(lv_img_decoder_dsc_t * dsc)
+{
+    _lv_png_stream_t * s = _lv_png_stream_open(dsc->src);
+    if(s == NULL) return LV_RES_INV;
+
+    dsc->header.cf = s->has_alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    /*The image is opened again for every draw so don't keep the decoded image*/
+    dsc->user_data = s;
+    return LV_RES_OK;
+#else
+
+    uint32_t px_cnt = s->w * s->h;
+    uint32_t size;
+#if LV_COLOR_DEPTH == 16
+    if(s->has_alpha) {
+        /*Aligned colors and a separate alpha plane*/
+        dsc->header.cf = LV_IMG_CF_RGB565A8;
+        size = px_cnt * (sizeof(lv_color_t) + 1);
+    }
+    else
+#endif
+    {
+        size = px_cnt * (s->has_alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t));
+    }
+
+    uint8_t * img_data = lv_mem_alloc(size);
+    LV_ASSERT_MALLOC(img_data);
+    if(img_data == NULL) {
+        _lv_png_stream_close(s);
+        return LV_RES_INV;
+    }
+
+    lv_res_t res = _lv_png_stream_decode(s, img_data, dsc->header.cf);
+    _lv_png_stream_close(s);
+    if(res != LV_RES_OK) {
+        LV_LOG_WARN("invalid PNG data");
+        lv_mem_free(img_data);
+        return LV_RES_INV;
+    }
+
+    dsc->img_data = img_data;
+    return LV_RES_OK;
+#endif /*LV_IMG_CACHE_DEF_SIZE == 0*/
+}
+
+/**
+ * Decode a part of a row of an image which was opened without image cache
+ */
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+    if(dsc->user_data == NULL) return LV_RES_INV;
+    return _lv_png_stream_read_line(dsc->user_data, x, y, len, buf);
 }
+#endif /*LV_PNG_STREAM*/
 
 /**
  * If the display is not in 32 bit format (ARGB888) then covert the image to the current color depth
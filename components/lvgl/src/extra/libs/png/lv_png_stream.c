@@ -0,0 +1,851 @@
+/**
+ * @file lv_png_stream.c
+ * Decode PNG images row by row directly into the native color format.
+ * Only two rows and the zlib window are kept in the memory.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_png_stream.h"
+#if LV_USE_PNG && LV_PNG_STREAM
+
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define FAST_BITS       _LV_PNG_STREAM_FAST_BITS
+#define FAST_MASK       ((1 << FAST_BITS) - 1)
+#define MAX_CODE_BITS   15
+
+#define COLOR_GRAY          0
+#define COLOR_RGB           2
+#define COLOR_PALETTE       3
+#define COLOR_GRAY_ALPHA    4
+#define COLOR_RGBA          6
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+enum {
+    BLOCK_NONE,
+    BLOCK_STORED,
+    BLOCK_HUFFMAN,
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool read_header(_lv_png_stream_t * s);
+static bool stream_start(_lv_png_stream_t * s);
+static bool src_read(_lv_png_stream_t * s, void * buf, uint32_t n);
+static bool src_seek(_lv_png_stream_t * s, uint32_t pos);
+static bool refill(_lv_png_stream_t * s);
+static uint32_t get_bits(_lv_png_stream_t * s, uint8_t n);
+static bool huff_build(_lv_png_huff_t * h, const uint8_t * lengths, uint32_t n);
+static int32_t huff_decode(_lv_png_stream_t * s, const _lv_png_huff_t * h);
+static bool block_start(_lv_png_stream_t * s);
+static bool read_dynamic(_lv_png_stream_t * s);
+static bool inflate(_lv_png_stream_t * s, uint8_t * out, uint32_t len);
+static bool seek_row(_lv_png_stream_t * s, uint32_t y);
+static bool unfilter(_lv_png_stream_t * s, uint8_t filter);
+static void row_convert(_lv_png_stream_t * s, uint32_t x, uint32_t len, uint8_t * color_p, uint32_t color_step,
+                        uint8_t * alpha_p, uint32_t alpha_step);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const uint16_t len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+static const uint8_t len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+static const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+    4097, 6145, 8193, 12289, 16385, 24577
+};
+
+static const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+/**********************
+ *      MACROS
+ **********************/
+#define BE16(p) (((uint16_t)(p)[0] << 8) | (p)[1])
+#define BE32(p) (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | ((uint32_t)(p)[2] << 8) | (p)[3])
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+_lv_png_stream_t * _lv_png_stream_open(const void * src)
+{
+    _lv_png_stream_t * s = lv_mem_alloc(sizeof(_lv_png_stream_t));
+    LV_ASSERT_MALLOC(s);
+    if(s == NULL) return NULL;
+    lv_memset_00(s, sizeof(_lv_png_stream_t));
+
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    if(src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = src;
+        if(img_dsc->data == NULL) {
+            lv_mem_free(s);
+            return NULL;
+        }
+        s->data = img_dsc->data;
+        s->data_size = img_dsc->data_size;
+    }
+    else if(src_type != LV_IMG_SRC_FILE || lv_fs_open(&s->file, src, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        lv_mem_free(s);
+        return NULL;
+    }
+
+    if(!read_header(s)) {
+        _lv_png_stream_close(s);
+        return NULL;
+    }
+
+    /*The rows are unfiltered in place using the previous row*/
+    s->row = lv_mem_alloc(s->bpr * 2);
+    LV_ASSERT_MALLOC(s->row);
+    if(s->row == NULL) {
+        _lv_png_stream_close(s);
+        return NULL;
+    }
+    s->prev_row = s->row + s->bpr;
+
+    if(!stream_start(s)) {
+        _lv_png_stream_close(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+lv_res_t _lv_png_stream_read_line(_lv_png_stream_t * s, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
+{
+    if(x < 0 || y < 0 || len <= 0 || (uint32_t)x + len > s->w) return LV_RES_INV;
+    if(!seek_row(s, y)) return LV_RES_INV;
+
+    if(s->has_alpha) {
+        row_convert(s, x, len, buf, LV_IMG_PX_SIZE_ALPHA_BYTE, buf + LV_IMG_PX_SIZE_ALPHA_BYTE - 1,
+                    LV_IMG_PX_SIZE_ALPHA_BYTE);
+    }
+    else {
+        row_convert(s, x, len, buf, sizeof(lv_color_t), NULL, 0);
+    }
+
+    return LV_RES_OK;
+}
+
+lv_res_t _lv_png_stream_decode(_lv_png_stream_t * s, uint8_t * buf, lv_img_cf_t cf)
+{
+    uint32_t y;
+    for(y = 0; y < s->h; y++) {
+        if(!seek_row(s, y)) return LV_RES_INV;
+
+        if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) {
+            uint8_t * p = buf + y * s->w * LV_IMG_PX_SIZE_ALPHA_BYTE;
+            row_convert(s, 0, s->w, p, LV_IMG_PX_SIZE_ALPHA_BYTE, p + LV_IMG_PX_SIZE_ALPHA_BYTE - 1, LV_IMG_PX_SIZE_ALPHA_BYTE);
+        }
+#if LV_COLOR_DEPTH == 16
+        else if(cf == LV_IMG_CF_RGB565A8) {
+            /*The colors and then the alpha values*/
+            uint8_t * p = buf + y * s->w * sizeof(lv_color_t);
+            uint8_t * a = buf + s->w * s->h * sizeof(lv_color_t) + y * s->w;
+            row_convert(s, 0, s->w, p, sizeof(lv_color_t), a, 1);
+        }
+#endif
+        else {
+            row_convert(s, 0, s->w, buf + y * s->w * sizeof(lv_color_t), sizeof(lv_color_t), NULL, 0);
+        }
+    }
+
+    return LV_RES_OK;
+}
+
+void _lv_png_stream_close(_lv_png_stream_t * s)
+{
+    if(s->data == NULL) lv_fs_close(&s->file);
+    if(s->palette) lv_mem_free(s->palette);
+    if(s->win) lv_mem_free(s->win);
+    /*The rows are swapped so free the start of their buffer*/
+    if(s->row) lv_mem_free(s->row < s->prev_row ? s->row : s->prev_row);
+    lv_mem_free(s);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Read the chunks until the first IDAT chunk
+ * @param s pointer to a stream
+ * @return true: the image can be streamed
+ */
+static bool read_header(_lv_png_stream_t * s)
+{
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    uint8_t buf[13];
+    if(!src_read(s, buf, 8) || memcmp(buf, signature, 8)) return false;
+
+    bool has_ihdr = false;
+    while(1) {
+        if(!src_read(s, buf, 8)) return false;
+        uint32_t len = BE32(buf);
+        uint32_t next = s->pos + len + 4;     /*Data and CRC*/
+        if(next < s->pos) return false;
+
+        if(memcmp(&buf[4], "IHDR", 4) == 0) {
+            if(len != 13 || !src_read(s, buf, 13)) return false;
+            s->w = BE32(buf);
+            s->h = BE32(&buf[4]);
+            s->depth = buf[8];
+            s->color_type = buf[9];
+
+            uint8_t channels;
+            bool depth_ok;
+            switch(s->color_type) {
+                case COLOR_GRAY:
+                    channels = 1;
+                    depth_ok = s->depth == 1 || s->depth == 2 || s->depth == 4 || s->depth == 8 || s->depth == 16;
+                    break;
+                case COLOR_PALETTE:
+                    channels = 1;
+                    depth_ok = s->depth == 1 || s->depth == 2 || s->depth == 4 || s->depth == 8;
+                    break;
+                case COLOR_RGB:
+                    channels = 3;
+                    depth_ok = s->depth == 8 || s->depth == 16;
+                    break;
+                case COLOR_GRAY_ALPHA:
+                    channels = 2;
+                    depth_ok = s->depth == 8 || s->depth == 16;
+                    break;
+                case COLOR_RGBA:
+                    channels = 4;
+                    depth_ok = s->depth == 8 || s->depth == 16;
+                    break;
+                default:
+                    return false;
+            }
+
+            /*Interlaced images are not decoded in row order*/
+            if(!depth_ok || buf[10] != 0 || buf[11] != 0 || buf[12] != 0) return false;
+            if(s->w == 0 || s->h == 0 || s->w > LV_COORD_MAX || s->h > LV_COORD_MAX) return false;
+
+            /*With LV_USE_LARGE_COORD the row size could overflow. 2 rows are allocated.*/
+            uint32_t px_bits = channels * s->depth;
+            if(s->w > (UINT32_MAX / 2 - 7) / px_bits) return false;
+            s->bpr = (s->w * px_bits + 7) / 8;
+            s->bpp = px_bits < 8 ? 1 : px_bits / 8;
+            s->has_alpha = s->color_type == COLOR_GRAY_ALPHA || s->color_type == COLOR_RGBA;
+            has_ihdr = true;
+        }
+        else if(!has_ihdr) {
+            return false;
+        }
+        else if(memcmp(&buf[4], "PLTE", 4) == 0 || (memcmp(&buf[4], "tRNS", 4) == 0 && s->color_type == COLOR_PALETTE)) {
+            bool plte = buf[4] == 'P';
+            if(len > (plte ? 256 * 3 : 256) || (plte && len % 3)) return false;
+
+            if(s->palette == NULL) {
+                /*Like lodepng, the missing entries are opaque black*/
+                s->palette = lv_mem_alloc(256 * 4);
+                LV_ASSERT_MALLOC(s->palette);
+                if(s->palette == NULL) return false;
+                uint32_t i;
+                for(i = 0; i < 256; i++) {
+                    s->palette[i][0] = 0;
+                    s->palette[i][1] = 0;
+                    s->palette[i][2] = 0;
+                    s->palette[i][3] = 0xff;
+                }
+            }
+
+            uint32_t i;
+            for(i = 0; i < len / (plte ? 3 : 1); i++) {
+                if(plte) {
+                    if(!src_read(s, s->palette[i], 3)) return false;
+                }
+                else {
+                    if(!src_read(s, &s->palette[i][3], 1)) return false;
+                    s->has_alpha = 1;
+                }
+            }
+        }
+        else if(memcmp(&buf[4], "tRNS", 4) == 0) {
+            uint8_t key[6];
+            uint32_t key_len = s->color_type == COLOR_GRAY ? 2 : 6;
+            if(s->color_type != COLOR_GRAY && s->color_type != COLOR_RGB) return false;
+            if(len != key_len || !src_read(s, key, key_len)) return false;
+            s->key[0] = BE16(key);
+            s->key[1] = BE16(&key[2]);
+            s->key[2] = BE16(&key[4]);
+            s->has_key = 1;
+            s->has_alpha = 1;
+        }
+        else if(memcmp(&buf[4], "IDAT", 4) == 0) {
+            if(s->color_type == COLOR_PALETTE && s->palette == NULL) return false;
+            s->idat_pos = s->pos;
+            s->idat_len = len;
+            return true;
+        }
+        else if(memcmp(&buf[4], "IEND", 4) == 0) {
+            return false;
+        }
+
+        if(!src_seek(s, next)) return false;
+    }
+}
+
+/**
+ * Start inflating from the first IDAT chunk
+ * @param s pointer to a stream
+ * @return true: the zlib header is valid
+ */
+static bool stream_start(_lv_png_stream_t * s)
+{
+    if(!src_seek(s, s->idat_pos)) return false;
+    s->chunk_left = s->idat_len;
+    s->in_len = 0;
+    s->bit_buf = 0;
+    s->bit_cnt = 0;
+    s->block = BLOCK_NONE;
+    s->final = 0;
+    s->error = 0;
+    s->match_len = 0;
+    s->win_pos = 0;
+    s->next_y = 0;
+
+    /*The row before the first is 0 for the filters*/
+    if(s->prev_row < s->row) s->row = s->prev_row;
+    s->prev_row = s->row + s->bpr;
+    lv_memset_00(s->row, s->bpr * 2);
+
+    uint32_t cmf = get_bits(s, 8);
+    uint32_t flg = get_bits(s, 8);
+    if(s->error || ((cmf << 8) | flg) % 31 || (cmf & 0x0f) != 8 || (cmf >> 4) > 7 || (flg & 0x20)) return false;
+
+    /*Only as much window as the encoder used*/
+    if(s->win == NULL) {
+        uint32_t win_size = 1UL << ((cmf >> 4) + 8);
+        s->win = lv_mem_alloc(win_size);
+        LV_ASSERT_MALLOC(s->win);
+        if(s->win == NULL) return false;
+        s->win_mask = win_size - 1;
+    }
+
+    return true;
+}
+
+static bool src_read(_lv_png_stream_t * s, void * buf, uint32_t n)
+{
+    if(s->data) {
+        if(n > s->data_size - s->pos) return false;
+        lv_memcpy(buf, s->data + s->pos, n);
+    }
+    else {
+        uint32_t rn;
+        if(lv_fs_read(&s->file, buf, n, &rn) != LV_FS_RES_OK || rn != n) return false;
+    }
+
+    s->pos += n;
+    return true;
+}
+
+static bool src_seek(_lv_png_stream_t * s, uint32_t pos)
+{
+    if(s->data) {
+        if(pos > s->data_size) return false;
+    }
+    else {
+        if(lv_fs_seek(&s->file, pos, LV_FS_SEEK_SET) != LV_FS_RES_OK) return false;
+    }
+
+    s->pos = pos;
+    return true;
+}
+
+/**
+ * Load the next bytes of the zlib stream, continuing in the next IDAT chunk if required
+ * @param s pointer to a stream
+ * @return true: there are new bytes in `in_p`
+ */
+static bool refill(_lv_png_stream_t * s)
+{
+    while(s->chunk_left == 0) {
+        /*CRC of the previous chunk, length and type of the next*/
+        uint8_t buf[12];
+        if(!src_read(s, buf, 12) || memcmp(&buf[8], "IDAT", 4)) return false;
+        s->chunk_left = BE32(&buf[4]);
+    }
+
+    uint32_t n;
+    if(s->data) {
+        n = LV_MIN(s->chunk_left, s->data_size - s->pos);
+        if(n == 0) return false;
+        s->in_p = s->data + s->pos;
+        s->pos += n;
+    }
+    else {
+        n = LV_MIN(s->chunk_left, sizeof(s->in_buf));
+        if(!src_read(s, s->in_buf, n)) return false;
+        s->in_p = s->in_buf;
+    }
+
+    s->in_len = n;
+    s->chunk_left -= n;
+    return true;
+}
+
+static uint32_t get_bits(_lv_png_stream_t * s, uint8_t n)
+{
+    while(s->bit_cnt < n) {
+        if(s->in_len == 0 && !refill(s)) {
+            s->error = 1;
+            return 0;
+        }
+        s->bit_buf |= (uint32_t)*s->in_p << s->bit_cnt;
+        s->in_p++;
+        s->in_len--;
+        s->bit_cnt += 8;
+    }
+
+    uint32_t v = s->bit_buf & ((1UL << n) - 1);
+    s->bit_buf >>= n;
+    s->bit_cnt -= n;
+    return v;
+}
+
+/**
+ * Create the decoding tables of a canonical Huffman code
+ * @param h store the tables here
+ * @param lengths code length of each symbol, 0 if the symbol is not used
+ * @param n number of symbols
+ * @return false: the code is over-subscribed
+ */
+static bool huff_build(_lv_png_huff_t * h, const uint8_t * lengths, uint32_t n)
+{
+    lv_memset_00(h->count, sizeof(h->count));
+    lv_memset_00(h->fast, sizeof(h->fast));
+
+    uint32_t i;
+    for(i = 0; i < n; i++) h->count[lengths[i]]++;
+    h->count[0] = 0;
+
+    int32_t left = 1;
+    uint32_t len;
+    for(len = 1; len <= MAX_CODE_BITS; len++) {
+        left = (left << 1) - h->count[len];
+        if(left < 0) return false;
+    }
+
+    uint16_t offs[MAX_CODE_BITS + 1];
+    uint16_t next_code[MAX_CODE_BITS + 1];
+    uint32_t code = 0;
+    offs[1] = 0;
+    for(len = 1; len <= MAX_CODE_BITS; len++) {
+        code = (code + h->count[len - 1]) << 1;
+        next_code[len] = code;
+        if(len < MAX_CODE_BITS) offs[len + 1] = offs[len] + h->count[len];
+    }
+
+    for(i = 0; i < n; i++) {
+        len = lengths[i];
+        if(len == 0) continue;
+
+        h->symbol[offs[len]++] = i;
+        code = next_code[len]++;
+        if(len > FAST_BITS) continue;
+
+        /*The codes are stored from the most significant bit so look them up reversed*/
+        uint32_t rev = 0;
+        uint32_t b;
+        for(b = 0; b < len; b++) rev |= ((code >> b) & 1) << (len - 1 - b);
+        for(; rev <= FAST_MASK; rev += 1 << len) h->fast[rev] = (len << FAST_BITS) | i;
+    }
+
+    return true;
+}
+
+static int32_t huff_decode(_lv_png_stream_t * s, const _lv_png_huff_t * h)
+{
+    /*Load the bits for the table. The last codes of the stream might be shorter.*/
+    while(s->bit_cnt < FAST_BITS) {
+        if(s->in_len == 0 && !refill(s)) break;
+        s->bit_buf |= (uint32_t)*s->in_p << s->bit_cnt;
+        s->in_p++;
+        s->in_len--;
+        s->bit_cnt += 8;
+    }
+
+    uint16_t e = h->fast[s->bit_buf & FAST_MASK];
+    uint8_t len = e >> FAST_BITS;
+    if(len && len <= s->bit_cnt) {
+        s->bit_buf >>= len;
+        s->bit_cnt -= len;
+        return e & FAST_MASK;
+    }
+
+    /*Longer codes bit by bit*/
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    for(len = 1; len <= MAX_CODE_BITS; len++) {
+        code |= get_bits(s, 1);
+        if(s->error) return -1;
+
+        int32_t count = h->count[len];
+        if(code - first < count) return h->symbol[index + code - first];
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    s->error = 1;
+    return -1;
+}
+
+static bool block_start(_lv_png_stream_t * s)
+{
+    if(s->final) return false;
+
+    s->final = get_bits(s, 1);
+    uint32_t type = get_bits(s, 2);
+    if(type == 0) {
+        /*Stored block from the next byte boundary*/
+        get_bits(s, s->bit_cnt & 7);
+        uint32_t len = get_bits(s, 16);
+        uint32_t nlen = get_bits(s, 16);
+        if(len != (~nlen & 0xffff)) return false;
+        s->stored_left = len;
+        s->block = BLOCK_STORED;
+    }
+    else if(type == 1) {
+        uint8_t lengths[288];
+        lv_memset(lengths, 8, 144);
+        lv_memset(&lengths[144], 9, 112);
+        lv_memset(&lengths[256], 7, 24);
+        lv_memset(&lengths[280], 8, 8);
+        huff_build(&s->lit, lengths, 288);
+        lv_memset(lengths, 5, 30);
+        huff_build(&s->dist, lengths, 30);
+        s->block = BLOCK_HUFFMAN;
+    }
+    else if(type == 2) {
+        if(!read_dynamic(s)) return false;
+        s->block = BLOCK_HUFFMAN;
+    }
+    else {
+        return false;
+    }
+
+    return !s->error;
+}
+
+static bool read_dynamic(_lv_png_stream_t * s)
+{
+    static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    uint8_t lengths[286 + 30];
+
+    uint32_t nlen = get_bits(s, 5) + 257;
+    uint32_t ndist = get_bits(s, 5) + 1;
+    uint32_t ncode = get_bits(s, 4) + 4;
+    if(nlen > 286 || ndist > 30) return false;
+
+    /*The code lengths are decoded with a temporary code in the literal tables*/
+    lv_memset_00(lengths, 19);
+    uint32_t i;
+    for(i = 0; i < ncode; i++) lengths[order[i]] = get_bits(s, 3);
+    if(s->error || !huff_build(&s->lit, lengths, 19)) return false;
+
+    i = 0;
+    while(i < nlen + ndist) {
+        int32_t sym = huff_decode(s, &s->lit);
+        if(sym < 0) return false;
+        if(sym < 16) {
+            lengths[i++] = sym;
+            continue;
+        }
+
+        uint8_t len = 0;
+        uint32_t rep;
+        if(sym == 16) {
+            if(i == 0) return false;
+            len = lengths[i - 1];
+            rep = 3 + get_bits(s, 2);
+        }
+        else if(sym == 17) {
+            rep = 3 + get_bits(s, 3);
+        }
+        else {
+            rep = 11 + get_bits(s, 7);
+        }
+
+        if(s->error || i + rep > nlen + ndist) return false;
+        lv_memset(&lengths[i], len, rep);
+        i += rep;
+    }
+
+    /*Without end of block code the block can't end*/
+    if(lengths[256] == 0) return false;
+
+    return huff_build(&s->lit, lengths, nlen) && huff_build(&s->dist, &lengths[nlen], ndist);
+}
+
+/**
+ * Inflate the next bytes of the zlib stream
+ * @param s pointer to a stream
+ * @param out store the bytes here
+ * @param len number of bytes to inflate
+ * @return true: success; false: invalid or too short stream
+ */
+static bool inflate(_lv_png_stream_t * s, uint8_t * out, uint32_t len)
+{
+    uint8_t * win = s->win;
+    uint32_t mask = s->win_mask;
+
+    while(len) {
+        if(s->match_len) {
+            uint32_t n = LV_MIN(len, s->match_len);
+            uint32_t from = s->win_pos - s->match_dist;
+            s->match_len -= n;
+            len -= n;
+            while(n--) {
+                uint8_t b = win[from++ & mask];
+                win[s->win_pos++ & mask] = b;
+                *out++ = b;
+            }
+            continue;
+        }
+
+        if(s->block == BLOCK_NONE) {
+            if(!block_start(s)) return false;
+            continue;
+        }
+
+        if(s->block == BLOCK_STORED) {
+            if(s->stored_left == 0) {
+                s->block = BLOCK_NONE;
+                continue;
+            }
+
+            uint8_t b = get_bits(s, 8);
+            if(s->error) return false;
+            win[s->win_pos++ & mask] = b;
+            *out++ = b;
+            len--;
+            s->stored_left--;
+            continue;
+        }
+
+        int32_t sym = huff_decode(s, &s->lit);
+        if(sym < 0) return false;
+
+        if(sym < 256) {
+            win[s->win_pos++ & mask] = sym;
+            *out++ = sym;
+            len--;
+        }
+        else if(sym == 256) {
+            s->block = BLOCK_NONE;
+        }
+        else {
+            sym -= 257;
+            if(sym >= 29) return false;
+            s->match_len = len_base[sym] + get_bits(s, len_extra[sym]);
+
+            int32_t dsym = huff_decode(s, &s->dist);
+            if(dsym < 0 || dsym >= 30) return false;
+            s->match_dist = dist_base[dsym] + get_bits(s, dist_extra[dsym]);
+            if(s->error || s->match_dist > s->win_pos || s->match_dist > mask + 1) return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Decode the rows until `y`
+ * @param s pointer to a stream
+ * @param y index of a row
+ * @return true: `row` has the unfiltered row `y`
+ */
+static bool seek_row(_lv_png_stream_t * s, uint32_t y)
+{
+    if(y >= s->h) return false;
+
+    /*The rows can be decoded only forward*/
+    if(s->next_y > y + 1 || s->error) {
+        if(!stream_start(s)) return false;
+    }
+
+    while(s->next_y <= y) {
+        uint8_t * tmp = s->prev_row;
+        s->prev_row = s->row;
+        s->row = tmp;
+
+        uint8_t filter;
+        if(!inflate(s, &filter, 1) || !inflate(s, s->row, s->bpr) || !unfilter(s, filter)) {
+            s->error = 1;
+            return false;
+        }
+        s->next_y++;
+    }
+
+    return true;
+}
+
+static bool unfilter(_lv_png_stream_t * s, uint8_t filter)
+{
+    uint8_t * row = s->row;
+    const uint8_t * prev = s->prev_row;
+    uint32_t len = s->bpr;
+    uint32_t bpp = s->bpp;
+    uint32_t i;
+
+    switch(filter) {
+        case 0:
+            break;
+        case 1:     /*Sub*/
+            for(i = bpp; i < len; i++) row[i] += row[i - bpp];
+            break;
+        case 2:     /*Up*/
+            for(i = 0; i < len; i++) row[i] += prev[i];
+            break;
+        case 3:     /*Average*/
+            for(i = 0; i < bpp && i < len; i++) row[i] += prev[i] >> 1;
+            for(; i < len; i++) row[i] += (row[i - bpp] + prev[i]) >> 1;
+            break;
+        case 4:     /*Paeth*/
+            for(i = 0; i < bpp && i < len; i++) row[i] += prev[i];
+            for(; i < len; i++) {
+                int32_t a = row[i - bpp];
+                int32_t b = prev[i];
+                int32_t c = prev[i - bpp];
+                int32_t pa = LV_ABS(b - c);
+                int32_t pb = LV_ABS(a - c);
+                int32_t pc = LV_ABS(a + b - 2 * c);
+                if(pa <= pb && pa <= pc) row[i] += a;
+                else if(pb <= pc) row[i] += b;
+                else row[i] += c;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Convert pixels of the current row to the native color format
+ * @param s pointer to a stream
+ * @param x first pixel
+ * @param len number of pixels
+ * @param color_p store the colors here
+ * @param color_step distance of the colors in `color_p`
+ * @param alpha_p store the alpha values here or NULL to skip them
+ * @param alpha_step distance of the alpha values in `alpha_p`
+ */
+static void row_convert(_lv_png_stream_t * s, uint32_t x, uint32_t len, uint8_t * color_p, uint32_t color_step,
+                        uint8_t * alpha_p, uint32_t alpha_step)
+{
+    const uint8_t * row = s->row;
+    uint8_t depth = s->depth;
+    uint32_t max = (1 << depth) - 1;
+    uint32_t i;
+
+    for(i = x; i < x + len; i++) {
+        const uint8_t * p;
+        uint8_t r;
+        uint8_t g;
+        uint8_t b;
+        uint8_t a = 0xff;
+        uint32_t v;
+
+        switch(s->color_type) {
+            case COLOR_GRAY:
+                if(depth == 16) {
+                    v = BE16(&row[i * 2]);
+                    r = row[i * 2];
+                }
+                else if(depth == 8) {
+                    v = row[i];
+                    r = v;
+                }
+                else {
+                    v = (row[(i * depth) >> 3] >> (8 - depth - ((i * depth) & 7))) & max;
+                    r = v * 255 / max;
+                }
+                g = r;
+                b = r;
+                if(s->has_key && v == s->key[0]) a = 0;
+                break;
+            case COLOR_RGB:
+                if(depth == 8) {
+                    p = &row[i * 3];
+                    r = p[0];
+                    g = p[1];
+                    b = p[2];
+                    if(s->has_key && r == s->key[0] && g == s->key[1] && b == s->key[2]) a = 0;
+                }
+                else {
+                    p = &row[i * 6];
+                    r = p[0];
+                    g = p[2];
+                    b = p[4];
+                    if(s->has_key && BE16(p) == s->key[0] && BE16(&p[2]) == s->key[1] && BE16(&p[4]) == s->key[2]) a = 0;
+                }
+                break;
+            case COLOR_PALETTE:
+                if(depth == 8) v = row[i];
+                else v = (row[(i * depth) >> 3] >> (8 - depth - ((i * depth) & 7))) & max;
+                p = s->palette[v];
+                r = p[0];
+                g = p[1];
+                b = p[2];
+                a = p[3];
+                break;
+            case COLOR_GRAY_ALPHA:
+                p = depth == 8 ? &row[i * 2] : &row[i * 4];
+                r = p[0];
+                g = r;
+                b = r;
+                a = depth == 8 ? p[1] : p[2];
+                break;
+            default:    /*RGBA*/
+                if(depth == 8) {
+                    p = &row[i * 4];
+                    r = p[0];
+                    g = p[1];
+                    b = p[2];
+                    a = p[3];
+                }
+                else {
+                    p = &row[i * 8];
+                    r = p[0];
+                    g = p[2];
+                    b = p[4];
+                    a = p[6];
+                }
+                break;
+        }
+
+        lv_color_t c = lv_color_make(r, g, b);
+        lv_memcpy_small(color_p, &c, sizeof(lv_color_t));
+        color_p += color_step;
+        if(alpha_p) {
+            *alpha_p = a;
+            alpha_p += alpha_step;
+        }
+    }
+}
+
+#endif /*LV_USE_PNG && LV_PNG_STREAM*/
@@ -0,0 +1,129 @@
+/**
+ * @file lv_png_stream.h
+ *
+ */
+
+#ifndef LV_PNG_STREAM_H
+#define LV_PNG_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+#if LV_USE_PNG && LV_PNG_STREAM
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _LV_PNG_STREAM_FAST_BITS    9
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Canonical Huffman code of the deflate streams*/
+typedef struct {
+    uint16_t fast[1 << _LV_PNG_STREAM_FAST_BITS];   /*`(length << FAST_BITS) | symbol` indexed by the next bits*/
+    uint16_t count[16];                             /*Number of codes of each length*/
+    uint16_t symbol[288];                           /*Symbols ordered by their codes*/
+} _lv_png_huff_t;
+
+typedef struct {
+    /*Source*/
+    lv_fs_file_t file;
+    const uint8_t * data;           /*Data of a PNG variable or NULL for files*/
+    uint32_t data_size;
+    uint32_t pos;                   /*Read position in the source*/
+    uint32_t idat_pos;              /*Start of the first IDAT chunk's data*/
+    uint32_t idat_len;
+    uint32_t chunk_left;            /*Unread bytes of the current IDAT chunk*/
+    const uint8_t * in_p;           /*Next bytes of the zlib stream*/
+    uint32_t in_len;
+    uint8_t in_buf[256];
+
+    /*Image*/
+    uint32_t w;
+    uint32_t h;
+    uint8_t depth;
+    uint8_t color_type;
+    uint8_t has_alpha : 1;
+    uint8_t has_key : 1;
+    uint16_t key[3];                /*Transparent color of gray and RGB images*/
+    uint8_t (*palette)[4];          /*RGBA palette entries*/
+
+    /*Inflate*/
+    uint32_t bit_buf;
+    uint8_t bit_cnt;
+    uint8_t block;
+    uint8_t final : 1;
+    uint8_t error : 1;
+    uint16_t stored_left;
+    uint16_t match_len;
+    uint16_t match_dist;
+    uint8_t * win;                  /*The last inflated bytes for the back references*/
+    uint32_t win_mask;
+    uint32_t win_pos;               /*Number of inflated bytes*/
+    _lv_png_huff_t lit;
+    _lv_png_huff_t dist;
+
+    /*Rows*/
+    uint8_t * row;
+    uint8_t * prev_row;
+    uint32_t bpr;                   /*Bytes per row without the filter type*/
+    uint8_t bpp;                    /*Bytes per pixel for the filters, at least 1*/
+    uint32_t next_y;                /*`row` has row `next_y - 1`*/
+} _lv_png_stream_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Open a PNG image to decode it row by row.
+ * @param src path to a PNG file or pointer to an `lv_img_dsc_t` with PNG data
+ * @return the stream or NULL if the image is invalid or it can't be streamed (e.g. it's interlaced)
+ */
+_lv_png_stream_t * _lv_png_stream_open(const void * src);
+
+/**
+ * Read pixels of a row as `LV_IMG_CF_TRUE_COLOR_ALPHA` if the image has alpha, else as `LV_IMG_CF_TRUE_COLOR`.
+ * The rows are decoded in order so reading an earlier row starts decoding from the beginning again.
+ * @param s pointer to an opened stream
+ * @param x start x coordinate
+ * @param y the row to read
+ * @param len number of pixels to read
+ * @param buf store the pixels here
+ * @return LV_RES_OK: no error; LV_RES_INV: invalid coordinates or data
+ */
+lv_res_t _lv_png_stream_read_line(_lv_png_stream_t * s, lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
+
+/**
+ * Decode the whole image.
+ * @param s pointer to an opened stream
+ * @param buf store the image here
+ * @param cf `LV_IMG_CF_TRUE_COLOR`, `LV_IMG_CF_TRUE_COLOR_ALPHA` or with 16 bit color depth `LV_IMG_CF_RGB565A8`
+ * @return LV_RES_OK: no error; LV_RES_INV: invalid data
+ */
+lv_res_t _lv_png_stream_decode(_lv_png_stream_t * s, uint8_t * buf, lv_img_cf_t cf);
+
+/**
+ * Close a stream and free its memory
+ * @param s pointer to an opened stream
+ */
+void _lv_png_stream_close(_lv_png_stream_t * s);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_PNG && LV_PNG_STREAM*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_PNG_STREAM_H*/
@@ -86,6 +86,13 @@ typedef struct {
 } io_source_t;
 
 
+/*A decoded frame in the native color format*/
+typedef struct {
+    uint8_t * buf;
+    int frame_index;                    //-1 if empty
+    uint32_t last_use;                  //To find the least recently used slice
+} sjpeg_slice_t;
+
 typedef struct {
     uint8_t * sjpeg_data;
     uint32_t sjpeg_data_size;
@@ -93,13 +100,26 @@ typedef struct {
     int sjpeg_y_res;
     int sjpeg_total_frames;
     int sjpeg_single_frame_height;
-    int sjpeg_cache_frame_index;
     uint8_t ** frame_base_array;        //to save base address of each split frames upto sjpeg_total_frames.
     int * frame_base_offset;            //to save base offset for fseek
-    uint8_t * frame_cache;
+    sjpeg_slice_t * slices;             //Cache of the decoded frames
+    int slice_cnt;
+    uint32_t slice_use_cnt;
     uint8_t * workb;                    //JPG work buffer for jpeg library
     JDEC * tjpeg_jd;
     io_source_t io;
+#if LV_SJPG_PREFETCH
+    /*The worker decodes the frame next to the last read one with its own decoder and source*/
+    int last_frame_index;
+    int8_t read_dir;                    //1 or -1: the frames are read downwards or upwards
+    char * path;                        //To open the file again for the worker
+    uint8_t * prefetch_workb;
+    JDEC * prefetch_jd;
+    io_source_t prefetch_io;
+    sjpeg_slice_t * prefetch_slice;     //The slice written by the worker or NULL
+    int prefetch_frame_index;
+    uint8_t closed;                     //Closed while the worker was busy, the worker frees it
+#endif
 } SJPEG;
 
 /**********************
@@ -114,6 +134,14 @@ static size_t input_func(JDEC * jd, uint8_t * buff, size_t ndata);
 static int is_jpg(const uint8_t * raw_data, size_t len);
 static void lv_sjpg_cleanup(SJPEG * sjpeg);
 static void lv_sjpg_free(SJPEG * sjpeg);
+static bool slices_init(SJPEG * sjpeg);
+static uint8_t * slice_get(SJPEG * sjpeg, int frame_index);
+static lv_res_t slice_decode(SJPEG * sjpeg, io_source_t * io, JDEC * jd, uint8_t * workb, int frame_index,
+                             uint8_t * buf);
+#if LV_SJPG_PREFETCH
+    static void prefetch_start(SJPEG * sjpeg, int frame_index);
+    static void prefetch_cb(void * user_data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -283,18 +311,34 @@ end:
 static int img_data_cb(JDEC * jd, void * data, JRECT * rect)
 {
     io_source_t * io = jd->device;
-    uint8_t * cache = io->img_cache_buff;
+    lv_color_t * cache = (lv_color_t *)io->img_cache_buff;
     const int xres = io->img_cache_x_res;
-    uint8_t * buf = data;
-    const int INPUT_PIXEL_SIZE = 3;
     const int row_width = rect->right - rect->left + 1; // Row width in pixels.
-    const int row_size = row_width * INPUT_PIXEL_SIZE;  // Row size (bytes).
 
+#if JD_FORMAT == 1
+    /*TJpgDec writes RGB565 so only the byte order might need to be changed*/
+    const uint16_t * buf = data;
     for(int y = rect->top; y <= rect->bottom; y++) {
-        int row_offset = y * xres * INPUT_PIXEL_SIZE + rect->left * INPUT_PIXEL_SIZE;
-        memcpy(cache + row_offset, buf, row_size);
-        buf += row_size;
+        lv_color_t * dest = cache + y * xres + rect->left;
+#if LV_COLOR_16_SWAP
+        for(int x = 0; x < row_width; x++) {
+            dest[x].full = (uint16_t)((buf[x] >> 8) | (buf[x] << 8));
+        }
+#else
+        memcpy(dest, buf, row_width * sizeof(lv_color_t));
+#endif
+        buf += row_width;
     }
+#else
+    const uint8_t * buf = data;
+    for(int y = rect->top; y <= rect->bottom; y++) {
+        lv_color_t * dest = cache + y * xres + rect->left;
+        for(int x = 0; x < row_width; x++) {
+            dest[x] = lv_color_make(buf[0], buf[1], buf[2]);
+            buf += 3;
+        }
+    }
+#endif
 
     return 1;
 }
@@ -395,15 +439,11 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 offset |= *data++ << 8;
                 sjpeg->frame_base_array[i] = sjpeg->frame_base_array[i - 1] + offset;
             }
-            sjpeg->sjpeg_cache_frame_index = -1;
-            sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3/*2*/);
-            if(! sjpeg->frame_cache) {
+            if(!slices_init(sjpeg)) {
                 lv_sjpg_cleanup(sjpeg);
                 sjpeg = NULL;
                 return LV_RES_INV;
             }
-            sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-            sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
             sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
             if(! sjpeg->workb) {
                 lv_sjpg_cleanup(sjpeg);
@@ -458,16 +498,12 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 uint8_t * img_frame_base = sjpeg->sjpeg_data;
                 sjpeg->frame_base_array[0] = img_frame_base;
 
-                sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!slices_init(sjpeg)) {
                     lv_sjpg_cleanup(sjpeg);
                     sjpeg = NULL;
                     return LV_RES_INV;
                 }
 
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_sjpg_cleanup(sjpeg);
@@ -577,15 +613,11 @@ end:
                     sjpeg->frame_base_offset[i] = sjpeg->frame_base_offset[i - 1] + offset;
                 }
 
-                sjpeg->sjpeg_cache_frame_index = -1; //INVALID AT BEGINNING for a forced compare mismatch at first time.
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!slices_init(sjpeg)) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
                     return LV_RES_INV;
                 }
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_fs_close(&lv_file);
@@ -600,6 +632,16 @@ end:
                     return LV_RES_INV;
                 }
 
+#if LV_SJPG_PREFETCH
+                sjpeg->path = lv_mem_alloc(strlen(fn) + 1);
+                if(! sjpeg->path) {
+                    lv_fs_close(&lv_file);
+                    lv_sjpg_cleanup(sjpeg);
+                    return LV_RES_INV;
+                }
+                strcpy(sjpeg->path, fn);
+#endif
+
                 sjpeg->io.type = SJPEG_IO_SOURCE_DISK;
                 sjpeg->io.lv_file = lv_file;
                 dsc->img_data = NULL;
@@ -665,16 +707,12 @@ end:
                 int img_frame_start_offset = 0;
                 sjpeg->frame_base_offset[0] = img_frame_start_offset;
 
-                sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(!slices_init(sjpeg)) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
                     return LV_RES_INV;
                 }
 
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_fs_close(&lv_file);
@@ -689,6 +727,16 @@ end:
                     return LV_RES_INV;
                 }
 
+#if LV_SJPG_PREFETCH
+                sjpeg->path = lv_mem_alloc(strlen(fn) + 1);
+                if(! sjpeg->path) {
+                    lv_fs_close(&lv_file);
+                    lv_sjpg_cleanup(sjpeg);
+                    return LV_RES_INV;
+                }
+                strcpy(sjpeg->path, fn);
+#endif
+
                 sjpeg->io.type = SJPEG_IO_SOURCE_DISK;
                 sjpeg->io.lv_file = lv_file;
                 dsc->img_data = NULL;
@@ -722,173 +770,280 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
                                   lv_coord_t len, uint8_t * buf)
 {
     LV_UNUSED(decoder);
-    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
-        SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-        JRESULT rc;
+    SJPEG * sjpeg = (SJPEG *) dsc->user_data;
+    if(!sjpeg) return LV_RES_INV;
 
-        int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
+    int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
+    uint8_t * cache = slice_get(sjpeg, sjpeg_req_frame_index);
+    if(!cache) return LV_RES_INV;
 
-        /*If line not from cache, refresh cache */
-        if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
-            sjpeg->io.raw_sjpg_data = sjpeg->frame_base_array[ sjpeg_req_frame_index ];
-            if(sjpeg_req_frame_index == (sjpeg->sjpeg_total_frames - 1)) {
-                /*This is the last frame. */
-                const uint32_t frame_offset = (uint32_t)(sjpeg->io.raw_sjpg_data - sjpeg->sjpeg_data);
-                sjpeg->io.raw_sjpg_data_size = sjpeg->sjpeg_data_size - frame_offset;
-            }
-            else {
-                sjpeg->io.raw_sjpg_data_size =
-                    (uint32_t)(sjpeg->frame_base_array[sjpeg_req_frame_index + 1] - sjpeg->io.raw_sjpg_data);
-            }
-            sjpeg->io.raw_sjpg_data_next_read_pos = 0;
-            rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
-            if(rc != JDR_OK) return LV_RES_INV;
-            rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
-            if(rc != JDR_OK) return LV_RES_INV;
-            sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
-        }
+    /*The slices are already in the native color format*/
+    int row = y % sjpeg->sjpeg_single_frame_height;
+    memcpy(buf, cache + (row * sjpeg->sjpeg_x_res + x) * sizeof(lv_color_t), len * sizeof(lv_color_t));
 
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if  LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
+    return LV_RES_OK;
+}
 
-#elif  LV_COLOR_DEPTH == 16
+/**
+ * Free the allocated resources
+ * @param decoder pointer to the decoder where this function belongs
+ * @param dsc pointer to a descriptor which describes this decoding session
+ */
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    /*Free all allocated data*/
+    SJPEG * sjpeg = (SJPEG *) dsc->user_data;
+    if(!sjpeg) return;
 
-        for(int i = 0; i < len; i++) {
-            uint16_t col_16bit = (*cache++ & 0xf8) << 8;
-            col_16bit |= (*cache++ & 0xFC) << 3;
-            col_16bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1 || LV_COLOR_16_SWAP == 1
-            buf[offset++] = col_16bit >> 8;
-            buf[offset++] = col_16bit & 0xff;
-#else
-            buf[offset++] = col_16bit & 0xff;
-            buf[offset++] = col_16bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
-        }
+#if LV_SJPG_PREFETCH
+    /*If the worker is decoding a frame of the image let the worker free it when it's ready*/
+    _lv_img_cache_async_lock();
+    bool busy = sjpeg->prefetch_slice != NULL;
+    if(busy) sjpeg->closed = 1;
+    _lv_img_cache_async_unlock();
+    if(busy) return;
+#endif
 
-#elif  LV_COLOR_DEPTH == 8
+    lv_sjpg_cleanup(sjpeg);
+}
 
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
-#else
-#error Unsupported LV_COLOR_DEPTH
+/**
+ * Allocate as many slices as fit into `LV_SJPG_CACHE_SIZE` but at least one
+ * @param sjpeg pointer to an SJPEG whose resolution and frames are already set
+ * @return true: ready; false: out of memory
+ */
+static bool slices_init(SJPEG * sjpeg)
+{
+    uint32_t slice_size = sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * sizeof(lv_color_t);
+    int cnt = slice_size ? (int)(LV_SJPG_CACHE_SIZE / slice_size) : 1;
+    cnt = LV_CLAMP(1, cnt, sjpeg->sjpeg_total_frames);
+
+    sjpeg->slices = lv_mem_alloc(cnt * sizeof(sjpeg_slice_t));
+    if(!sjpeg->slices) return false;
+    memset(sjpeg->slices, 0, cnt * sizeof(sjpeg_slice_t));
+    sjpeg->slice_cnt = cnt;
+
+    for(int i = 0; i < cnt; i++) {
+        sjpeg->slices[i].frame_index = -1;
+        sjpeg->slices[i].buf = lv_mem_alloc(slice_size);
+        if(!sjpeg->slices[i].buf) return false;
+    }
 
+#if LV_SJPG_PREFETCH
+    sjpeg->last_frame_index = -1;
+    sjpeg->read_dir = 1;
+#endif
 
-#endif // LV_COLOR_DEPTH
-        return LV_RES_OK;
-    }
-    else if(dsc->src_type == LV_IMG_SRC_FILE) {
-        SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-        JRESULT rc;
-        int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
+    return true;
+}
 
-        lv_fs_file_t * lv_file_p = &(sjpeg->io.lv_file);
-        if(!lv_file_p) goto end;
+/**
+ * Find a cached frame or the least recently used slice which can be replaced.
+ * Should be called in `_lv_img_cache_async_lock()`.
+ * @param sjpeg pointer to an SJPEG
+ * @param frame_index the frame to find
+ * @param skip_frame_index don't return the slice of this frame as a replaceable slice
+ * @param lru store the least recently used slice here if `frame_index` is not cached (NULL if none can be replaced)
+ * @return the slice of `frame_index` or NULL if it's not cached
+ */
+static sjpeg_slice_t * slice_find(SJPEG * sjpeg, int frame_index, int skip_frame_index, sjpeg_slice_t ** lru)
+{
+    *lru = NULL;
+    for(int i = 0; i < sjpeg->slice_cnt; i++) {
+        sjpeg_slice_t * slice = &sjpeg->slices[i];
+        if(slice->frame_index == frame_index && frame_index >= 0) return slice;
+        if(slice->frame_index == skip_frame_index && skip_frame_index >= 0) continue;
+#if LV_SJPG_PREFETCH
+        if(slice == sjpeg->prefetch_slice) continue;    /*Being written by the worker*/
+#endif
+        /*Empty slices have `last_use == 0` so they are used first*/
+        if(*lru == NULL || slice->last_use < (*lru)->last_use) *lru = slice;
+    }
 
-        /*If line not from cache, refresh cache */
-        if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
-            sjpeg->io.raw_sjpg_data_next_read_pos = (int)(sjpeg->frame_base_offset [ sjpeg_req_frame_index ]);
-            lv_fs_seek(&(sjpeg->io.lv_file), sjpeg->io.raw_sjpg_data_next_read_pos, LV_FS_SEEK_SET);
+    return NULL;
+}
 
-            rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
-            if(rc != JDR_OK) return LV_RES_INV;
+/**
+ * Get the pixels of a frame. Decode it into the least recently used slice if it's not cached.
+ * @param sjpeg pointer to an SJPEG
+ * @param frame_index index of the frame
+ * @return the pixels of the frame in the native color format or NULL on error
+ */
+static uint8_t * slice_get(SJPEG * sjpeg, int frame_index)
+{
+    if(frame_index < 0 || frame_index >= sjpeg->sjpeg_total_frames) return NULL;
+
+    sjpeg_slice_t * lru;
+    _lv_img_cache_async_lock();
+    sjpeg->slice_use_cnt++;
+    sjpeg_slice_t * slice = slice_find(sjpeg, frame_index, -1, &lru);
+    if(slice == NULL && lru) {
+        /*Mark it empty until it's decoded*/
+        lru->frame_index = -1;
+        slice = lru;
+    }
+    if(slice) slice->last_use = sjpeg->slice_use_cnt;
+    bool cached = slice && slice->frame_index == frame_index;
+    _lv_img_cache_async_unlock();
 
-            rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
-            if(rc != JDR_OK) return LV_RES_INV;
+    if(slice == NULL) return NULL;
 
-            sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
+    if(!cached) {
+        if(slice_decode(sjpeg, &sjpeg->io, sjpeg->tjpeg_jd, sjpeg->workb, frame_index, slice->buf) != LV_RES_OK) {
+            return NULL;
         }
 
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
+        _lv_img_cache_async_lock();
+        slice->frame_index = frame_index;
+        _lv_img_cache_async_unlock();
+    }
+
+#if LV_SJPG_PREFETCH
+    if(frame_index != sjpeg->last_frame_index) prefetch_start(sjpeg, frame_index);
+#endif
+
+    return slice->buf;
+}
+
+/**
+ * Decode a frame
+ * @param sjpeg pointer to an SJPEG
+ * @param io read the data with this source
+ * @param jd the decoder to use
+ * @param workb work buffer of `jd`
+ * @param frame_index index of the frame
+ * @param buf store the pixels here in the native color format
+ * @return LV_RES_OK: no error; LV_RES_INV: invalid data
+ */
+static lv_res_t slice_decode(SJPEG * sjpeg, io_source_t * io, JDEC * jd, uint8_t * workb, int frame_index,
+                             uint8_t * buf)
+{
+    if(io->type == SJPEG_IO_SOURCE_C_ARRAY) {
+        io->raw_sjpg_data = sjpeg->frame_base_array[frame_index];
+        if(frame_index == (sjpeg->sjpeg_total_frames - 1)) {
+            /*This is the last frame. */
+            const uint32_t frame_offset = (uint32_t)(io->raw_sjpg_data - sjpeg->sjpeg_data);
+            io->raw_sjpg_data_size = sjpeg->sjpeg_data_size - frame_offset;
         }
-#elif  LV_COLOR_DEPTH == 16
-
-        for(int i = 0; i < len; i++) {
-            uint16_t col_8bit = (*cache++ & 0xf8) << 8;
-            col_8bit |= (*cache++ & 0xFC) << 3;
-            col_8bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1 || LV_COLOR_16_SWAP == 1
-            buf[offset++] = col_8bit >> 8;
-            buf[offset++] = col_8bit & 0xff;
-#else
-            buf[offset++] = col_8bit & 0xff;
-            buf[offset++] = col_8bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
+        else {
+            io->raw_sjpg_data_size = (uint32_t)(sjpeg->frame_base_array[frame_index + 1] - io->raw_sjpg_data);
         }
+        io->raw_sjpg_data_next_read_pos = 0;
+    }
+    else {
+        io->raw_sjpg_data_next_read_pos = sjpeg->frame_base_offset[frame_index];
+        lv_fs_seek(&io->lv_file, io->raw_sjpg_data_next_read_pos, LV_FS_SEEK_SET);
+    }
 
-#elif  LV_COLOR_DEPTH == 8
+    io->img_cache_buff = buf;
+    io->img_cache_x_res = sjpeg->sjpeg_x_res;
 
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
+    JRESULT rc = jd_prepare(jd, input_func, workb, (size_t)TJPGD_WORKBUFF_SIZE, io);
+    if(rc != JDR_OK) return LV_RES_INV;
+    rc = jd_decomp(jd, img_data_cb, 0);
+    if(rc != JDR_OK) return LV_RES_INV;
 
-#else
-#error Unsupported LV_COLOR_DEPTH
+    return LV_RES_OK;
+}
 
+#if LV_SJPG_PREFETCH
+/**
+ * Let the worker decode the frame which is likely read next: the one after `frame_index` in the reading direction
+ * or if it's cached the one before it.
+ * @param sjpeg pointer to an SJPEG
+ * @param frame_index the frame being read
+ */
+static void prefetch_start(SJPEG * sjpeg, int frame_index)
+{
+    if(sjpeg->last_frame_index >= 0) sjpeg->read_dir = frame_index > sjpeg->last_frame_index ? 1 : -1;
+    sjpeg->last_frame_index = frame_index;
+
+    /*Keep at least one slice for the frame being read*/
+    if(sjpeg->slice_cnt < 2) return;
+
+    sjpeg_slice_t * lru = NULL;
+    int next = -1;
+    _lv_img_cache_async_lock();
+    if(sjpeg->prefetch_slice == NULL) {
+        int candidates[2] = {frame_index + sjpeg->read_dir, frame_index - sjpeg->read_dir};
+        for(int i = 0; i < 2; i++) {
+            if(candidates[i] < 0 || candidates[i] >= sjpeg->sjpeg_total_frames) continue;
+            if(slice_find(sjpeg, candidates[i], frame_index, &lru)) continue;
+            next = candidates[i];
+            break;
+        }
+        if(next >= 0 && lru) {
+            lru->frame_index = -1;
+            lru->last_use = 0;
+            sjpeg->prefetch_slice = lru;
+            sjpeg->prefetch_frame_index = next;
+        }
+    }
+    _lv_img_cache_async_unlock();
 
-#endif // LV_COLOR_DEPTH
+    if(next < 0 || lru == NULL) return;
 
-        return LV_RES_OK;
+    if(!_lv_img_cache_async_call(prefetch_cb, sjpeg)) {
+        /*There is no worker*/
+        _lv_img_cache_async_lock();
+        sjpeg->prefetch_slice = NULL;
+        _lv_img_cache_async_unlock();
     }
-end:
-    return LV_RES_INV;
 }
 
 /**
- * Free the allocated resources
- * @param decoder pointer to the decoder where this function belongs
- * @param dsc pointer to a descriptor which describes this decoding session
+ * Decode a frame on the worker. The worker has its own decoder and source to not disturb the reading of the image.
+ * @param user_data pointer to an SJPEG
  */
-static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+static void prefetch_cb(void * user_data)
 {
-    LV_UNUSED(decoder);
-    /*Free all allocated data*/
-    SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-    if(!sjpeg) return;
-
-    switch(dsc->src_type) {
-        case LV_IMG_SRC_FILE:
-            if(sjpeg->io.lv_file.file_d) {
-                lv_fs_close(&(sjpeg->io.lv_file));
+    SJPEG * sjpeg = user_data;
+
+    _lv_img_cache_async_lock();
+    bool closed = sjpeg->closed;
+    sjpeg_slice_t * slice = sjpeg->prefetch_slice;
+    int frame_index = sjpeg->prefetch_frame_index;
+    _lv_img_cache_async_unlock();
+
+    lv_res_t res = LV_RES_INV;
+    if(!closed) {
+        if(sjpeg->prefetch_jd == NULL) {
+            sjpeg->prefetch_io.type = sjpeg->io.type;
+            if(sjpeg->io.type == SJPEG_IO_SOURCE_DISK) {
+                if(lv_fs_open(&sjpeg->prefetch_io.lv_file, sjpeg->path, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+                    memset(&sjpeg->prefetch_io.lv_file, 0, sizeof(lv_fs_file_t));
+                }
             }
-            lv_sjpg_cleanup(sjpeg);
-            break;
+            sjpeg->prefetch_workb = lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
+            sjpeg->prefetch_jd = lv_mem_alloc(sizeof(JDEC));
+        }
 
-        case LV_IMG_SRC_VARIABLE:
-            lv_sjpg_cleanup(sjpeg);
-            break;
+        bool ready = sjpeg->prefetch_jd && sjpeg->prefetch_workb;
+        if(sjpeg->io.type == SJPEG_IO_SOURCE_DISK && sjpeg->prefetch_io.lv_file.file_d == NULL) ready = false;
+        if(ready) {
+            res = slice_decode(sjpeg, &sjpeg->prefetch_io, sjpeg->prefetch_jd, sjpeg->prefetch_workb, frame_index,
+                               slice->buf);
+        }
+    }
 
-        default:
-            ;
+    _lv_img_cache_async_lock();
+    if(res == LV_RES_OK) {
+        /*Discard it if it was decoded meanwhile on the LVGL thread*/
+        sjpeg_slice_t * lru;
+        if(slice_find(sjpeg, frame_index, -1, &lru) == NULL) {
+            slice->frame_index = frame_index;
+            slice->last_use = sjpeg->slice_use_cnt;
+        }
     }
+    sjpeg->prefetch_slice = NULL;
+    closed = sjpeg->closed;
+    _lv_img_cache_async_unlock();
+
+    /*`sjpeg` can't be used after the unlock unless it was closed meanwhile*/
+    if(closed) lv_sjpg_cleanup(sjpeg);
 }
+#endif
 
 static int is_jpg(const uint8_t * raw_data, size_t len)
 {
@@ -899,7 +1054,19 @@ static int is_jpg(const uint8_t * raw_data, size_t len)
 
 static void lv_sjpg_free(SJPEG * sjpeg)
 {
-    if(sjpeg->frame_cache) lv_mem_free(sjpeg->frame_cache);
+    if(sjpeg->io.lv_file.file_d) lv_fs_close(&sjpeg->io.lv_file);
+    if(sjpeg->slices) {
+        for(int i = 0; i < sjpeg->slice_cnt; i++) {
+            if(sjpeg->slices[i].buf) lv_mem_free(sjpeg->slices[i].buf);
+        }
+        lv_mem_free(sjpeg->slices);
+    }
+#if LV_SJPG_PREFETCH
+    if(sjpeg->prefetch_io.lv_file.file_d) lv_fs_close(&sjpeg->prefetch_io.lv_file);
+    if(sjpeg->prefetch_jd) lv_mem_free(sjpeg->prefetch_jd);
+    if(sjpeg->prefetch_workb) lv_mem_free(sjpeg->prefetch_workb);
+    if(sjpeg->path) lv_mem_free(sjpeg->path);
+#endif
     if(sjpeg->frame_base_array) lv_mem_free(sjpeg->frame_base_array);
     if(sjpeg->frame_base_offset) lv_mem_free(sjpeg->frame_base_offset);
     if(sjpeg->tjpeg_jd) lv_mem_free(sjpeg->tjpeg_jd);
@@ -5,11 +5,16 @@
 #define	JD_SZBUF		512
 /* Specifies size of stream input buffer */
 
+#if LV_COLOR_DEPTH == 16
+#define JD_FORMAT		1
+#else
 #define JD_FORMAT		0
+#endif
 /* Specifies output pixel format.
 /  0: RGB888 (24-bit/pix)
 /  1: RGB565 (16-bit/pix)
 /  2: Grayscale (8-bit/pix)
+/  RGB565 is written directly into the decoded slices with 16 bit color depth.
 */
 
 #define	JD_USE_SCALE	1
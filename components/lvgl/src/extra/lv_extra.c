@@ -86,6 +86,11 @@ void lv_extra_init(void)
     lv_freetype_init(0, 0, 0);
 #  endif
 #endif
+
+#if LV_USE_ASSET_PACK
+    /*The last created decoder is tried first*/
+    lv_asset_pack_init();
+#endif
 }
 
 /**********************
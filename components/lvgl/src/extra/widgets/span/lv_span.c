@@ -22,18 +22,32 @@
  **********************/
 typedef struct {
     lv_span_t * span;
-    const char * txt;
+    uint32_t txt_ofs;       /* start of the snippet in the text of the span */
+    uint32_t bytes;
     const lv_font_t * font;
-    uint16_t   bytes;
     lv_coord_t txt_w;
     lv_coord_t line_h;
     lv_coord_t letter_space;
 } lv_snippet_t;
 
-struct _snippet_stack {
-    lv_snippet_t    stack[LV_SPAN_SNIPPET_STACK_SIZE];
-    uint16_t        index;
-};
+typedef struct {
+    uint32_t snippet_id;    /* index of the first snippet of the line */
+    uint32_t snippet_cnt;
+    lv_coord_t y;           /* top of the line relative to the content area */
+    lv_coord_t h;           /* line height of the tallest snippet */
+    lv_coord_t base_line;   /* base line of the tallest snippet */
+    lv_coord_t next_line_h; /* line height of the first snippet of the next line, to check overflow */
+    lv_coord_t w;           /* width of the snippets (with the indent in the first line) */
+} lv_span_line_t;
+
+/* The spans broken into lines and the lines into snippets. Drawing just replays it. */
+typedef struct _lv_span_layout_t {
+    lv_snippet_t * snippets;
+    lv_span_line_t * lines;
+    uint32_t snippet_cnt;
+    uint32_t line_cnt;
+    lv_coord_t width;       /* the content width the layout was calculated for */
+} lv_span_layout_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -57,16 +71,13 @@ static bool lv_txt_get_snippet(const char * txt, const lv_font_t * font, lv_coor
                                lv_coord_t max_width, lv_text_flag_t flag, lv_coord_t * use_width,
                                uint32_t * end_ofs);
 
-static void lv_snippet_clear(void);
-static uint16_t lv_get_snippet_cnt(void);
-static void lv_snippet_push(lv_snippet_t * item);
-static lv_snippet_t * lv_get_snippet(uint16_t index);
+static const lv_span_layout_t * get_layout(lv_obj_t * obj, lv_coord_t width);
+static void free_layout(lv_obj_t * obj);
 static lv_coord_t convert_indent_pct(lv_obj_t * spans, lv_coord_t width);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
-static struct _snippet_stack snippet_stack;
 
 const lv_obj_class_t lv_spangroup_class  = {
     .base_class = &lv_obj_class,
@@ -396,102 +407,16 @@ lv_coord_t lv_spangroup_get_expand_height(lv_obj_t * obj, lv_coord_t width)
         return 0;
     }
 
-    /* init draw variable */
-    lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
-    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
-    lv_coord_t max_width = width;
-    lv_coord_t indent = convert_indent_pct(obj, max_width);
-    lv_coord_t max_w  = max_width - indent; /* first line need minus indent */
-
-    /* coords of draw span-txt */
-    lv_point_t txt_pos;
-    txt_pos.y = 0;
-    txt_pos.x = 0 + indent; /* first line need add indent */
-
-    lv_span_t * cur_span = _lv_ll_get_head(&spans->child_ll);
-    const char * cur_txt = cur_span->txt;
-    span_text_check(&cur_txt);
-    uint32_t cur_txt_ofs = 0;
-    lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
-    memset(&snippet, 0, sizeof(snippet));
-
-    int32_t line_cnt = 0;
-    int32_t lines = spans->lines < 0 ? INT32_MAX : spans->lines;
-    /* the loop control how many lines need to draw */
-    while(cur_span) {
-        int snippet_cnt = 0;
-        lv_coord_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
-
-        /* the loop control to find a line and push the relevant span info into stack  */
-        while(1) {
-            /* switch to the next span when current is end */
-            if(cur_txt[cur_txt_ofs] == '\0') {
-                cur_span = _lv_ll_get_next(&spans->child_ll, cur_span);
-                if(cur_span == NULL) break;
-                cur_txt = cur_span->txt;
-                span_text_check(&cur_txt);
-                cur_txt_ofs = 0;
-                /* maybe also cur_txt[cur_txt_ofs] == '\0' */
-                continue;
-            }
-
-            /* init span info to snippet. */
-            if(cur_txt_ofs == 0) {
-                snippet.span = cur_span;
-                snippet.font = lv_span_get_style_text_font(obj, cur_span);
-                snippet.letter_space = lv_span_get_style_text_letter_space(obj, cur_span);
-                snippet.line_h = lv_font_get_line_height(snippet.font) + line_space;
-            }
-
-            /* get current span text line info */
-            uint32_t next_ofs = 0;
-            lv_coord_t use_width = 0;
-            bool isfill = lv_txt_get_snippet(&cur_txt[cur_txt_ofs], snippet.font, snippet.letter_space,
-                                             max_w, txt_flag, &use_width, &next_ofs);
+    const lv_span_layout_t * layout = get_layout(obj, width);
+    if(layout == NULL || layout->line_cnt == 0) return 0;
 
-            /* break word deal width */
-            if(isfill && next_ofs > 0 && snippet_cnt > 0) {
-                if(max_w < use_width) {
-                    break;
-                }
+    /* at least one line is shown */
+    uint32_t line_cnt = layout->line_cnt;
+    if(spans->lines >= 0 && (uint32_t)spans->lines < line_cnt) line_cnt = LV_MAX(spans->lines, 1);
 
-                uint32_t tmp_ofs = next_ofs;
-                uint32_t letter = _lv_txt_encoded_prev(&cur_txt[cur_txt_ofs], &tmp_ofs);
-                if(!(letter == '\0' || letter == '\n' || letter == '\r' || _lv_txt_is_break_char(letter))) {
-                    tmp_ofs = 0;
-                    letter = _lv_txt_encoded_next(&cur_txt[cur_txt_ofs + next_ofs], &tmp_ofs);
-                    if(!(letter == '\0' || letter == '\n'  || letter == '\r' || _lv_txt_is_break_char(letter))) {
-                        break;
-                    }
-                }
-            }
-
-            snippet.txt = &cur_txt[cur_txt_ofs];
-            snippet.bytes = next_ofs;
-            snippet.txt_w = use_width;
-            cur_txt_ofs += next_ofs;
-            if(max_line_h < snippet.line_h) {
-                max_line_h = snippet.line_h;
-            }
-            snippet_cnt ++;
-            max_w = max_w - use_width - snippet.letter_space;
-            if(isfill  || max_w <= 0) {
-                break;
-            }
-        }
-
-        /* next line init */
-        txt_pos.x = 0;
-        txt_pos.y += max_line_h;
-        max_w = max_width;
-        line_cnt += 1;
-        if(line_cnt >= lines) {
-            break;
-        }
-    }
-    txt_pos.y -= line_space;
-
-    return txt_pos.y;
+    const lv_span_line_t * last_line = &layout->lines[line_cnt - 1];
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    return last_line->y + last_line->h - line_space;
 }
 
 /**********************
@@ -509,6 +434,7 @@ static void lv_spangroup_constructor(const lv_obj_class_t * class_p, lv_obj_t *
     spans->overflow = LV_SPAN_OVERFLOW_CLIP;
     spans->cache_w = 0;
     spans->cache_h = 0;
+    spans->layout = NULL;
     spans->refresh = 1;
 }
 
@@ -526,6 +452,8 @@ static void lv_spangroup_destructor(const lv_obj_class_t * class_p, lv_obj_t * o
         lv_mem_free(cur_span);
         cur_span = _lv_ll_get_head(&spans->child_ll);
     }
+
+    free_layout(obj);
 }
 
 static void lv_spangroup_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -617,32 +545,6 @@ static bool lv_txt_get_snippet(const char * txt, const lv_font_t * font,
     }
 }
 
-static void lv_snippet_push(lv_snippet_t * item)
-{
-    if(snippet_stack.index < LV_SPAN_SNIPPET_STACK_SIZE) {
-        memcpy(&snippet_stack.stack[snippet_stack.index], item, sizeof(lv_snippet_t));
-        snippet_stack.index++;
-    }
-    else {
-        LV_LOG_ERROR("span draw stack overflow, please set LV_SPAN_SNIPPET_STACK_SIZE too larger");
-    }
-}
-
-static uint16_t lv_get_snippet_cnt(void)
-{
-    return snippet_stack.index;
-}
-
-static lv_snippet_t * lv_get_snippet(uint16_t index)
-{
-    return &snippet_stack.stack[index];
-}
-
-static void lv_snippet_clear(void)
-{
-    snippet_stack.index = 0;
-}
-
 static const lv_font_t * lv_span_get_style_text_font(lv_obj_t * par, lv_span_t * span)
 {
     const lv_font_t * font;
@@ -749,63 +651,95 @@ static lv_coord_t convert_indent_pct(lv_obj_t * obj, lv_coord_t width)
 }
 
 /**
- * draw span group
- * @param spans obj handle
- * @param coords coordinates of the label
- * @param mask the label will be drawn only in this area
+ * Add a snippet to the end of the layout
+ * @param layout pointer to a layout
+ * @param snippet the snippet to add
+ * @param size the allocated number of snippets, updated if the array grows
+ * @return false: out of memory
  */
-static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
+static bool layout_push_snippet(lv_span_layout_t * layout, const lv_snippet_t * snippet, uint32_t * size)
 {
+    if(layout->snippet_cnt >= *size) {
+        uint32_t new_size = *size ? *size * 2 : 8;
+        lv_snippet_t * tmp = lv_mem_realloc(layout->snippets, new_size * sizeof(lv_snippet_t));
+        if(tmp == NULL) return false;
+        layout->snippets = tmp;
+        *size = new_size;
+    }
 
-    lv_area_t coords;
-    lv_obj_get_content_coords(obj, &coords);
+    layout->snippets[layout->snippet_cnt] = *snippet;
+    layout->snippet_cnt++;
+    return true;
+}
+
+/**
+ * Add an empty line to the end of the layout
+ * @param layout pointer to a layout
+ * @param size the allocated number of lines, updated if the array grows
+ * @return pointer to the new line or NULL if out of memory
+ */
+static lv_span_line_t * layout_push_line(lv_span_layout_t * layout, uint32_t * size)
+{
+    if(layout->line_cnt >= *size) {
+        uint32_t new_size = *size ? *size * 2 : 4;
+        lv_span_line_t * tmp = lv_mem_realloc(layout->lines, new_size * sizeof(lv_span_line_t));
+        if(tmp == NULL) return NULL;
+        layout->lines = tmp;
+        *size = new_size;
+    }
 
+    lv_span_line_t * line = &layout->lines[layout->line_cnt];
+    lv_memset_00(line, sizeof(lv_span_line_t));
+    line->snippet_id = layout->snippet_cnt;
+    layout->line_cnt++;
+    return line;
+}
+
+/**
+ * Break the spans into lines for a width, or return the result of the last call if nothing has changed since then
+ * @param obj pointer to a spangroup
+ * @param width width of the content area
+ * @return the lines and snippets or NULL if out of memory
+ */
+static const lv_span_layout_t * get_layout(lv_obj_t * obj, lv_coord_t width)
+{
     lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+    if(spans->layout && spans->layout->width == width) return spans->layout;
 
-    /* return if not span */
-    if(_lv_ll_get_head(&spans->child_ll) == NULL) {
-        return;
-    }
+    free_layout(obj);
 
-    /* return if no draw area */
-    lv_area_t clip_area;
-    if(!_lv_area_intersect(&clip_area, &coords, draw_ctx->clip_area))  return;
-    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
-    draw_ctx->clip_area = &clip_area;
+    lv_span_layout_t * layout = lv_mem_alloc(sizeof(lv_span_layout_t));
+    LV_ASSERT_MALLOC(layout);
+    if(layout == NULL) return NULL;
+    lv_memset_00(layout, sizeof(lv_span_layout_t));
+    layout->width = width;
 
     /* init draw variable */
     lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
-    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);;
-    lv_coord_t max_width = lv_area_get_width(&coords);
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    lv_coord_t max_width = width;
     lv_coord_t indent = convert_indent_pct(obj, max_width);
     lv_coord_t max_w  = max_width - indent; /* first line need minus indent */
-    lv_opa_t obj_opa = lv_obj_get_style_opa(obj, LV_PART_MAIN);
-
-    /* coords of draw span-txt */
-    lv_point_t txt_pos;
-    txt_pos.y = coords.y1;
-    txt_pos.x = coords.x1 + indent; /* first line need add indent */
+    lv_coord_t line_y = 0;
 
     lv_span_t * cur_span = _lv_ll_get_head(&spans->child_ll);
-    const char * cur_txt = cur_span->txt;
+    const char * cur_txt = cur_span ? cur_span->txt : "";
     span_text_check(&cur_txt);
     uint32_t cur_txt_ofs = 0;
-    lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
+    lv_snippet_t snippet;   /* use to save cur_span info and push it to the layout */
     lv_memset_00(&snippet, sizeof(snippet));
 
-    lv_draw_label_dsc_t label_draw_dsc;
-    lv_draw_label_dsc_init(&label_draw_dsc);
-
+    uint32_t snippet_size = 0;
+    uint32_t line_size = 0;
     bool is_first_line = true;
     /* the loop control how many lines need to draw */
     while(cur_span) {
-        bool is_end_line = false;
-        bool ellipsis_valid = false;
-        lv_coord_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
-        lv_coord_t max_baseline = 0; /*baseline of the highest span*/
-        lv_snippet_clear();
+        lv_span_line_t * line = layout_push_line(layout, &line_size);
+        if(line == NULL) goto out_of_memory;
+        line->y = line_y;
+        line->w = is_first_line ? indent : 0;
 
-        /* the loop control to find a line and push the relevant span info into stack  */
+        /* the loop control to find a line and push the relevant span info into the layout */
         while(1) {
             /* switch to the next span when current is end */
             if(cur_txt[cur_txt_ofs] == '\0') {
@@ -833,9 +767,9 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
                                              max_w, txt_flag, &use_width, &next_ofs);
 
             if(isfill) {
-                if(next_ofs > 0 && lv_get_snippet_cnt() > 0) {
+                if(next_ofs > 0 && line->snippet_cnt > 0) {
                     /* To prevent infinite loops, the _lv_txt_get_next_line() may return incomplete words, */
-                    /* This phenomenon should be avoided when lv_get_snippet_cnt() > 0 */
+                    /* This phenomenon should be avoided when the line already has snippets */
                     if(max_w < use_width) {
                         break;
                     }
@@ -851,67 +785,157 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
                 }
             }
 
-            snippet.txt = &cur_txt[cur_txt_ofs];
+            snippet.txt_ofs = cur_txt_ofs;
             snippet.bytes = next_ofs;
             snippet.txt_w = use_width;
             cur_txt_ofs += next_ofs;
-            if(max_line_h < snippet.line_h) {
-                max_line_h = snippet.line_h;
-                max_baseline = snippet.font->base_line;
+            if(line->h < snippet.line_h) {
+                line->h = snippet.line_h;
+                line->base_line = snippet.font->base_line;
+            }
+
+            if(line->snippet_cnt < LV_SPAN_SNIPPET_STACK_SIZE) {
+                if(!layout_push_snippet(layout, &snippet, &snippet_size)) goto out_of_memory;
+                line->snippet_cnt++;
+                line->w += use_width + snippet.letter_space;
+            }
+            else {
+                LV_LOG_ERROR("span draw stack overflow, please set LV_SPAN_SNIPPET_STACK_SIZE too larger");
             }
 
-            lv_snippet_push(&snippet);
             max_w = max_w - use_width - snippet.letter_space;
             if(isfill || max_w <= 0) {
                 break;
             }
         }
 
-        /* start current line deal with */
-
-        uint16_t item_cnt = lv_get_snippet_cnt();
-        if(item_cnt == 0) {     /* break if stack is empty */
+        if(line->snippet_cnt == 0) {     /* drop the empty last line */
+            layout->line_cnt--;
             break;
         }
 
-        /* Whether the current line is the end line and does overflow processing */
-        {
-            lv_snippet_t * last_snippet = lv_get_snippet(item_cnt - 1);
-            lv_coord_t next_line_h = last_snippet->line_h;
-            if(last_snippet->txt[last_snippet->bytes] == '\0') {
-                next_line_h = 0;
-                lv_span_t * next_span = _lv_ll_get_next(&spans->child_ll, last_snippet->span);
-                if(next_span) { /* have the next line */
-                    next_line_h = lv_font_get_line_height(lv_span_get_style_text_font(obj, next_span)) + line_space;
-                }
+        /* the height of the next line is used to find the last visible line */
+        const lv_snippet_t * last_snippet = &layout->snippets[line->snippet_id + line->snippet_cnt - 1];
+        line->w -= last_snippet->letter_space;
+        const char * last_txt = last_snippet->span->txt;
+        span_text_check(&last_txt);
+        line->next_line_h = last_snippet->line_h;
+        if(last_txt[last_snippet->txt_ofs + last_snippet->bytes] == '\0') {
+            line->next_line_h = 0;
+            lv_span_t * next_span = _lv_ll_get_next(&spans->child_ll, last_snippet->span);
+            if(next_span) { /* have the next line */
+                line->next_line_h = lv_font_get_line_height(lv_span_get_style_text_font(obj, next_span)) + line_space;
             }
-            if(txt_pos.y + max_line_h + next_line_h - line_space > coords.y2 + 1) { /* for overflow if is end line. */
-                if(last_snippet->txt[last_snippet->bytes] != '\0') {
-                    last_snippet->bytes = strlen(last_snippet->txt);
-                    last_snippet->txt_w = lv_txt_get_width(last_snippet->txt, last_snippet->bytes, last_snippet->font,
-                                                           last_snippet->letter_space, txt_flag);
-                }
-                ellipsis_valid = spans->overflow == LV_SPAN_OVERFLOW_ELLIPSIS ? true : false;
-                is_end_line = true;
+        }
+
+        /* next line init */
+        is_first_line = false;
+        line_y += line->h;
+        max_w = max_width;
+    }
+
+    spans->layout = layout;
+    return layout;
+
+out_of_memory:
+    LV_LOG_WARN("couldn't allocate the layout of the spans");
+    lv_mem_free(layout->snippets);
+    lv_mem_free(layout->lines);
+    lv_mem_free(layout);
+    return NULL;
+}
+
+static void free_layout(lv_obj_t * obj)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+    if(spans->layout == NULL) return;
+
+    lv_mem_free(spans->layout->snippets);
+    lv_mem_free(spans->layout->lines);
+    lv_mem_free(spans->layout);
+    spans->layout = NULL;
+}
+
+/**
+ * draw span group
+ * @param spans obj handle
+ * @param coords coordinates of the label
+ * @param mask the label will be drawn only in this area
+ */
+static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
+{
+
+    lv_area_t coords;
+    lv_obj_get_content_coords(obj, &coords);
+
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+
+    /* return if not span */
+    if(_lv_ll_get_head(&spans->child_ll) == NULL) {
+        return;
+    }
+
+    /* return if no draw area */
+    lv_area_t clip_area;
+    if(!_lv_area_intersect(&clip_area, &coords, draw_ctx->clip_area))  return;
+
+    /* the spans are broken into lines only if they or the width have changed */
+    lv_coord_t max_width = lv_area_get_width(&coords);
+    const lv_span_layout_t * layout = get_layout(obj, max_width);
+    if(layout == NULL) return;
+
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    draw_ctx->clip_area = &clip_area;
+
+    /* init draw variable */
+    lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    lv_coord_t indent = convert_indent_pct(obj, max_width);
+    lv_opa_t obj_opa = lv_obj_get_style_opa(obj, LV_PART_MAIN);
+    lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
+
+    lv_draw_label_dsc_t label_draw_dsc;
+    lv_draw_label_dsc_init(&label_draw_dsc);
+
+    uint32_t line_id;
+    for(line_id = 0; line_id < layout->line_cnt; line_id++) {
+        const lv_span_line_t * line = &layout->lines[line_id];
+
+        /* coords of draw span-txt */
+        lv_point_t txt_pos;
+        txt_pos.y = coords.y1 + line->y;
+        txt_pos.x = coords.x1 + (line_id == 0 ? indent : 0); /* first line need add indent */
+        if(txt_pos.y > clip_area.y2) break;
+
+        /* Whether the current line is the end line and does overflow processing */
+        bool is_end_line = false;
+        bool ellipsis_valid = false;
+        lv_coord_t line_w = line->w;
+        lv_snippet_t last_snippet = layout->snippets[line->snippet_id + line->snippet_cnt - 1];
+        if(txt_pos.y + line->h + line->next_line_h - line_space > coords.y2 + 1) { /* for overflow if is end line. */
+            const char * last_txt = last_snippet.span->txt;
+            span_text_check(&last_txt);
+            last_txt += last_snippet.txt_ofs;
+            if(last_txt[last_snippet.bytes] != '\0') {
+                line_w -= last_snippet.txt_w;
+                last_snippet.bytes = strlen(last_txt);
+                last_snippet.txt_w = lv_txt_get_width(last_txt, last_snippet.bytes, last_snippet.font,
+                                                      last_snippet.letter_space, txt_flag);
+                line_w += last_snippet.txt_w;
             }
+            ellipsis_valid = spans->overflow == LV_SPAN_OVERFLOW_ELLIPSIS ? true : false;
+            is_end_line = true;
         }
 
         /*Go the first visible line*/
-        if(txt_pos.y + max_line_h < clip_area.y1) {
-            goto Next_line_init;
+        if(txt_pos.y + line->h < clip_area.y1) {
+            if(is_end_line) break;
+            continue;
         }
 
         /* align deal with */
-        lv_text_align_t align = lv_obj_get_style_text_align(obj, LV_PART_MAIN);
         if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
-            lv_coord_t align_ofs = 0;
-            lv_coord_t txts_w = is_first_line ? indent : 0;
-            for(int i = 0; i < item_cnt; i++) {
-                lv_snippet_t * pinfo = lv_get_snippet(i);
-                txts_w = txts_w + pinfo->txt_w + pinfo->letter_space;
-            }
-            txts_w -= lv_get_snippet(item_cnt - 1)->letter_space;
-            align_ofs = max_width > txts_w ? max_width - txts_w : 0;
+            lv_coord_t align_ofs = max_width > line_w ? max_width - line_w : 0;
             if(align == LV_TEXT_ALIGN_CENTER) {
                 align_ofs = align_ofs >> 1;
             }
@@ -919,19 +943,22 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
         }
 
         /* draw line letters */
-        int i;
-        for(i = 0; i < item_cnt; i++) {
-            lv_snippet_t * pinfo = lv_get_snippet(i);
+        uint32_t i;
+        for(i = 0; i < line->snippet_cnt; i++) {
+            const lv_snippet_t * pinfo = &layout->snippets[line->snippet_id + i];
+            if(i == line->snippet_cnt - 1) pinfo = &last_snippet;
 
             /* bidi deal with:todo */
-            const char * bidi_txt = pinfo->txt;
+            const char * bidi_txt = pinfo->span->txt;
+            span_text_check(&bidi_txt);
+            bidi_txt += pinfo->txt_ofs;
 
             lv_point_t pos;
             pos.x = txt_pos.x;
-            pos.y = txt_pos.y + max_line_h - pinfo->line_h - (max_baseline - pinfo->font->base_line);
+            pos.y = txt_pos.y + line->h - pinfo->line_h - (line->base_line - pinfo->font->base_line);
             label_draw_dsc.color = lv_span_get_style_text_color(obj, pinfo->span);
             label_draw_dsc.opa = lv_span_get_style_text_opa(obj, pinfo->span);
-            label_draw_dsc.font = lv_span_get_style_text_font(obj, pinfo->span);
+            label_draw_dsc.font = pinfo->font;
             label_draw_dsc.blend_mode = lv_span_get_style_text_blend_mode(obj, pinfo->span);
             if(obj_opa < LV_OPA_MAX) {
                 label_draw_dsc.opa = (uint16_t)((uint16_t)label_draw_dsc.opa * obj_opa) >> 8;
@@ -948,7 +975,7 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
             lv_coord_t ellipsis_width = coords.x1 + max_width - dot_width;
 
             uint32_t j = 0;
-            while(j < txt_bytes) {
+            while(j < txt_bytes && bidi_txt[j] != '\0') {
                 /* skip invalid fields */
                 if(pos.x > clip_area.x2) {
                     break;
@@ -1016,16 +1043,7 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
             txt_pos.x = pos.x;
         }
 
-Next_line_init:
-        /* next line init */
-        is_first_line = false;
-        txt_pos.x = coords.x1;
-        txt_pos.y += max_line_h;
-        if(is_end_line || txt_pos.y > clip_area.y2 + 1) {
-            draw_ctx->clip_area = clip_area_ori;
-            return;
-        }
-        max_w = max_width;
+        if(is_end_line) break;
     }
     draw_ctx->clip_area = clip_area_ori;
 }
@@ -1034,6 +1052,7 @@ static void refresh_self_size(lv_obj_t * obj)
 {
     lv_spangroup_t * spans = (lv_spangroup_t *)obj;
     spans->refresh = 1;
+    free_layout(obj);
     lv_obj_invalidate(obj);
     lv_obj_refresh_self_size(obj);
 }
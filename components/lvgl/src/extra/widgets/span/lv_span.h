@@ -55,6 +55,7 @@ typedef struct {
     lv_coord_t cache_w;     /* the cache automatically calculates the width */
     lv_coord_t cache_h;     /* similar cache_w */
     lv_ll_t  child_ll;
+    struct _lv_span_layout_t * layout;  /* the lines and snippets of the spans, NULL if not calculated yet */
     uint8_t mode : 2;       /* details see lv_span_mode_t */
     uint8_t overflow : 1;   /* details see lv_span_overflow_t */
     uint8_t refresh : 1;    /* the spangroup need refresh cache_w and cache_h */
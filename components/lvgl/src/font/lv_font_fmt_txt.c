@@ -18,49 +18,117 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_FONT_FMT_TXT_CACHE_SIZE & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)
+    #error "LV_FONT_FMT_TXT_CACHE_SIZE must be a power of 2"
+#endif
+
+#define GLYPH_CACHE_BUCKET_CNT  32  /*Number of hash buckets of the glyph cache. Must be a power of 2.*/
+#define GLYPH_CACHE_BUCKET_ID(fdsc, gid) \
+    (((gid) ^ (uint32_t)((lv_uintptr_t)(fdsc) >> 4)) & (GLYPH_CACHE_BUCKET_CNT - 1))
+#define GLYPH_CACHE_ALIGN(size) (((size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+#define GLYPH_CACHE_BUF_SIZE    (LV_FONT_GLYPH_CACHE_SIZE & ~(sizeof(void *) - 1))
+
+#if LV_FONT_GLYPH_CACHE_SIZE > 0 && LV_FONT_GLYPH_CACHE_SIZE < 256
+    #error "LV_FONT_GLYPH_CACHE_SIZE must be 0 or at least 256"
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
-typedef enum {
-    RLE_STATE_SINGLE = 0,
-    RLE_STATE_REPEATE,
-    RLE_STATE_COUNTER,
-} rle_state_t;
+#if LV_USE_FONT_COMPRESSED
+/*Read the RLE stream from the MSB of a bit buffer*/
+typedef struct {
+    const uint8_t * in;     /*The next byte to load*/
+    uint32_t buf;           /*The loaded bits aligned to the MSB, the rest is 0*/
+    uint32_t bit_cnt;       /*Number of loaded bits*/
+} rle_reader_t;
+#endif
+
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+typedef struct _glyph_cache_entry_t {
+    struct _glyph_cache_entry_t * bucket_next;  /*Next entry in the same hash bucket*/
+    struct _glyph_cache_entry_t * prev;         /*The more recently used neighbor*/
+    struct _glyph_cache_entry_t * next;         /*The less recently used neighbor*/
+    const lv_font_fmt_txt_dsc_t * fdsc;         /*NULL: it's a free block*/
+    uint32_t gid;
+    uint32_t size;                              /*Size of the block with the bitmap in bytes*/
+    /*The 8 bpp bitmap is stored right after the entry*/
+} glyph_cache_entry_t;
+
+/*The entries are stored in a buffer of `GLYPH_CACHE_BUF_SIZE` bytes which is allocated only once,
+ *so the cache doesn't fragment the heap. The buffer is split into blocks, each is a glyph or free space.
+ *The least recently used glyphs are dropped until a free block is large enough for a new glyph.*/
+typedef struct {
+    glyph_cache_entry_t * buckets[GLYPH_CACHE_BUCKET_CNT];
+    glyph_cache_entry_t * head;                 /*The most recently used entry*/
+    glyph_cache_entry_t * tail;                 /*The least recently used entry, dropped first*/
+    /*The buffer of the entries is stored right after the cache*/
+} glyph_cache_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
-static int32_t unicode_list_compare(const void * ref, const void * element);
-static int32_t kern_pair_8_compare(const void * ref, const void * element);
-static int32_t kern_pair_16_compare(const void * ref, const void * element);
+static uint32_t cmap_find(const lv_font_fmt_txt_cmap_t * cmap, uint32_t rcp);
+static uint32_t cmap_hash_find(const lv_font_fmt_txt_cmap_hash_t * hash, uint32_t letter);
+static inline uint32_t cmap_hash_mix(uint32_t letter, uint32_t seed);
+static int32_t unicode_list_search(const uint16_t * list, uint32_t len, uint32_t rcp);
+static int32_t kern_pair_8_search(const uint8_t * glyph_ids, uint32_t pair_cnt, uint32_t left, uint32_t right);
+static int32_t kern_pair_16_search(const uint16_t * glyph_ids, uint32_t pair_cnt, uint32_t left, uint32_t right);
+static const lv_font_fmt_txt_glyph_dsc_t * get_glyph_fmt_dsc(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid,
+                                                              lv_font_fmt_txt_glyph_dsc_t * buf);
+static const uint8_t * get_glyph_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid,
+                                        const lv_font_fmt_txt_glyph_dsc_t * gdsc, uint8_t * out);
+#if LV_FONT_GLYPH_CACHE_SIZE > 0 || LV_USE_FONT_COMPRESSED
+    static uint8_t * get_tmp_buf(uint32_t size);
+#endif
+
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    static inline bool glyph_cache_is_used(const lv_font_fmt_txt_dsc_t * fdsc);
+    static const uint8_t * glyph_cache_get(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid);
+    static glyph_cache_entry_t * glyph_cache_alloc(glyph_cache_t * cache, uint32_t size);
+    static void glyph_cache_drop(glyph_cache_t * cache, glyph_cache_entry_t * entry);
+    static void glyph_cache_lru_add(glyph_cache_t * cache, glyph_cache_entry_t * entry);
+    static void glyph_cache_lru_remove(glyph_cache_t * cache, glyph_cache_entry_t * entry);
+    static void expand_to_a8(const uint8_t * in, uint8_t * out, uint32_t px_cnt, uint8_t bpp);
+#endif
 
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord_t h, uint8_t bpp, bool prefilter);
-    static inline void decompress_line(uint8_t * out, lv_coord_t w);
-    static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len);
-    static inline void bits_write(uint8_t * out, uint32_t bit_pos, uint8_t val, uint8_t len);
-    static inline void rle_init(const uint8_t * in,  uint8_t bpp);
-    static inline uint8_t rle_next(void);
+    static inline uint32_t rle_read(rle_reader_t * rd, uint32_t len);
+    static inline uint32_t rle_read_ones(rle_reader_t * rd, uint32_t max);
 #endif /*LV_USE_FONT_COMPRESSED*/
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 #if LV_USE_FONT_COMPRESSED
-    static uint32_t rle_rdp;
-    static const uint8_t * rle_in;
-    static uint8_t rle_bpp;
-    static uint8_t rle_prev_v;
-    static uint8_t rle_cnt;
-    static rle_state_t rle_state;
+/*Number of leading 1 bits in a byte*/
+static const uint8_t rle_ones_table[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 7, 8
+};
+
+/*3 bpp values are upscaled to 4 bpp (0, 2, 4, 6, 9, 11, 13, 15) and mapped as 4 bpp opacities*/
+static const uint8_t rle_bpp3_opa_table[8] = {0, 34, 68, 102, 153, 187, 221, 255};
 #endif /*LV_USE_FONT_COMPRESSED*/
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
+#if LV_FONT_GLYPH_CACHE_SIZE > 0 || LV_USE_FONT_COMPRESSED
+    extern const uint8_t _lv_bpp1_opa_table[2];
+    extern const uint8_t _lv_bpp2_opa_table[4];
+    extern const uint8_t _lv_bpp4_opa_table[16];
+#endif
 
 /**********************
  *      MACROS
@@ -84,57 +152,15 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
     uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
     if(!gid) return NULL;
 
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
-
-    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
-        return &fdsc->glyph_bitmap[gdsc->bitmap_index];
-    }
-    /*Handle compressed bitmap*/
-    else {
-#if LV_USE_FONT_COMPRESSED
-        static size_t last_buf_size = 0;
-        if(LV_GC_ROOT(_lv_font_decompr_buf) == NULL) last_buf_size = 0;
-
-        uint32_t gsize = gdsc->box_w * gdsc->box_h;
-        if(gsize == 0) return NULL;
-
-        uint32_t buf_size = gsize;
-        /*Compute memory size needed to hold decompressed glyph, rounding up*/
-        switch(fdsc->bpp) {
-            case 1:
-                buf_size = (gsize + 7) >> 3;
-                break;
-            case 2:
-                buf_size = (gsize + 3) >> 2;
-                break;
-            case 3:
-                buf_size = (gsize + 1) >> 1;
-                break;
-            case 4:
-                buf_size = (gsize + 1) >> 1;
-                break;
-        }
-
-        if(last_buf_size < buf_size) {
-            uint8_t * tmp = lv_mem_realloc(LV_GC_ROOT(_lv_font_decompr_buf), buf_size);
-            LV_ASSERT_MALLOC(tmp);
-            if(tmp == NULL) return NULL;
-            LV_GC_ROOT(_lv_font_decompr_buf) = tmp;
-            last_buf_size = buf_size;
-        }
-
-        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], LV_GC_ROOT(_lv_font_decompr_buf), gdsc->box_w, gdsc->box_h,
-                   (uint8_t)fdsc->bpp, prefilter);
-        return LV_GC_ROOT(_lv_font_decompr_buf);
-#else /*!LV_USE_FONT_COMPRESSED*/
-        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache_is_used(fdsc)) return glyph_cache_get(fdsc, gid);
 #endif
-    }
 
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
+    lv_font_fmt_txt_glyph_dsc_t gdsc_buf;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = get_glyph_fmt_dsc(fdsc, gid, &gdsc_buf);
+    if(gdsc == NULL) return NULL;
+
+    return get_glyph_bitmap(fdsc, gid, gdsc, NULL);
 }
 
 /**
@@ -157,6 +183,10 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
     if(!gid) return false;
 
+    lv_font_fmt_txt_glyph_dsc_t gdsc_buf;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = get_glyph_fmt_dsc(fdsc, gid, &gdsc_buf);
+    if(gdsc == NULL) return false;
+
     int8_t kvalue = 0;
     if(fdsc->kern_dsc) {
         uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
@@ -166,8 +196,6 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     }
 
     /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
-
     int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
 
     uint32_t adv_w = gdsc->adv_w;
@@ -181,7 +209,11 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     dsc_out->box_w = gdsc->box_w;
     dsc_out->ofs_x = gdsc->ofs_x;
     dsc_out->ofs_y = gdsc->ofs_y;
-    dsc_out->bpp   = (uint8_t)fdsc->bpp;
+    /*The glyph cache and the decompression return the bitmaps with 8 bpp*/
+    dsc_out->bpp   = fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN ? (uint8_t)fdsc->bpp : 8;
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache_is_used(fdsc)) dsc_out->bpp = 8;
+#endif
     dsc_out->is_placeholder = false;
 
     if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
@@ -194,11 +226,36 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
  */
 void _lv_font_clean_up_fmt_txt(void)
 {
-#if LV_USE_FONT_COMPRESSED
     if(LV_GC_ROOT(_lv_font_decompr_buf)) {
         lv_mem_free(LV_GC_ROOT(_lv_font_decompr_buf));
         LV_GC_ROOT(_lv_font_decompr_buf) = NULL;
     }
+}
+
+/**
+ * Remove the glyphs of a font from the glyph cache.
+ * Needs to be called before freeing a font which was created at run time (e.g. loaded from a file).
+ * @param font pointer to a font or NULL to remove all glyphs
+ */
+void lv_font_fmt_txt_glyph_cache_invalidate(const lv_font_t * font)
+{
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+    glyph_cache_t * cache = LV_GC_ROOT(_lv_font_glyph_cache);
+    if(cache == NULL) return;
+
+    glyph_cache_entry_t * entry = cache->head;
+    while(entry) {
+        glyph_cache_entry_t * next = entry->next;
+        if(font == NULL || entry->fdsc == font->dsc) glyph_cache_drop(cache, entry);
+        entry = next;
+    }
+
+    if(font == NULL) {
+        lv_mem_free(cache);
+        LV_GC_ROOT(_lv_font_glyph_cache) = NULL;
+    }
+#else
+    LV_UNUSED(font);
 #endif
 }
 
@@ -213,58 +270,102 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
     /*Check the cache first*/
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    uint32_t cache_id = letter & (LV_FONT_FMT_TXT_CACHE_SIZE - 1);
+    if(fdsc->cache && letter == fdsc->cache->letters[cache_id]) return fdsc->cache->glyph_ids[cache_id];
+#else
     if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+#endif
 
-    uint16_t i;
-    for(i = 0; i < fdsc->cmap_num; i++) {
-
-        /*Relative code point*/
-        uint32_t rcp = letter - fdsc->cmaps[i].range_start;
-        if(rcp > fdsc->cmaps[i].range_length) continue;
-        uint32_t glyph_id = 0;
-        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
-            glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
-            const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
-            glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
-            uint16_t key = rcp;
-            uint16_t * p = _lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                             sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + ofs;
-            }
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
-            uint16_t key = rcp;
-            uint16_t * p = _lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                             sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
-            }
-        }
+    uint32_t glyph_id = 0;
+    if(fdsc->cmap_hash) {
+        glyph_id = cmap_hash_find(fdsc->cmap_hash, letter);
+    }
+    else {
+        uint16_t i;
+        for(i = 0; i < fdsc->cmap_num; i++) {
+            /*Relative code point*/
+            uint32_t rcp = letter - fdsc->cmaps[i].range_start;
+            if(rcp >= fdsc->cmaps[i].range_length) continue;
 
-        /*Update the cache*/
-        if(fdsc->cache) {
-            fdsc->cache->last_letter = letter;
-            fdsc->cache->last_glyph_id = glyph_id;
+            glyph_id = cmap_find(&fdsc->cmaps[i], rcp);
+            break;
         }
-        return glyph_id;
     }
 
+    /*Update the cache*/
     if(fdsc->cache) {
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+        fdsc->cache->letters[cache_id] = letter;
+        fdsc->cache->glyph_ids[cache_id] = glyph_id;
+#else
         fdsc->cache->last_letter = letter;
-        fdsc->cache->last_glyph_id = 0;
+        fdsc->cache->last_glyph_id = glyph_id;
+#endif
     }
+    return glyph_id;
+}
+
+/**
+ * Get the glyph ID of a relative code point from a character map
+ * @param cmap pointer to a character map
+ * @param rcp the relative code point (code point - `range_start`), smaller than `range_length`
+ * @return the glyph ID or 0 if not found
+ */
+static uint32_t cmap_find(const lv_font_fmt_txt_cmap_t * cmap, uint32_t rcp)
+{
+    if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+        return cmap->glyph_id_start + rcp;
+    }
+    else if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+        const uint8_t * gid_ofs_8 = cmap->glyph_id_ofs_list;
+        return cmap->glyph_id_start + gid_ofs_8[rcp];
+    }
+    else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+        int32_t ofs = unicode_list_search(cmap->unicode_list, cmap->list_length, rcp);
+        if(ofs >= 0) return cmap->glyph_id_start + ofs;
+    }
+    else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+        int32_t ofs = unicode_list_search(cmap->unicode_list, cmap->list_length, rcp);
+        if(ofs >= 0) {
+            const uint16_t * gid_ofs_16 = cmap->glyph_id_ofs_list;
+            return cmap->glyph_id_start + gid_ofs_16[ofs];
+        }
+    }
+
     return 0;
+}
+
+/**
+ * Get the glyph ID of a letter from the perfect hash table of the font.
+ * The hash is "hash and displace": the letter selects a bucket whose seed gives a collision free slot.
+ * @param hash pointer to the hash table
+ * @param letter a Unicode letter
+ * @return the glyph ID or 0 if not found
+ */
+static uint32_t cmap_hash_find(const lv_font_fmt_txt_cmap_hash_t * hash, uint32_t letter)
+{
+    uint32_t seed = hash->seeds[cmap_hash_mix(letter, 0) % hash->bucket_cnt];
+    uint32_t slot = cmap_hash_mix(letter, seed + 1) % hash->slot_cnt;
+
+    return hash->letters[slot] == letter ? hash->glyph_ids[slot] : 0;
+}
 
+/**
+ * Hash function of the perfect hash cmaps. Must be the same as in `scripts/font_cmap_hash.py`.
+ * @param letter a Unicode letter
+ * @param seed the seed of the bucket or 0 to select the bucket
+ * @return the hash value
+ */
+static inline uint32_t cmap_hash_mix(uint32_t letter, uint32_t seed)
+{
+    uint32_t x = letter ^ (seed * 0x9E3779B9U);
+    x ^= x >> 16;
+    x *= 0x85EBCA6BU;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35U;
+    x ^= x >> 16;
+    return x;
 }
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
@@ -275,37 +376,45 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
 
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+        /*Check the cache first. The pairs are searched in a table, so it's worth to cache them.*/
+        uint32_t cache_key = 0;
+        uint32_t cache_id = 0;
+        if(fdsc->cache && gid_left <= 0xFFFF && gid_right <= 0xFFFF) {
+            cache_key = (gid_left << 16) | gid_right;
+            cache_id = (gid_left * 7 + gid_right) & (LV_FONT_FMT_TXT_CACHE_SIZE - 1);
+            if(fdsc->cache->kern_pairs[cache_id] == cache_key) return fdsc->cache->kern_values[cache_id];
+        }
+#endif
+
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+        int32_t ofs = -1;
         if(kdsc->glyph_ids_size == 0) {
             /*Use binary search to find the kern value.
              *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint16_t * g_ids = kdsc->glyph_ids;
-            uint16_t g_id_both = (gid_right << 8) + gid_left; /*Create one number from the ids*/
-            uint16_t * kid_p = _lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
+            if(gid_left <= 0xFF && gid_right <= 0xFF) {
+                ofs = kern_pair_8_search(kdsc->glyph_ids, kdsc->pair_cnt, gid_left, gid_right);
             }
         }
         else if(kdsc->glyph_ids_size == 1) {
             /*Use binary search to find the kern value.
              *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint32_t * g_ids = kdsc->glyph_ids;
-            uint32_t g_id_both = (gid_right << 16) + gid_left; /*Create one number from the ids*/
-            uint32_t * kid_p = _lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
+            if(gid_left <= 0xFFFF && gid_right <= 0xFFFF) {
+                ofs = kern_pair_16_search(kdsc->glyph_ids, kdsc->pair_cnt, gid_left, gid_right);
             }
-
         }
         else {
             /*Invalid value*/
         }
+
+        if(ofs >= 0) value = kdsc->values[ofs];
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+        if(cache_key) {
+            fdsc->cache->kern_pairs[cache_id] = cache_key;
+            fdsc->cache->kern_values[cache_id] = value;
+        }
+#endif
     }
     else {
         /*Kern classes*/
@@ -323,272 +432,496 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
-static int32_t kern_pair_8_compare(const void * ref, const void * element)
+/**
+ * Binary search of a relative code point in a sorted `unicode_list`
+ * @param list pointer to the list
+ * @param len number of elements in the list
+ * @param rcp the relative code point to search
+ * @return index of `rcp` or -1 if not found
+ */
+static int32_t unicode_list_search(const uint16_t * list, uint32_t len, uint32_t rcp)
 {
-    const uint8_t * ref8_p = ref;
-    const uint8_t * element8_p = element;
+    uint32_t min = 0;
+    uint32_t max = len;
+    while(min < max) {
+        uint32_t mid = (min + max) >> 1;
+        if(list[mid] < rcp) min = mid + 1;
+        else if(list[mid] > rcp) max = mid;
+        else return mid;
+    }
 
-    /*If the MSB is different it will matter. If not return the diff. of the LSB*/
-    if(ref8_p[0] != element8_p[0]) return (int32_t)ref8_p[0] - element8_p[0];
-    else return (int32_t) ref8_p[1] - element8_p[1];
+    return -1;
+}
 
+/**
+ * Binary search of a glyph ID pair in a kerning table with `uint8_t` IDs.
+ * The pairs are ordered left_id first, then right_id secondly.
+ * @param glyph_ids pointer to the pairs
+ * @param pair_cnt number of pairs
+ * @param left the left glyph ID
+ * @param right the right glyph ID
+ * @return index of the pair or -1 if not found
+ */
+static int32_t kern_pair_8_search(const uint8_t * glyph_ids, uint32_t pair_cnt, uint32_t left, uint32_t right)
+{
+    uint32_t min = 0;
+    uint32_t max = pair_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) >> 1;
+        const uint8_t * p = &glyph_ids[mid * 2];
+        if(p[0] < left || (p[0] == left && p[1] < right)) min = mid + 1;
+        else if(p[0] != left || p[1] != right) max = mid;
+        else return mid;
+    }
+
+    return -1;
 }
 
-static int32_t kern_pair_16_compare(const void * ref, const void * element)
+/**
+ * Binary search of a glyph ID pair in a kerning table with `uint16_t` IDs.
+ * The pairs are ordered left_id first, then right_id secondly.
+ * @param glyph_ids pointer to the pairs
+ * @param pair_cnt number of pairs
+ * @param left the left glyph ID
+ * @param right the right glyph ID
+ * @return index of the pair or -1 if not found
+ */
+static int32_t kern_pair_16_search(const uint16_t * glyph_ids, uint32_t pair_cnt, uint32_t left, uint32_t right)
 {
-    const uint16_t * ref16_p = ref;
-    const uint16_t * element16_p = element;
+    uint32_t min = 0;
+    uint32_t max = pair_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) >> 1;
+        const uint16_t * p = &glyph_ids[mid * 2];
+        if(p[0] < left || (p[0] == left && p[1] < right)) min = mid + 1;
+        else if(p[0] != left || p[1] != right) max = mid;
+        else return mid;
+    }
 
-    /*If the MSB is different it will matter. If not return the diff. of the LSB*/
-    if(ref16_p[0] != element16_p[0]) return (int32_t)ref16_p[0] - element16_p[0];
-    else return (int32_t) ref16_p[1] - element16_p[1];
+    return -1;
 }
 
-#if LV_USE_FONT_COMPRESSED
 /**
- * The compress a glyph's bitmap
- * @param in the compressed bitmap
- * @param out buffer to store the result
- * @param px_num number of pixels in the glyph (width * height)
- * @param bpp bit per pixel (bpp = 3 will be converted to bpp = 4)
- * @param prefilter true: the lines are XORed
+ * Get the descriptor of a glyph from the font's array or from its glyph source
+ * @param fdsc pointer to the font descriptor
+ * @param gid the glyph's ID
+ * @param buf a descriptor to fill if the glyphs are get from a glyph source
+ * @return pointer to the descriptor or NULL on error
  */
-static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord_t h, uint8_t bpp, bool prefilter)
+static const lv_font_fmt_txt_glyph_dsc_t * get_glyph_fmt_dsc(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid,
+                                                              lv_font_fmt_txt_glyph_dsc_t * buf)
 {
-    uint32_t wrp = 0;
-    uint8_t wr_size = bpp;
-    if(bpp == 3) wr_size = 4;
+    if(fdsc->glyph_src == NULL) return &fdsc->glyph_dsc[gid];
 
-    rle_init(in, bpp);
+    return fdsc->glyph_src->get_glyph_dsc(fdsc, gid, buf) ? buf : NULL;
+}
 
-    uint8_t * line_buf1 = lv_mem_buf_get(w);
+/**
+ * Get the bitmap of a glyph. Plain bitmaps are returned with the bpp of the font,
+ * compressed bitmaps are decompressed to 8 bpp opacity values.
+ * @param fdsc pointer to the font descriptor
+ * @param gid the glyph's ID
+ * @param gdsc pointer to the glyph's descriptor
+ * @param out buffer for the decompressed bitmap (`box_w * box_h` bytes) or NULL to use the temporary buffer
+ * @return pointer to the bitmap or NULL on error
+ */
+static const uint8_t * get_glyph_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid,
+                                        const lv_font_fmt_txt_glyph_dsc_t * gdsc, uint8_t * out)
+{
+    const uint8_t * src;
+    if(fdsc->glyph_src) src = fdsc->glyph_src->get_glyph_bitmap(fdsc, gid);
+    else src = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+    if(src == NULL) return NULL;
 
-    uint8_t * line_buf2 = NULL;
+    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
+        return src;
+    }
+    /*Handle compressed bitmap*/
+    else {
+#if LV_USE_FONT_COMPRESSED
+        uint32_t px_cnt = (uint32_t)gdsc->box_w * gdsc->box_h;
+        if(px_cnt == 0) return NULL;
 
-    if(prefilter) {
-        line_buf2 = lv_mem_buf_get(w);
+        if(out == NULL) out = get_tmp_buf(px_cnt);
+        if(out == NULL) return NULL;
+
+        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
+        decompress(src, out, gdsc->box_w, gdsc->box_h, (uint8_t)fdsc->bpp, prefilter);
+        return out;
+#else /*!LV_USE_FONT_COMPRESSED*/
+        LV_UNUSED(out);
+        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
+        return NULL;
+#endif
+    }
+}
+
+#if LV_FONT_GLYPH_CACHE_SIZE > 0 || LV_USE_FONT_COMPRESSED
+
+/**
+ * Get the temporary buffer used to decompress and expand glyphs. It's freed after each refresh.
+ * @param size the required size in bytes
+ * @return pointer to the buffer or NULL if it couldn't be allocated
+ */
+static uint8_t * get_tmp_buf(uint32_t size)
+{
+    static uint32_t last_buf_size = 0;
+    if(LV_GC_ROOT(_lv_font_decompr_buf) == NULL) last_buf_size = 0;
+
+    if(last_buf_size < size) {
+        uint8_t * tmp = lv_mem_realloc(LV_GC_ROOT(_lv_font_decompr_buf), size);
+        LV_ASSERT_MALLOC(tmp);
+        if(tmp == NULL) return NULL;
+        LV_GC_ROOT(_lv_font_decompr_buf) = tmp;
+        last_buf_size = size;
     }
 
-    decompress_line(line_buf1, w);
+    return LV_GC_ROOT(_lv_font_decompr_buf);
+}
+
+#endif /*LV_FONT_GLYPH_CACHE_SIZE > 0 || LV_USE_FONT_COMPRESSED*/
 
-    lv_coord_t y;
-    lv_coord_t x;
+#if LV_FONT_GLYPH_CACHE_SIZE > 0
+
+static inline bool glyph_cache_is_used(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    /*Plain 8 bpp bitmaps are already in the required format*/
+    return fdsc->bpp != 8 || fdsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN;
+}
 
-    for(x = 0; x < w; x++) {
-        bits_write(out, wrp, line_buf1[x], bpp);
-        wrp += wr_size;
+/**
+ * Get the bitmap of a glyph expanded to 8 bpp opacity from the glyph cache.
+ * If it's not cached yet, decode it and drop the least recently used glyphs to make room for it.
+ * @param fdsc pointer to the font descriptor
+ * @param gid the glyph's ID
+ * @return pointer to the 8 bpp bitmap or NULL on error. Valid until the next glyph is get.
+ */
+static const uint8_t * glyph_cache_get(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid)
+{
+    glyph_cache_t * cache = LV_GC_ROOT(_lv_font_glyph_cache);
+    if(cache == NULL) {
+        cache = lv_mem_alloc(sizeof(glyph_cache_t) + GLYPH_CACHE_BUF_SIZE);
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return NULL;
+        lv_memset_00(cache, sizeof(glyph_cache_t));
+        glyph_cache_entry_t * free_block = (glyph_cache_entry_t *)(cache + 1);
+        free_block->fdsc = NULL;
+        free_block->size = GLYPH_CACHE_BUF_SIZE;
+        LV_GC_ROOT(_lv_font_glyph_cache) = cache;
     }
 
-    for(y = 1; y < h; y++) {
-        if(prefilter) {
-            decompress_line(line_buf2, w);
+    uint32_t bucket_id = GLYPH_CACHE_BUCKET_ID(fdsc, gid);
+    glyph_cache_entry_t * entry;
+    for(entry = cache->buckets[bucket_id]; entry; entry = entry->bucket_next) {
+        if(entry->gid == gid && entry->fdsc == fdsc) break;
+    }
 
-            for(x = 0; x < w; x++) {
-                line_buf1[x] = line_buf2[x] ^ line_buf1[x];
-                bits_write(out, wrp, line_buf1[x], bpp);
-                wrp += wr_size;
-            }
+    if(entry) {
+        if(entry != cache->head) {
+            glyph_cache_lru_remove(cache, entry);
+            glyph_cache_lru_add(cache, entry);
         }
-        else {
-            decompress_line(line_buf1, w);
+        return (const uint8_t *)(entry + 1);
+    }
+
+    lv_font_fmt_txt_glyph_dsc_t gdsc_buf;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = get_glyph_fmt_dsc(fdsc, gid, &gdsc_buf);
+    if(gdsc == NULL) return NULL;
+
+    uint32_t px_cnt = (uint32_t)gdsc->box_w * gdsc->box_h;
+    if(px_cnt == 0) return NULL;
+
+    uint32_t entry_size = GLYPH_CACHE_ALIGN(sizeof(glyph_cache_entry_t) + px_cnt);
+    if(entry_size <= GLYPH_CACHE_BUF_SIZE) entry = glyph_cache_alloc(cache, entry_size);
+
+    /*If it can't be cached, expand it to the temporary buffer*/
+    uint8_t * a8 = entry ? (uint8_t *)(entry + 1) : get_tmp_buf(px_cnt);
+    if(a8 == NULL) return NULL;
+
+    /*Compressed glyphs are decompressed straight to 8 bpp*/
+    const uint8_t * bitmap = get_glyph_bitmap(fdsc, gid, gdsc, a8);
+    if(bitmap == NULL) return NULL;     /*The block of the entry remains free*/
+    if(bitmap != a8) expand_to_a8(bitmap, a8, px_cnt, (uint8_t)fdsc->bpp);
+    if(entry == NULL) return a8;
+
+    entry->fdsc = fdsc;
+    entry->gid = gid;
+    entry->bucket_next = cache->buckets[bucket_id];
+    cache->buckets[bucket_id] = entry;
+    glyph_cache_lru_add(cache, entry);
 
-            for(x = 0; x < w; x++) {
-                bits_write(out, wrp, line_buf1[x], bpp);
-                wrp += wr_size;
+    return (const uint8_t *)(entry + 1);
+}
+
+/**
+ * Get a free block for a new entry, dropping the least recently used entries until there is one
+ * @param cache pointer to the glyph cache
+ * @param size size of the entry with the bitmap in bytes (aligned, max. `GLYPH_CACHE_BUF_SIZE`)
+ * @return pointer to the new entry. It's not added to the cache yet so its block is still free.
+ */
+static glyph_cache_entry_t * glyph_cache_alloc(glyph_cache_t * cache, uint32_t size)
+{
+    uint8_t * buf_start = (uint8_t *)(cache + 1);
+    uint8_t * buf_end = buf_start + GLYPH_CACHE_BUF_SIZE;
+
+    while(1) {
+        /*First fit. The free blocks are merged with the free blocks after them meanwhile.*/
+        uint8_t * p;
+        for(p = buf_start; p < buf_end; p += ((glyph_cache_entry_t *)p)->size) {
+            glyph_cache_entry_t * block = (glyph_cache_entry_t *)p;
+            if(block->fdsc) continue;
+
+            while(p + block->size < buf_end && ((glyph_cache_entry_t *)(p + block->size))->fdsc == NULL) {
+                block->size += ((glyph_cache_entry_t *)(p + block->size))->size;
+            }
+            if(block->size < size) continue;
+
+            /*Keep the rest as a free block if an entry fits into it*/
+            if(block->size - size >= sizeof(glyph_cache_entry_t)) {
+                glyph_cache_entry_t * rest = (glyph_cache_entry_t *)(p + size);
+                rest->fdsc = NULL;
+                rest->size = block->size - size;
+                block->size = size;
             }
+            return block;
         }
+
+        /*Everything is free if the cache is empty so `size` fits*/
+        if(cache->tail == NULL) return NULL;
+        glyph_cache_drop(cache, cache->tail);
     }
+}
 
-    lv_mem_buf_release(line_buf1);
-    lv_mem_buf_release(line_buf2);
+/**
+ * Remove an entry from the glyph cache. Its block becomes free.
+ * @param cache pointer to the glyph cache
+ * @param entry pointer to an entry of the cache
+ */
+static void glyph_cache_drop(glyph_cache_t * cache, glyph_cache_entry_t * entry)
+{
+    uint32_t bucket_id = GLYPH_CACHE_BUCKET_ID(entry->fdsc, entry->gid);
+    glyph_cache_entry_t ** link = &cache->buckets[bucket_id];
+    while(*link != entry) link = &(*link)->bucket_next;
+    *link = entry->bucket_next;
+
+    glyph_cache_lru_remove(cache, entry);
+    entry->fdsc = NULL;
 }
 
 /**
- * Decompress one line. Store one pixel per byte
- * @param out output buffer
- * @param w width of the line in pixel count
+ * Add an entry as the most recently used one
+ * @param cache pointer to the glyph cache
+ * @param entry pointer to an entry which is not in the list
  */
-static inline void decompress_line(uint8_t * out, lv_coord_t w)
+static void glyph_cache_lru_add(glyph_cache_t * cache, glyph_cache_entry_t * entry)
 {
-    lv_coord_t i;
-    for(i = 0; i < w; i++) {
-        out[i] = rle_next();
-    }
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if(cache->head) cache->head->prev = entry;
+    else cache->tail = entry;
+    cache->head = entry;
 }
 
 /**
- * Read bits from an input buffer. The read can cross byte boundary.
- * @param in the input buffer to read from.
- * @param bit_pos index of the first bit to read.
- * @param len number of bits to read (must be <= 8).
- * @return the read bits
+ * Remove an entry from the list of the recently used entries
+ * @param cache pointer to the glyph cache
+ * @param entry pointer to an entry in the list
+ */
+static void glyph_cache_lru_remove(glyph_cache_t * cache, glyph_cache_entry_t * entry)
+{
+    if(entry->prev) entry->prev->next = entry->next;
+    else cache->head = entry->next;
+    if(entry->next) entry->next->prev = entry->prev;
+    else cache->tail = entry->prev;
+}
+
+/**
+ * Expand a bitmap to 8 bpp opacity values using the same opacity mapping as the letter drawing.
+ * @param in the bitmap with `bpp` bits per pixel (3 bpp is stored on 4 bits)
+ * @param out store the 8 bpp bitmap here
+ * @param px_cnt number of pixels
+ * @param bpp bit-per-pixel of `in`
  */
-static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len)
+static void expand_to_a8(const uint8_t * in, uint8_t * out, uint32_t px_cnt, uint8_t bpp)
 {
-    uint8_t bit_mask;
-    switch(len) {
+    const uint8_t * opa_table;
+    switch(bpp) {
         case 1:
-            bit_mask = 0x1;
+            opa_table = _lv_bpp1_opa_table;
             break;
         case 2:
-            bit_mask = 0x3;
+            opa_table = _lv_bpp2_opa_table;
             break;
         case 3:
-            bit_mask = 0x7;
-            break;
         case 4:
-            bit_mask = 0xF;
-            break;
-        case 8:
-            bit_mask = 0xFF;
+            bpp = 4;
+            opa_table = _lv_bpp4_opa_table;
             break;
         default:
-            bit_mask = (uint16_t)((uint16_t) 1 << len) - 1;
+            lv_memcpy(out, in, px_cnt);
+            return;
     }
 
-    uint32_t byte_pos = bit_pos >> 3;
-    bit_pos = bit_pos & 0x7;
-
-    if(bit_pos + len >= 8) {
-        uint16_t in16 = (in[byte_pos] << 8) + in[byte_pos + 1];
-        return (in16 >> (16 - bit_pos - len)) & bit_mask;
-    }
-    else {
-        return (in[byte_pos] >> (8 - bit_pos - len)) & bit_mask;
+    uint8_t px_mask = (1 << bpp) - 1;
+    uint8_t shift = 8;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        if(shift == 0) {
+            in++;
+            shift = 8;
+        }
+        shift -= bpp;
+        out[i] = opa_table[(*in >> shift) & px_mask];
     }
 }
 
+#endif /*LV_FONT_GLYPH_CACHE_SIZE > 0*/
+
+#if LV_USE_FONT_COMPRESSED
 /**
- * Write `val` data to `bit_pos` position of `out`. The write can NOT cross byte boundary.
- * @param out buffer where to write
- * @param bit_pos bit index to write
- * @param val value to write
- * @param len length of bits to write from `val`. (Counted from the LSB).
- * @note `len == 3` will be converted to `len = 4` and `val` will be upscaled too
+ * Decompress a glyph's bitmap to 8 bpp opacity values.
+ * The RLE stream is decoded to one value per byte, runs are written at once,
+ * then the prefilter is undone and the values are mapped to opacity.
+ * @param in the compressed bitmap
+ * @param out buffer to store the result (`w * h` bytes)
+ * @param w width of the glyph
+ * @param h height of the glyph
+ * @param bpp bit per pixel of the compressed values
+ * @param prefilter true: the lines are XORed
  */
-static inline void bits_write(uint8_t * out, uint32_t bit_pos, uint8_t val, uint8_t len)
+static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord_t h, uint8_t bpp, bool prefilter)
 {
-    if(len == 3) {
-        len = 4;
-        switch(val) {
-            case 0:
-                val = 0;
-                break;
-            case 1:
-                val = 2;
-                break;
-            case 2:
-                val = 4;
-                break;
-            case 3:
-                val = 6;
-                break;
-            case 4:
-                val = 9;
-                break;
-            case 5:
-                val = 11;
-                break;
-            case 6:
-                val = 13;
-                break;
-            case 7:
-                val = 15;
-                break;
+    uint32_t px_cnt = (uint32_t)w * h;
+    if(px_cnt == 0) return;
+
+    rle_reader_t rd;
+    rd.in = in;
+    rd.buf = 0;
+    rd.bit_cnt = 0;
+
+    /*The first value can't be a repetition*/
+    uint32_t prev = rle_read(&rd, bpp);
+    out[0] = (uint8_t)prev;
+    uint32_t i = 1;
+    while(i < px_cnt) {
+        uint32_t v = rle_read(&rd, bpp);
+        out[i++] = (uint8_t)v;
+        if(v != prev) {
+            prev = v;
+            continue;
+        }
+
+        /*Two same values: a 1 bit for each repetition, at most 10 of them*/
+        uint32_t ones = rle_read_ones(&rd, LV_MIN(10, px_cnt - i));
+        lv_memset(&out[i], (uint8_t)prev, ones);
+        i += ones;
+        if(i == px_cnt) break;
+
+        /*The 11th 1 bit is followed by the number of further repetitions on 6 bits*/
+        if(rle_read(&rd, 1)) {
+            uint32_t cnt = rle_read(&rd, 6);
+            cnt = LV_MIN(cnt, px_cnt - i);
+            lv_memset(&out[i], (uint8_t)prev, cnt);
+            i += cnt;
+            if(i == px_cnt) break;
+        }
+
+        /*The repetition ends with a new value*/
+        prev = rle_read(&rd, bpp);
+        out[i++] = (uint8_t)prev;
+    }
+
+    /*Undo the prefilter: each line was XORed with the previous one*/
+    if(prefilter) {
+        lv_coord_t y;
+        for(y = 1; y < h; y++) {
+            uint8_t * line = &out[(uint32_t)y * w];
+            const uint8_t * line_prev = line - w;
+            lv_coord_t x = 0;
+            for(; x + 4 <= w; x += 4) {
+                uint32_t v32;
+                uint32_t prev32;
+                memcpy(&v32, &line[x], 4);
+                memcpy(&prev32, &line_prev[x], 4);
+                v32 ^= prev32;
+                memcpy(&line[x], &v32, 4);
+            }
+            for(; x < w; x++) {
+                line[x] ^= line_prev[x];
+            }
         }
     }
 
-    uint16_t byte_pos = bit_pos >> 3;
-    bit_pos = bit_pos & 0x7;
-    bit_pos = 8 - bit_pos - len;
+    const uint8_t * opa_table;
+    switch(bpp) {
+        case 1:
+            opa_table = _lv_bpp1_opa_table;
+            break;
+        case 2:
+            opa_table = _lv_bpp2_opa_table;
+            break;
+        case 3:
+            opa_table = rle_bpp3_opa_table;
+            break;
+        case 4:
+            opa_table = _lv_bpp4_opa_table;
+            break;
+        default:
+            return;
+    }
 
-    uint8_t bit_mask = (uint16_t)((uint16_t) 1 << len) - 1;
-    out[byte_pos] &= ((~bit_mask) << bit_pos);
-    out[byte_pos] |= (val << bit_pos);
+    for(i = 0; i < px_cnt; i++) {
+        out[i] = opa_table[out[i]];
+    }
 }
 
-static inline void rle_init(const uint8_t * in,  uint8_t bpp)
+/**
+ * Read bits from the RLE stream. Only the bytes having the required bits are loaded.
+ * @param rd pointer to a reader
+ * @param len number of bits to read (1..8)
+ * @return the read bits
+ */
+static inline uint32_t rle_read(rle_reader_t * rd, uint32_t len)
 {
-    rle_in = in;
-    rle_bpp = bpp;
-    rle_state = RLE_STATE_SINGLE;
-    rle_rdp = 0;
-    rle_prev_v = 0;
-    rle_cnt = 0;
+    if(rd->bit_cnt < len) {
+        rd->buf |= (uint32_t)(*rd->in) << (24 - rd->bit_cnt);
+        rd->in++;
+        rd->bit_cnt += 8;
+    }
+
+    uint32_t v = rd->buf >> (32 - len);
+    rd->buf <<= len;
+    rd->bit_cnt -= len;
+    return v;
 }
 
-static inline uint8_t rle_next(void)
+/**
+ * Read the 1 bits from the RLE stream until a 0 bit but at most `max`. The 0 bit is not read.
+ * @param rd pointer to a reader
+ * @param max the maximal number of 1 bits to read
+ * @return the number of read 1 bits
+ */
+static inline uint32_t rle_read_ones(rle_reader_t * rd, uint32_t max)
 {
-    uint8_t v = 0;
-    uint8_t ret = 0;
-
-    if(rle_state == RLE_STATE_SINGLE) {
-        ret = get_bits(rle_in, rle_rdp, rle_bpp);
-        if(rle_rdp != 0 && rle_prev_v == ret) {
-            rle_cnt = 0;
-            rle_state = RLE_STATE_REPEATE;
+    uint32_t n = 0;
+    while(n < max) {
+        /*There are more pixels so the next bit is surely needed*/
+        if(rd->bit_cnt == 0) {
+            rd->buf = (uint32_t)(*rd->in) << 24;
+            rd->in++;
+            rd->bit_cnt = 8;
         }
 
-        rle_prev_v = ret;
-        rle_rdp += rle_bpp;
-    }
-    else if(rle_state == RLE_STATE_REPEATE) {
-        v = get_bits(rle_in, rle_rdp, 1);
-        rle_cnt++;
-        rle_rdp += 1;
-        if(v == 1) {
-            ret = rle_prev_v;
-            if(rle_cnt == 11) {
-                rle_cnt = get_bits(rle_in, rle_rdp, 6);
-                rle_rdp += 6;
-                if(rle_cnt != 0) {
-                    rle_state = RLE_STATE_COUNTER;
-                }
-                else {
-                    ret = get_bits(rle_in, rle_rdp, rle_bpp);
-                    rle_prev_v = ret;
-                    rle_rdp += rle_bpp;
-                    rle_state = RLE_STATE_SINGLE;
-                }
-            }
-        }
-        else {
-            ret = get_bits(rle_in, rle_rdp, rle_bpp);
-            rle_prev_v = ret;
-            rle_rdp += rle_bpp;
-            rle_state = RLE_STATE_SINGLE;
-        }
+        /*The not loaded bits are 0, so only the loaded 1 bits are counted*/
+        uint32_t k = rle_ones_table[rd->buf >> 24];
+        if(k > max - n) k = max - n;
+        rd->buf <<= k;
+        rd->bit_cnt -= k;
+        n += k;
 
-    }
-    else if(rle_state == RLE_STATE_COUNTER) {
-        ret = rle_prev_v;
-        rle_cnt--;
-        if(rle_cnt == 0) {
-            ret = get_bits(rle_in, rle_rdp, rle_bpp);
-            rle_prev_v = ret;
-            rle_rdp += rle_bpp;
-            rle_state = RLE_STATE_SINGLE;
-        }
+        if(rd->bit_cnt && (rd->buf & 0x80000000U) == 0) break;
     }
 
-    return ret;
+    return n;
 }
 #endif /*LV_USE_FONT_COMPRESSED*/
-
-/** Code Comparator.
- *
- *  Compares the value of both input arguments.
- *
- *  @param[in]  pRef        Pointer to the reference.
- *  @param[in]  pElement    Pointer to the element to compare.
- *
- *  @return Result of comparison.
- *  @retval < 0   Reference is less than element.
- *  @retval = 0   Reference is equal to element.
- *  @retval > 0   Reference is greater than element.
- *
- */
-static int32_t unicode_list_compare(const void * ref, const void * element)
-{
-    return ((int32_t)(*(uint16_t *)ref)) - ((int32_t)(*(uint16_t *)element));
-}
@@ -151,13 +151,53 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
 } lv_font_fmt_txt_bitmap_format_t;
 
+/** Cache the glyph IDs and kerning values of the recently used letters*/
 typedef struct {
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    uint32_t letters[LV_FONT_FMT_TXT_CACHE_SIZE];       /**< Letters, indexed by their lower bits. 0: unused*/
+    uint32_t glyph_ids[LV_FONT_FMT_TXT_CACHE_SIZE];     /**< Glyph ID of the letters*/
+    uint32_t kern_pairs[LV_FONT_FMT_TXT_CACHE_SIZE];    /**< Glyph ID pairs as `left << 16 | right`. 0: unused*/
+    int8_t kern_values[LV_FONT_FMT_TXT_CACHE_SIZE];     /**< Kerning value of the pairs*/
+#else
     uint32_t last_letter;
     uint32_t last_glyph_id;
+#endif
 } lv_font_fmt_txt_glyph_cache_t;
 
-/*Describe store additional data for fonts*/
+/**
+ * Perfect hash table to map the code points to glyph IDs without searching the cmaps.
+ * Can be added to a converted font with `scripts/font_cmap_hash.py`.
+ */
 typedef struct {
+    const uint16_t * seeds;         /**< Seed of each bucket to get a collision free slot*/
+    const uint32_t * letters;       /**< The code point in each slot. 0: empty slot*/
+    const uint16_t * glyph_ids;     /**< The glyph ID of the code point in each slot*/
+    uint16_t bucket_cnt;            /**< Number of `seeds`*/
+    uint16_t slot_cnt;              /**< Number of `letters` and `glyph_ids`*/
+} lv_font_fmt_txt_cmap_hash_t;
+
+struct _lv_font_fmt_txt_dsc_t;
+
+/**
+ * Get the glyphs on demand instead of from `glyph_dsc` and `glyph_bitmap`, e.g. to read them from a file.
+ * The cmaps and the kerning data are still used from the font descriptor.
+ */
+typedef struct {
+    /**
+     * Get the descriptor of a glyph. `bitmap_index` is not used.
+     * @return true: `dsc_out` is filled; false: error
+     */
+    bool (*get_glyph_dsc)(const struct _lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid, lv_font_fmt_txt_glyph_dsc_t * dsc_out);
+
+    /**
+     * Get the bitmap of a glyph in the format of the font (maybe compressed).
+     * @return pointer to the bitmap or NULL on error. Valid until the next call.
+     */
+    const uint8_t * (*get_glyph_bitmap)(const struct _lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid);
+} lv_font_fmt_txt_glyph_src_t;
+
+/*Describe store additional data for fonts*/
+typedef struct _lv_font_fmt_txt_dsc_t {
     /*The bitmaps of all glyphs*/
     const uint8_t * glyph_bitmap;
 
@@ -193,8 +233,14 @@ typedef struct {
      */
     uint16_t bitmap_format  : 2;
 
-    /*Cache the last letter and is glyph id*/
+    /*Cache the recently used letters and their glyph id*/
     lv_font_fmt_txt_glyph_cache_t * cache;
+
+    /*Optional perfect hash of the code points. If set it's used instead of the `cmaps`*/
+    const lv_font_fmt_txt_cmap_hash_t * cmap_hash;
+
+    /*Optional callbacks to get the glyphs. If set they are used instead of `glyph_dsc` and `glyph_bitmap`*/
+    const lv_font_fmt_txt_glyph_src_t * glyph_src;
 } lv_font_fmt_txt_dsc_t;
 
 /**********************
@@ -225,6 +271,13 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
  */
 void _lv_font_clean_up_fmt_txt(void);
 
+/**
+ * Remove the glyphs of a font from the glyph cache.
+ * Needs to be called before freeing a font which was created at run time (e.g. loaded from a file).
+ * @param font pointer to a font or NULL to remove all glyphs
+ */
+void lv_font_fmt_txt_glyph_cache_invalidate(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
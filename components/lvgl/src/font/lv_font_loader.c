@@ -14,6 +14,12 @@
 #include "../misc/lv_fs.h"
 #include "lv_font_loader.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+#define LAZY_PAGE_SIZE          256 /*Size of the pages read from the file by lazy fonts*/
+#define LAZY_DSC_CACHE_SIZE     32  /*Number of cached glyph descriptors of lazy fonts. Must be a power of 2.*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -60,16 +66,77 @@ typedef struct cmap_table_bin {
     uint8_t padding;
 } cmap_table_bin_t;
 
+typedef struct {
+    uint32_t start;         /*File offset of the page. UINT32_MAX: unused*/
+    uint32_t size;          /*Number of valid bytes, less than `LAZY_PAGE_SIZE` at the end of the file*/
+    uint32_t last_use;      /*Value of `use_cnt` at the last access*/
+} lazy_page_t;
+
+/*A font descriptor which reads the glyphs from the file on demand*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t fdsc;     /*Must be the first to free it as a normal font descriptor*/
+    lv_fs_file_t file;
+    bool file_opened;
+
+    /*Page cache*/
+    lazy_page_t * pages;
+    uint8_t * page_data;            /*`page_cnt * LAZY_PAGE_SIZE` bytes*/
+    uint32_t page_cnt;
+    uint32_t use_cnt;
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+
+    /*The last read bitmap*/
+    uint8_t * bitmap;
+    uint32_t bitmap_size;
+
+    /*Recently used glyph descriptors, indexed by the lower bits of the glyph ID*/
+    uint32_t dsc_cache_gids[LAZY_DSC_CACHE_SIZE];
+    lv_font_fmt_txt_glyph_dsc_t dsc_cache[LAZY_DSC_CACHE_SIZE];
+
+    /*Where to find the glyphs in the file*/
+    uint32_t loca_start;            /*File offset of the first glyph offset*/
+    uint32_t loca_count;
+    uint32_t glyf_start;            /*File offset of the glyph table's label. The glyph offsets are relative to it.*/
+    uint32_t glyf_length;
+    uint16_t default_advance_width;
+    uint8_t index_to_loc_format;
+    uint8_t advance_width_format;
+    uint8_t advance_width_bits;
+    uint8_t xy_bits;
+    uint8_t wh_bits;
+
+    uint32_t resident_size;         /*Allocated bytes except `bitmap`*/
+} lazy_font_dsc_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, lazy_font_dsc_t * lazy);
+static int32_t load_glyph_table(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, font_header_bin_t * font_header,
+                                uint32_t loca_count, uint32_t glyph_start);
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 
+static bool lazy_get_glyph_dsc(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid, lv_font_fmt_txt_glyph_dsc_t * dsc_out);
+static const uint8_t * lazy_get_glyph_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid);
+static bool lazy_get_glyph_ofs(lazy_font_dsc_t * lazy, uint32_t gid, uint32_t * ofs, uint32_t * next_ofs);
+static bool lazy_read(lazy_font_dsc_t * lazy, uint32_t ofs, uint8_t * buf, uint32_t len);
+static const uint8_t * lazy_get_page(lazy_font_dsc_t * lazy, uint32_t start, uint32_t * size);
+static uint32_t lazy_get_data_size(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t glyph_cnt);
+static uint32_t get_bits(const uint8_t * buf, uint32_t * bit_pos, uint32_t n_bits);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const lv_font_fmt_txt_glyph_src_t lazy_glyph_src = {
+    .get_glyph_dsc = lazy_get_glyph_dsc,
+    .get_glyph_bitmap = lazy_get_glyph_bitmap,
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -93,7 +160,7 @@ lv_font_t * lv_font_load(const char * font_name)
     lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
     if(font) {
         memset(font, 0, sizeof(lv_font_t));
-        if(!lvgl_load_font(&file, font)) {
+        if(!lvgl_load_font(&file, font, NULL)) {
             LV_LOG_WARN("Error loading font file: %s\n", font_name);
             /*
             * When `lvgl_load_font` fails it can leak some pointers.
@@ -111,14 +178,105 @@ lv_font_t * lv_font_load(const char * font_name)
 }
 
 /**
- * Frees the memory allocated by the `lv_font_load()` function
+ * Loads a `lv_font_t` object from a binary font file but keeps only the header, the cmaps and the kerning data in RAM.
+ * The glyph descriptors and bitmaps are read from the file when they are needed through a small page cache.
+ * The file is kept open until the font is freed with `lv_font_free()`.
+ * @param font_name filename where the font file is located
+ * @param cache_size size of the page cache in bytes. Rounded up to whole pages, at least 2 pages are used.
+ * @return a pointer to the font or NULL in case of error
+ */
+lv_font_t * lv_font_load_lazy(const char * font_name, uint32_t cache_size)
+{
+    lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
+    if(font == NULL) return NULL;
+    memset(font, 0, sizeof(lv_font_t));
+
+    lazy_font_dsc_t * lazy = lv_mem_alloc(sizeof(lazy_font_dsc_t));
+    if(lazy == NULL) {
+        lv_mem_free(font);
+        return NULL;
+    }
+    memset(lazy, 0, sizeof(lazy_font_dsc_t));
+    lazy->fdsc.glyph_src = &lazy_glyph_src;
+    font->dsc = &lazy->fdsc;
+
+    if(lv_fs_open(&lazy->file, font_name, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        lv_font_free(font);
+        return NULL;
+    }
+    lazy->file_opened = true;
+
+    lazy->page_cnt = LV_MAX((cache_size + LAZY_PAGE_SIZE - 1) / LAZY_PAGE_SIZE, 2);
+    lazy->pages = lv_mem_alloc(lazy->page_cnt * sizeof(lazy_page_t));
+    lazy->page_data = lv_mem_alloc(lazy->page_cnt * LAZY_PAGE_SIZE);
+    if(lazy->pages == NULL || lazy->page_data == NULL) {
+        lv_font_free(font);
+        return NULL;
+    }
+
+    uint32_t i;
+    for(i = 0; i < lazy->page_cnt; i++) {
+        lazy->pages[i].start = UINT32_MAX;
+        lazy->pages[i].size = 0;
+        lazy->pages[i].last_use = 0;
+    }
+
+    if(!lvgl_load_font(&lazy->file, font, lazy)) {
+        LV_LOG_WARN("Error loading font file: %s\n", font_name);
+        lv_font_free(font);
+        return NULL;
+    }
+
+    lazy->resident_size = sizeof(lv_font_t) + sizeof(lazy_font_dsc_t) +
+                          lazy->page_cnt * (sizeof(lazy_page_t) + LAZY_PAGE_SIZE) +
+                          lazy_get_data_size(&lazy->fdsc, lazy->loca_count);
+    if(lazy->fdsc.cache) lazy->resident_size += sizeof(lv_font_fmt_txt_glyph_cache_t);
+
+    return font;
+}
+
+/**
+ * Get the memory usage and the page cache statistics of a font loaded by `lv_font_load_lazy()`
+ * @param font pointer to a font
+ * @param stats store the result here
+ * @return true: `stats` is filled; false: not a lazy loaded font
+ */
+bool lv_font_lazy_get_stats(const lv_font_t * font, lv_font_lazy_stats_t * stats)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    if(fdsc == NULL || fdsc->glyph_src != &lazy_glyph_src) return false;
+
+    const lazy_font_dsc_t * lazy = (const lazy_font_dsc_t *)fdsc;
+    stats->resident_size = lazy->resident_size + lazy->bitmap_size;
+    stats->cache_size = lazy->page_cnt * LAZY_PAGE_SIZE;
+    stats->hit_cnt = lazy->hit_cnt;
+    stats->miss_cnt = lazy->miss_cnt;
+
+    uint32_t total = lazy->hit_cnt + lazy->miss_cnt;
+    stats->hit_pct = total ? (uint8_t)(((uint64_t)lazy->hit_cnt * 100) / total) : 0;
+
+    return true;
+}
+
+/**
+ * Frees the memory allocated by the `lv_font_load()` or `lv_font_load_lazy()` function
  * @param font lv_font_t object created by the lv_font_load function
  */
 void lv_font_free(lv_font_t * font)
 {
     if(NULL != font) {
+        lv_font_fmt_txt_glyph_cache_invalidate(font);
+
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
+        if(NULL != dsc && dsc->glyph_src == &lazy_glyph_src) {
+            lazy_font_dsc_t * lazy = (lazy_font_dsc_t *)dsc;
+            if(lazy->file_opened) lv_fs_close(&lazy->file);
+            if(lazy->pages) lv_mem_free(lazy->pages);
+            if(lazy->page_data) lv_mem_free(lazy->page_data);
+            if(lazy->bitmap) lv_mem_free(lazy->bitmap);
+        }
+
         if(NULL != dsc) {
 
             if(dsc->kern_classes == 0) {
@@ -172,6 +330,9 @@ void lv_font_free(lv_font_t * font)
             if(NULL != dsc->glyph_dsc) {
                 lv_mem_free((void *)dsc->glyph_dsc);
             }
+            if(NULL != dsc->cache) {
+                lv_mem_free(dsc->cache);
+            }
             lv_mem_free(dsc);
         }
         lv_mem_free(font);
@@ -480,14 +641,21 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  * `lv_font_free` will assume that all non-null pointers are allocated and
  * should be freed.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, lazy_font_dsc_t * lazy)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_mem_alloc(sizeof(lv_font_fmt_txt_dsc_t));
-
-    memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    lv_font_fmt_txt_dsc_t * font_dsc;
+    if(lazy) {
+        font_dsc = &lazy->fdsc;
+    }
+    else {
+        font_dsc = (lv_font_fmt_txt_dsc_t *)lv_mem_alloc(sizeof(lv_font_fmt_txt_dsc_t));
+        memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+        font->dsc = font_dsc;
+    }
 
-    font->dsc = font_dsc;
+    /*The font works without the cache too, so don't fail if it can't be allocated*/
+    font_dsc->cache = lv_mem_alloc(sizeof(lv_font_fmt_txt_glyph_cache_t));
+    if(font_dsc->cache) memset(font_dsc->cache, 0, sizeof(lv_font_fmt_txt_glyph_cache_t));
 
     /*header*/
     int32_t header_length = read_label(fp, 0, "head");
@@ -531,10 +699,65 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
         return false;
     }
 
+    uint32_t glyph_start = loca_start + loca_length;
+    int32_t glyph_length;
+
+    if(lazy) {
+        /*Only remember where the glyphs are, they are read when used*/
+        if(font_header.index_to_loc_format > 1) {
+            LV_LOG_WARN("Unknown index_to_loc_format: %d.", font_header.index_to_loc_format);
+            return false;
+        }
+
+        glyph_length = read_label(fp, glyph_start, "glyf");
+        if(glyph_length < 0) {
+            return false;
+        }
+
+        lazy->loca_start = loca_start + 12;
+        lazy->loca_count = loca_count;
+        lazy->glyf_start = glyph_start;
+        lazy->glyf_length = glyph_length;
+        lazy->default_advance_width = font_header.default_advance_width;
+        lazy->index_to_loc_format = font_header.index_to_loc_format;
+        lazy->advance_width_format = font_header.advance_width_format;
+        lazy->advance_width_bits = font_header.advance_width_bits;
+        lazy->xy_bits = font_header.xy_bits;
+        lazy->wh_bits = font_header.wh_bits;
+    }
+    else {
+        glyph_length = load_glyph_table(fp, font_dsc, &font_header, loca_count, glyph_start);
+    }
+
+    if(glyph_length < 0) {
+        return false;
+    }
+
+    if(font_header.tables_count < 4) {
+        font_dsc->kern_dsc = NULL;
+        font_dsc->kern_classes = 0;
+        font_dsc->kern_scale = 0;
+        return true;
+    }
+
+    uint32_t kern_start = glyph_start + glyph_length;
+
+    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start);
+
+    return kern_length >= 0;
+}
+
+/**
+ * Read the glyph offsets and load all glyphs. The file position should be at the first glyph offset.
+ * @return length of the glyph table or -1 on error
+ */
+static int32_t load_glyph_table(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, font_header_bin_t * font_header,
+                                uint32_t loca_count, uint32_t glyph_start)
+{
     bool failed = false;
     uint32_t * glyph_offset = lv_mem_alloc(sizeof(uint32_t) * (loca_count + 1));
 
-    if(font_header.index_to_loc_format == 0) {
+    if(font_header->index_to_loc_format == 0) {
         for(unsigned int i = 0; i < loca_count; ++i) {
             uint16_t offset;
             if(lv_fs_read(fp, &offset, sizeof(uint16_t), NULL) != LV_FS_RES_OK) {
@@ -544,44 +767,28 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
             glyph_offset[i] = offset;
         }
     }
-    else if(font_header.index_to_loc_format == 1) {
+    else if(font_header->index_to_loc_format == 1) {
         if(lv_fs_read(fp, glyph_offset, loca_count * sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
             failed = true;
         }
     }
     else {
-        LV_LOG_WARN("Unknown index_to_loc_format: %d.", font_header.index_to_loc_format);
+        LV_LOG_WARN("Unknown index_to_loc_format: %d.", font_header->index_to_loc_format);
         failed = true;
     }
 
     if(failed) {
         lv_mem_free(glyph_offset);
-        return false;
+        return -1;
     }
 
     /*glyph*/
-    uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+                               fp, font_dsc, glyph_start, glyph_offset, loca_count, font_header);
 
     lv_mem_free(glyph_offset);
 
-    if(glyph_length < 0) {
-        return false;
-    }
-
-    if(font_header.tables_count < 4) {
-        font_dsc->kern_dsc = NULL;
-        font_dsc->kern_classes = 0;
-        font_dsc->kern_scale = 0;
-        return true;
-    }
-
-    uint32_t kern_start = glyph_start + glyph_length;
-
-    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start);
-
-    return kern_length >= 0;
+    return glyph_length;
 }
 
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
@@ -679,3 +886,264 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
 
     return kern_length;
 }
+
+/**
+ * Read the descriptor of a glyph from the file. Used as `get_glyph_dsc` of the glyph source of lazy fonts.
+ * @param fdsc pointer to the font descriptor of a lazy font
+ * @param gid the glyph's ID
+ * @param dsc_out store the descriptor here
+ * @return true: `dsc_out` is filled; false: error
+ */
+static bool lazy_get_glyph_dsc(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid, lv_font_fmt_txt_glyph_dsc_t * dsc_out)
+{
+    lazy_font_dsc_t * lazy = (lazy_font_dsc_t *)fdsc;
+
+    /*The ID 0 is not used (all zero) so it can mark the empty entries too*/
+    uint32_t cache_id = gid & (LAZY_DSC_CACHE_SIZE - 1);
+    if(lazy->dsc_cache_gids[cache_id] == gid) {
+        *dsc_out = lazy->dsc_cache[cache_id];
+        return true;
+    }
+
+    if(gid >= lazy->loca_count) return false;
+
+    uint32_t ofs;
+    uint32_t next_ofs;
+    if(!lazy_get_glyph_ofs(lazy, gid, &ofs, &next_ofs)) return false;
+
+    /*The descriptor is stored on `nbits` bits at the beginning of the glyph*/
+    uint8_t buf[16];
+    uint32_t nbits = lazy->advance_width_bits + 2 * lazy->xy_bits + 2 * lazy->wh_bits;
+    uint32_t nbytes = (nbits + 7) / 8;
+    if(nbytes > sizeof(buf) || !lazy_read(lazy, lazy->glyf_start + ofs, buf, nbytes)) return false;
+
+    uint32_t bit_pos = 0;
+    uint32_t adv_w = lazy->default_advance_width;
+    if(lazy->advance_width_bits) adv_w = get_bits(buf, &bit_pos, lazy->advance_width_bits);
+    if(lazy->advance_width_format == 0) adv_w *= 16;
+
+    int32_t ofs_x = get_bits(buf, &bit_pos, lazy->xy_bits);
+    int32_t ofs_y = get_bits(buf, &bit_pos, lazy->xy_bits);
+    if(lazy->xy_bits && (ofs_x & (1 << (lazy->xy_bits - 1)))) ofs_x |= ~0u << lazy->xy_bits;
+    if(lazy->xy_bits && (ofs_y & (1 << (lazy->xy_bits - 1)))) ofs_y |= ~0u << lazy->xy_bits;
+
+    lv_memset_00(dsc_out, sizeof(lv_font_fmt_txt_glyph_dsc_t));
+    dsc_out->adv_w = adv_w;
+    dsc_out->ofs_x = ofs_x;
+    dsc_out->ofs_y = ofs_y;
+    dsc_out->box_w = get_bits(buf, &bit_pos, lazy->wh_bits);
+    dsc_out->box_h = get_bits(buf, &bit_pos, lazy->wh_bits);
+
+    lazy->dsc_cache_gids[cache_id] = gid;
+    lazy->dsc_cache[cache_id] = *dsc_out;
+
+    return true;
+}
+
+/**
+ * Read the bitmap of a glyph from the file. Used as `get_glyph_bitmap` of the glyph source of lazy fonts.
+ * @param fdsc pointer to the font descriptor of a lazy font
+ * @param gid the glyph's ID
+ * @return pointer to the bitmap or NULL on error. Valid until the next call.
+ */
+static const uint8_t * lazy_get_glyph_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid)
+{
+    lazy_font_dsc_t * lazy = (lazy_font_dsc_t *)fdsc;
+    if(gid == 0 || gid >= lazy->loca_count) return NULL;
+
+    uint32_t ofs;
+    uint32_t next_ofs;
+    if(!lazy_get_glyph_ofs(lazy, gid, &ofs, &next_ofs)) return NULL;
+
+    /*The bitmap follows the descriptor without padding*/
+    uint32_t nbits = lazy->advance_width_bits + 2 * lazy->xy_bits + 2 * lazy->wh_bits;
+    if(next_ofs <= ofs + nbits / 8) return NULL;
+    uint32_t bmp_size = next_ofs - ofs - nbits / 8;
+
+    if(lazy->bitmap_size < bmp_size) {
+        uint8_t * tmp = lv_mem_realloc(lazy->bitmap, bmp_size);
+        LV_ASSERT_MALLOC(tmp);
+        if(tmp == NULL) return NULL;
+        lazy->bitmap = tmp;
+        lazy->bitmap_size = bmp_size;
+    }
+
+    uint32_t bmp_start = lazy->glyf_start + ofs + nbits / 8;
+    if(bmp_size > LAZY_PAGE_SIZE) {
+        /*Large bitmaps would just push out everything from the page cache*/
+        uint32_t br;
+        lazy->miss_cnt++;
+        if(lv_fs_seek(&lazy->file, bmp_start, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+           lv_fs_read(&lazy->file, lazy->bitmap, bmp_size, &br) != LV_FS_RES_OK || br != bmp_size) {
+            return NULL;
+        }
+    }
+    else if(!lazy_read(lazy, bmp_start, lazy->bitmap, bmp_size)) {
+        return NULL;
+    }
+
+    /*Shift the bits to start the bitmap on a byte boundary*/
+    uint32_t shift = nbits % 8;
+    if(shift) {
+        uint8_t * bmp = lazy->bitmap;
+        uint32_t i;
+        for(i = 0; i < bmp_size - 1; i++) {
+            bmp[i] = (uint8_t)((bmp[i] << shift) | (bmp[i + 1] >> (8 - shift)));
+        }
+        bmp[bmp_size - 1] = (uint8_t)(bmp[bmp_size - 1] << shift);
+    }
+
+    return lazy->bitmap;
+}
+
+/**
+ * Get where a glyph starts and ends in the glyph table
+ * @param lazy pointer to a lazy font descriptor
+ * @param gid the glyph's ID, smaller than `loca_count`
+ * @param ofs store the glyph's offset here
+ * @param next_ofs store the next glyph's offset or the end of the table here
+ * @return true: success; false: read error
+ */
+static bool lazy_get_glyph_ofs(lazy_font_dsc_t * lazy, uint32_t gid, uint32_t * ofs, uint32_t * next_ofs)
+{
+    uint32_t cnt = gid + 1 < lazy->loca_count ? 2 : 1;
+    if(lazy->index_to_loc_format == 0) {
+        uint16_t buf[2];
+        if(!lazy_read(lazy, lazy->loca_start + gid * sizeof(uint16_t), (uint8_t *)buf, cnt * sizeof(uint16_t))) return false;
+        *ofs = buf[0];
+        *next_ofs = cnt == 2 ? buf[1] : lazy->glyf_length;
+    }
+    else {
+        uint32_t buf[2];
+        if(!lazy_read(lazy, lazy->loca_start + gid * sizeof(uint32_t), (uint8_t *)buf, cnt * sizeof(uint32_t))) return false;
+        *ofs = buf[0];
+        *next_ofs = cnt == 2 ? buf[1] : lazy->glyf_length;
+    }
+
+    return *ofs <= *next_ofs;
+}
+
+/**
+ * Read bytes from the font file through the page cache
+ * @param lazy pointer to a lazy font descriptor
+ * @param ofs file offset to read from
+ * @param buf store the data here
+ * @param len number of bytes to read
+ * @return true: success; false: read error or end of the file
+ */
+static bool lazy_read(lazy_font_dsc_t * lazy, uint32_t ofs, uint8_t * buf, uint32_t len)
+{
+    while(len) {
+        uint32_t page_ofs = ofs % LAZY_PAGE_SIZE;
+        uint32_t page_size;
+        const uint8_t * page = lazy_get_page(lazy, ofs - page_ofs, &page_size);
+        if(page == NULL || page_ofs >= page_size) return false;
+
+        uint32_t n = LV_MIN(len, page_size - page_ofs);
+        lv_memcpy(buf, page + page_ofs, n);
+        buf += n;
+        ofs += n;
+        len -= n;
+    }
+
+    return true;
+}
+
+/**
+ * Get a page of the font file from the cache or read it replacing the least recently used page
+ * @param lazy pointer to a lazy font descriptor
+ * @param start file offset of the page, multiple of `LAZY_PAGE_SIZE`
+ * @param size store the number of valid bytes of the page here
+ * @return pointer to the page's data or NULL on read error
+ */
+static const uint8_t * lazy_get_page(lazy_font_dsc_t * lazy, uint32_t start, uint32_t * size)
+{
+    lazy->use_cnt++;
+
+    uint32_t i;
+    uint32_t lru_id = 0;
+    for(i = 0; i < lazy->page_cnt; i++) {
+        lazy_page_t * page = &lazy->pages[i];
+        if(page->start == start) {
+            page->last_use = lazy->use_cnt;
+            lazy->hit_cnt++;
+            *size = page->size;
+            return &lazy->page_data[i * LAZY_PAGE_SIZE];
+        }
+        if(page->last_use < lazy->pages[lru_id].last_use) lru_id = i;
+    }
+
+    lazy->miss_cnt++;
+
+    lazy_page_t * page = &lazy->pages[lru_id];
+    uint8_t * data = &lazy->page_data[lru_id * LAZY_PAGE_SIZE];
+    uint32_t br = 0;
+    if(lv_fs_seek(&lazy->file, start, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+       lv_fs_read(&lazy->file, data, LAZY_PAGE_SIZE, &br) != LV_FS_RES_OK) {
+        page->start = UINT32_MAX;
+        page->last_use = 0;
+        return NULL;
+    }
+
+    page->start = start;
+    page->size = br;
+    page->last_use = lazy->use_cnt;
+    *size = br;
+    return data;
+}
+
+/**
+ * Get the number of bytes allocated for the cmaps and the kerning data of a loaded font
+ * @param fdsc pointer to a font descriptor
+ * @param glyph_cnt number of glyphs in the font
+ * @return the size in bytes
+ */
+static uint32_t lazy_get_data_size(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t glyph_cnt)
+{
+    uint32_t size = fdsc->cmap_num * sizeof(lv_font_fmt_txt_cmap_t);
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        if(cmap->unicode_list) size += cmap->list_length * sizeof(uint16_t);
+        if(cmap->glyph_id_ofs_list) {
+            size += cmap->list_length * (cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL ? sizeof(uint16_t) : sizeof(uint8_t));
+        }
+    }
+
+    if(fdsc->kern_dsc == NULL) return size;
+
+    if(fdsc->kern_classes == 0) {
+        const lv_font_fmt_txt_kern_pair_t * kern_pair = fdsc->kern_dsc;
+        size += sizeof(lv_font_fmt_txt_kern_pair_t);
+        size += kern_pair->pair_cnt * (kern_pair->glyph_ids_size == 0 ? 2 : 4);
+        size += kern_pair->pair_cnt;
+    }
+    else {
+        /*The class mappings have an entry for each glyph*/
+        const lv_font_fmt_txt_kern_classes_t * kern_classes = fdsc->kern_dsc;
+        size += sizeof(lv_font_fmt_txt_kern_classes_t);
+        size += 2 * glyph_cnt;
+        size += kern_classes->left_class_cnt * kern_classes->right_class_cnt;
+    }
+
+    return size;
+}
+
+/**
+ * Read bits from a buffer with the most significant bit first
+ * @param buf pointer to the buffer
+ * @param bit_pos the bit to start from, incremented by `n_bits`
+ * @param n_bits number of bits to read, max. 32
+ * @return the bits as an unsigned value
+ */
+static uint32_t get_bits(const uint8_t * buf, uint32_t * bit_pos, uint32_t n_bits)
+{
+    uint32_t value = 0;
+    while(n_bits--) {
+        uint32_t pos = *bit_pos;
+        value = (value << 1) | ((buf[pos >> 3] >> (7 - (pos & 7))) & 1);
+        (*bit_pos)++;
+    }
+
+    return value;
+}
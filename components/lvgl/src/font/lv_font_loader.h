@@ -22,11 +22,22 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Memory usage and page cache statistics of a font loaded by `lv_font_load_lazy()`*/
+typedef struct {
+    uint32_t resident_size;     /**< Bytes allocated for the font, including the page cache*/
+    uint32_t cache_size;        /**< Bytes of the page cache*/
+    uint32_t hit_cnt;           /**< Number of pages found in the cache*/
+    uint32_t miss_cnt;          /**< Number of pages read from the file*/
+    uint8_t hit_pct;            /**< `hit_cnt` in the percentage of all page reads*/
+} lv_font_lazy_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 lv_font_t * lv_font_load(const char * fontName);
+lv_font_t * lv_font_load_lazy(const char * font_name, uint32_t cache_size);
+bool lv_font_lazy_get_stats(const lv_font_t * font, lv_font_lazy_stats_t * stats);
 void lv_font_free(lv_font_t * font);
 
 /**********************
@@ -23725,6 +23725,412 @@ static const lv_font_fmt_txt_cmap_t cmaps[] = {
 
 
 
+/*--------------------
+ *  CMAP HASH
+ *--------------------*/
+
+/*Generated by scripts/font_cmap_hash.py*/
+static const uint16_t cmap_hash_seeds[] = {
+    25, 2, 0, 4, 32, 2, 3, 7, 2, 5, 100, 8,
+    25, 0, 8, 90, 0, 3, 10, 4, 83, 0, 1, 0,
+    11, 2, 12, 1, 7, 51, 1, 5, 2, 0, 15, 5,
+    9, 0, 0, 2, 6, 2, 0, 9, 28, 63, 6, 16,
+    9, 19, 28, 2, 6, 73, 3, 6, 5, 5, 14, 14,
+    12, 5, 31, 7, 93, 34, 0, 3, 0, 1, 5, 18,
+    0, 32, 29, 2, 7, 91, 1, 31, 3, 52, 13, 5,
+    5, 5, 12, 18, 7, 0, 37, 86, 12, 0, 23, 30,
+    3, 12, 7, 4, 8, 9, 2, 7, 1, 14, 21, 1,
+    3, 42, 23, 27, 2, 21, 81, 1, 20, 12, 10, 2,
+    1, 0, 45, 49, 39, 12, 15, 72, 6, 3, 30, 83,
+    0, 74, 5, 15, 2, 1, 32, 4, 4, 0, 31, 1,
+    14, 0, 55, 0, 26, 4, 0, 0, 2, 63, 9, 2,
+    17, 18, 51, 9, 9, 15, 16, 1, 87, 3, 7, 39,
+    13, 58, 35, 47, 4, 1, 8, 0, 2, 18, 11, 0,
+    8, 125, 3, 0, 4, 1, 11, 15, 11, 1, 52, 8,
+    1, 1, 9, 1, 9, 3, 3, 8, 11, 15, 41, 20,
+    2, 10, 4, 10, 2, 15, 25, 0, 0, 6, 32, 4,
+    8, 108, 3, 36, 84, 92, 36, 0, 29, 19, 12, 4,
+    2, 79, 15, 0, 69, 2, 16, 12, 10, 0, 41, 8,
+    4, 37, 17, 3, 2, 85, 10, 3, 19, 0, 2, 8,
+    42, 3, 37, 34, 6, 3, 10, 5, 277, 16, 4, 10,
+    4, 15, 0, 12, 21, 25, 19, 27, 195, 9, 0, 16,
+    5, 19, 13, 33, 12, 12, 9, 29, 0, 2, 106, 2,
+    0, 0, 64, 5, 5, 3, 2, 0, 23, 7, 114, 199,
+    22, 99, 11, 0, 74, 53, 8, 0, 94, 2, 25, 1,
+    8, 0, 11, 0, 12, 79, 10, 208, 79, 4, 22, 1,
+    20, 4, 8, 99, 0, 11, 81, 0, 289, 1, 16, 0,
+    68, 65, 20, 13, 54, 26, 7, 45, 12, 29, 13, 115,
+    47, 33, 18, 11, 52, 3, 7, 0, 3, 128, 5
+};
+
+static const uint32_t cmap_hash_letters[] = {
+    0x4fdd, 0x6687, 0x7d9a, 0x773e, 0x63d0, 0xf078, 0x0, 0x5de6,
+    0x8a00, 0x5fc5, 0x6fdf, 0x7e3e, 0x0, 0x0, 0x5931, 0x0,
+    0x6cc1, 0x7acb, 0x5411, 0xff08, 0x308f, 0x8a2d, 0x5358, 0x512a,
+    0x574a, 0xf079, 0x30b6, 0x4eee, 0x5fc3, 0x5b87, 0x96a8, 0x5e45,
+    0x58d3, 0x55ce, 0x0, 0x30c6, 0x6f22, 0x0, 0x670b, 0x63a1,
+    0x793a, 0x4e03, 0x570b, 0x0, 0x78, 0x8aad, 0x307b, 0x9589,
+    0x6d74, 0x0, 0x90a3, 0x8b1b, 0x5238, 0x5c71, 0x9ad8, 0x4d,
+    0x8b93, 0x6368, 0x8ab0, 0x8655, 0x7d39, 0x6210, 0x88e1, 0x82e6,
+    0x0, 0x0, 0x8ac7, 0x0, 0x3082, 0x6d3b, 0x843d, 0x5426,
+    0x55b6, 0x0, 0x89aa, 0x9178, 0x56, 0x9805, 0x8077, 0x0,
+    0x3066, 0x9045, 0x5e74, 0x902e, 0x600e, 0x6613, 0x65b9, 0x7956,
+    0x0, 0x8377, 0x51cd, 0x5869, 0x6dbc, 0x725b, 0x0, 0x30d5,
+    0x308d, 0x0, 0x5f79, 0x6557, 0x5ddd, 0x58eb, 0x767a, 0x0,
+    0x3051, 0xf15b, 0x722d, 0x0, 0x5199, 0x6703, 0x0, 0x8a72,
+    0x0, 0x7533, 0x628a, 0x3098, 0x4e3b, 0x6c38, 0xff12, 0x8607,
+    0x8a95, 0x63a2, 0x3074, 0xf241, 0xf027, 0x0, 0x4f3c, 0x0,
+    0x5165, 0x3081, 0x6c0f, 0x0, 0x22, 0x8ca9, 0x0, 0x8af8,
+    0x8fa6, 0x7528, 0x6539, 0x8d64, 0x80cc, 0x7372, 0x59c9, 0x42,
+    0x5b88, 0x0, 0x8fbc, 0x6255, 0x8003, 0x0, 0x7535, 0x8a8c,
+    0x0, 0x3079, 0x3073, 0x30f6, 0x0, 0x0, 0x6e09, 0x29,
+    0x30d9, 0x65bd, 0xf00d, 0x30a8, 0x7dd2, 0x5be6, 0x52d5, 0x5e03,
+    0x3053, 0x5c4b, 0x5b09, 0x52dd, 0x30af, 0x4e4b, 0x7802, 0x5951,
+    0x300d, 0x900f, 0x91ce, 0x682a, 0x5206, 0x306e, 0x0, 0x8efd,
+    0x0, 0x0, 0x4e0a, 0x0, 0x0, 0xf244, 0x0, 0x4f4d,
+    0x516b, 0x305c, 0x0, 0x9aea, 0x6559, 0x0, 0x2c, 0x6751,
+    0x521d, 0x95dc, 0x733f, 0x806f, 0x7523, 0x0, 0x8edf, 0x5403,
+    0x0, 0x4f60, 0x0, 0x9ec4, 0x0, 0x5f0f, 0x72ec, 0x3052,
+    0x40, 0x5354, 0x807d, 0x2f, 0x49, 0x53eb, 0x52a0, 0x6c34,
+    0x54c1, 0x6012, 0xf0f3, 0x964d, 0x5c4a, 0x5148, 0x83d3, 0x0,
+    0x4f4e, 0x9069, 0x6620, 0x5b85, 0x30c4, 0x6c37, 0x8208, 0x5eb7,
+    0x96ea, 0x5bb9, 0x9ad4, 0x6e29, 0x523b, 0x5185, 0x7ae5, 0x5b78,
+    0x559d, 0xf0c7, 0x65b0, 0x6a, 0x305b, 0x79cd, 0x5168, 0x9ee8,
+    0x79c0, 0x307d, 0x4ee4, 0x0, 0x0, 0x6cbb, 0x7d00, 0x5b89,
+    0x8996, 0x6797, 0x30b0, 0x0, 0x5bc6, 0x5ea7, 0x30e3, 0x0,
+    0x3e, 0x7576, 0x0, 0x0, 0x707d, 0xf054, 0x0, 0x3061,
+    0x96e8, 0x0, 0x5e7e, 0x0, 0x73a9, 0x3094, 0x3099, 0x85dd,
+    0x6b4c, 0x4e5d, 0x9996, 0x31, 0x307e, 0x6240, 0x554a, 0x306f,
+    0x6b61, 0x3060, 0x5e83, 0x0, 0x3c, 0x5225, 0x65e9, 0x561b,
+    0x72b6, 0x0, 0x8fb2, 0x59cb, 0x5e36, 0xf021, 0x4e86, 0xf243,
+    0x795d, 0x69cb, 0x0, 0x308a, 0x756b, 0x0, 0x4f5c, 0x52f5,
+    0x5fd9, 0x60, 0x7fa9, 0x706b, 0x0, 0x3069, 0x0, 0x5929,
+    0x4ea1, 0x0, 0x62c9, 0x984c, 0x539f, 0x4f9b, 0x822a, 0x982d,
+    0x3005, 0x0, 0x7406, 0x7a7a, 0x7530, 0x5957, 0x8cbb, 0x8155,
+    0x0, 0x5915, 0x30cb, 0xff0c, 0x0, 0x9054, 0x0, 0x5b66,
+    0x62e1, 0x5920, 0x5171, 0x4ed8, 0x8a33, 0x6c5a, 0xf287, 0x0,
+    0x0, 0x53e3, 0x53d7, 0x30b5, 0x309f, 0x8b8a, 0x53cb, 0x7d42,
+    0x5ea6, 0x6ce2, 0x6843, 0x30c7, 0x4ec0, 0x30d8, 0x4f7f, 0x74b0,
+    0x3078, 0x8cc7, 0x3064, 0x30ae, 0x0, 0x30ce, 0x30e6, 0x9577,
+    0x6761, 0x0, 0x60c5, 0x5a18, 0x9774, 0x0, 0x5145, 0x6c11,
+    0x5e2f, 0x30ad, 0x91cf, 0x5348, 0x0, 0xf013, 0x0, 0x63a8,
+    0x6d17, 0x666f, 0x0, 0x6625, 0x8db3, 0xf04c, 0x52aa, 0x4e4e,
+    0x5473, 0x518d, 0x62c5, 0x7a0b, 0x6b63, 0x6a02, 0x9010, 0x0,
+    0x7d71, 0x64c7, 0xf077, 0x0, 0x5a, 0x6821, 0x306b, 0x53c3,
+    0x76d7, 0x518a, 0x8584, 0x6982, 0x0, 0xf043, 0x5305, 0x683c,
+    0x3041, 0x5e0c, 0x5eab, 0x5272, 0x21, 0x3095, 0x570d, 0x3091,
+    0x77ed, 0x554f, 0x901f, 0x58ca, 0x7159, 0xf8a2, 0x6d77, 0x4f11,
+    0x8fce, 0x0, 0x0, 0x770b, 0x9664, 0x5b50, 0x0, 0xf07b,
+    0x30d3, 0x7238, 0x5bbf, 0x0, 0x7e3d, 0x611b, 0x50d5, 0x6d0b,
+    0x0, 0x8cea, 0x4e8b, 0x7a76, 0x35, 0x89d2, 0x5b58, 0x3059,
+    0x307c, 0x62bc, 0x5340, 0x7b97, 0x0, 0x516d, 0x63cf, 0x520a,
+    0x5973, 0x6cb9, 0x5fd8, 0x0, 0x0, 0x6c42, 0x6545, 0x3058,
+    0x8a9e, 0x0, 0x5e95, 0x3067, 0x6b64, 0x5f62, 0x0, 0x53b3,
+    0x9707, 0x7df4, 0x54e1, 0x5c08, 0x9a57, 0x0, 0x904b, 0x6e21,
+    0x52d9, 0x72c0, 0x44, 0x689d, 0x62ff, 0x6c92, 0xf242, 0x0,
+    0x5bb3, 0x514d, 0x30b8, 0x503c, 0x3044, 0x8907, 0x0, 0xf03e,
+    0x796d, 0x30e2, 0x48, 0x53, 0x61, 0x66, 0x0, 0x0,
+    0x0, 0x525b, 0x0, 0x8b77, 0x5947, 0x819d, 0x67ff, 0x4e16,
+    0x6628, 0x82f1, 0x7522, 0x8131, 0x5ff5, 0x30b1, 0x80af, 0x5f9e,
+    0x3002, 0x0, 0x8a55, 0x71, 0x6bd4, 0x71df, 0x0, 0x6d3e,
+    0x0, 0x7684, 0x7a93, 0x30da, 0x5dde, 0x9650, 0x304d, 0x0,
+    0x0, 0x57fa, 0x8a98, 0x6674, 0x65c1, 0x4e09, 0x7fd2, 0x5718,
+    0x9ce5, 0x7814, 0x53bb, 0x5d4c, 0x0, 0x9152, 0x308c, 0x305e,
+    0x4e5f, 0x5546, 0x0, 0x5371, 0x6c14, 0x0, 0x696d, 0x9817,
+    0x66c7, 0x0, 0xf051, 0x51b7, 0x898f, 0x753a, 0x4f01, 0x90fd,
+    0x5c40, 0x72ed, 0x65e5, 0x5abd, 0x64d4, 0x5f1f, 0x6b7b, 0x624d,
+    0x65ad, 0x8aac, 0x793e, 0x0, 0x4e9b, 0x4ee5, 0x7236, 0x7f6e,
+    0x7f, 0x53f3, 0x8f9e, 0x3042, 0x5275, 0x30e1, 0x4e00, 0x28,
+    0x5979, 0x5bd2, 0x30a9, 0x73fe, 0x7d20, 0x6691, 0x0, 0x72,
+    0x6975, 0x4ecb, 0x7bc4, 0x7d61, 0x643a, 0x3090, 0x5f93, 0x897f,
+    0x0, 0x3083, 0x7d44, 0x0, 0x5f85, 0x6e1b, 0x5b8c, 0x4efb,
+    0x5584, 0x0, 0x0, 0x5011, 0x57, 0x539a, 0x6b8b, 0x0,
+    0x0, 0x6a4b, 0x57f7, 0xf0e7, 0x5c24, 0x932f, 0x540c, 0x501f,
+    0x5e, 0x898b, 0x4e0d, 0x62ec, 0x34, 0x8868, 0x30e0, 0x61c9,
+    0x0, 0x4e, 0x6bb5, 0x60b2, 0x8209, 0x5927, 0x3001, 0x50cd,
+    0x0, 0x309b, 0x805e, 0x4e26, 0x5177, 0x0, 0x4fe1, 0x7d4c,
+    0x30dc, 0x0, 0x5e02, 0x0, 0x4e0b, 0x904e, 0x8166, 0x5982,
+    0x537b, 0x8feb, 0x5ee0, 0x304a, 0x8207, 0x30ed, 0xf2ed, 0x6388,
+    0x6216, 0x5207, 0x6c7a, 0x8eab, 0x30d4, 0x591c, 0x901a, 0x4ed5,
+    0x8f03, 0x4f46, 0x97f3, 0x6709, 0x3068, 0x6b, 0xf067, 0x8acb,
+    0x6b73, 0x0, 0x30bb, 0x52a9, 0x30bd, 0x7edf, 0x623f, 0x3092,
+    0x0, 0x5c07, 0x4eba, 0x0, 0x8853, 0x3086, 0x0, 0x2b,
+    0x0, 0x8ca0, 0x39, 0x6562, 0x9662, 0x7e70, 0x6765, 0x0,
+    0x6a39, 0x6697, 0x30c8, 0x3087, 0x0, 0x826f, 0x673a, 0xf240,
+    0x8a71, 0x9031, 0x4ee3, 0x601d, 0x8001, 0x0, 0x5ba2, 0x4fbf,
+    0x8ddf, 0x7740, 0x5bfe, 0x55ae, 0x7c21, 0xf0e0, 0x89e6, 0x5343,
+    0x8f15, 0x0, 0x33, 0x6bdb, 0x5217, 0x79cb, 0x6c17, 0x5bcc,
+    0x24, 0x306a, 0x30aa, 0x96c6, 0x0, 0x3f, 0x0, 0x6c,
+    0x6df7, 0x63a7, 0x4ea6, 0x7b, 0x524a, 0x4f9d, 0x0, 0x0,
+    0x72ac, 0x53f2, 0x0, 0xf0c5, 0x66dc, 0x0, 0x7e, 0x6bce,
+    0x8a0a, 0x4a, 0x5152, 0xf028, 0x5b83, 0x986f, 0x30cc, 0x652f,
+    0x969c, 0x5f7c, 0x82b1, 0x0, 0x4e88, 0x578b, 0x30a3, 0x8ba1,
+    0x5fa9, 0x5f35, 0x66f4, 0x5de5, 0x5143, 0x5074, 0x72af, 0x30a4,
+    0x0, 0x544a, 0x4efd, 0x6750, 0x0, 0x4f, 0x4b, 0x9ede,
+    0x75db, 0x0, 0x0, 0x6392, 0x7db2, 0x9322, 0x0, 0x3085,
+    0x6e96, 0x0, 0x60f3, 0x3088, 0x540d, 0x0, 0x7dda, 0x30a0,
+    0x0, 0xf071, 0x0, 0x65, 0x30d1, 0x0, 0x300c, 0x4e2d,
+    0x0, 0x672c, 0x8def, 0x96fb, 0x6642, 0x65b7, 0x53ea, 0x63fa,
+    0x904a, 0x76, 0x5fa1, 0x88dc, 0x6319, 0x0, 0x3047, 0x0,
+    0x6025, 0x67f1, 0x5cf6, 0x81fa, 0x6708, 0x5236, 0x53f7, 0x8f9b,
+    0x5b9a, 0x82e5, 0x30ec, 0x5b63, 0x6599, 0x77, 0x53f0, 0x5f80,
+    0x30ef, 0x7686, 0x30db, 0x0, 0x30cf, 0x8fd4, 0xf070, 0x8b1d,
+    0x8005, 0x0, 0x6b72, 0x5df1, 0x6e05, 0x0, 0x9f3b, 0x0,
+    0x7d66, 0x67, 0x975e, 0x8457, 0x0, 0x0, 0xf304, 0x5ead,
+    0x4fa1, 0x0, 0x6295, 0x0, 0xf019, 0x5bfa, 0x70, 0x98f2,
+    0x516c, 0x43, 0x30bc, 0x79d8, 0x0, 0x88ab, 0x5b69, 0x59d4,
+    0x8ca7, 0x53c8, 0x76ee, 0x0, 0x529b, 0x0, 0x9762, 0x0,
+    0x4c, 0x0, 0x50cf, 0x98db, 0x305a, 0x0, 0x30c9, 0x30f3,
+    0x30b7, 0x958b, 0x6607, 0x7b49, 0x9854, 0x0, 0x7518, 0x7d50,
+    0x3071, 0x8ad6, 0x30e8, 0x0, 0x6d41, 0x30b3, 0x5897, 0x9023,
+    0x45, 0x6a23, 0x38, 0x7ad9, 0x6696, 0x30d6, 0x96bb, 0x56de,
+    0x309c, 0x5341, 0x5bb6, 0x8535, 0x59b9, 0x5f31, 0x74, 0x7b2c,
+    0xf026, 0x793c, 0xf11c, 0x5317, 0x53ca, 0x5acc, 0x8d85, 0x53e4,
+    0x96d1, 0xff09, 0x7570, 0x7de0, 0x30ea, 0x5e2d, 0x90f5, 0x0,
+    0x0, 0x9f13, 0x5f15, 0x8a31, 0x4f4f, 0x0, 0x7834, 0x5f53,
+    0x52, 0x0, 0x6f38, 0x5024, 0x8a08, 0x79fb, 0x7d93, 0x0,
+    0x7c, 0x30dd, 0x660e, 0x533b, 0x307f, 0x8336, 0x8272, 0x47,
+    0x8b02, 0x4e57, 0x50b3, 0x0, 0x59d0, 0x672d, 0x756a, 0x79d1,
+    0x7981, 0x59bb, 0x6e07, 0x5229, 0x0, 0x4ef6, 0x0, 0x53d6,
+    0x23, 0x0, 0x96f2, 0x6b69, 0xf00c, 0x26, 0x305d, 0x5831,
+    0x6570, 0x67e5, 0x6bcf, 0x6b65, 0x6a2a, 0x7b54, 0x5b9f, 0x524d,
+    0x751a, 0x30cd, 0x30, 0x6d45, 0x89ba, 0x5e30, 0x9593, 0x64da,
+    0x4fee, 0x8cb7, 0x6790, 0x8449, 0x63ee, 0x6771, 0x925b, 0x753b,
+    0x6669, 0x8aaa, 0x30a7, 0x8ffd, 0x5f, 0x91ab, 0x25, 0x0,
+    0x61f8, 0x0, 0x7247, 0x6355, 0x0, 0x9084, 0x64, 0x63a5,
+    0x0, 0x30c3, 0x6b8a, 0x4e8c, 0x7cfb, 0x90e8, 0x50, 0x0,
+    0x7b26, 0x4e13, 0x0, 0x5d, 0x79, 0xf052, 0x90aa, 0x7260,
+    0x75c5, 0x30be, 0x9244, 0x80b2, 0x4fc2, 0x7dd1, 0x5916, 0x5c6c,
+    0x4f38, 0x5e78, 0x5834, 0xf55a, 0x899a, 0x75b2, 0x30e9, 0x51ac,
+    0x515a, 0x63db, 0x985e, 0x27, 0x91d1, 0x5712, 0x5c0e, 0x6253,
+    0x76f8, 0x639b, 0x0, 0x3065, 0x691c, 0x5373, 0x30b2, 0x58f2,
+    0x5bdd, 0x53e5, 0x69d8, 0x304c, 0xf053, 0xf074, 0x5462, 0x68ee,
+    0x5404, 0x3d, 0x51e6, 0x64c1, 0x9b5a, 0x0, 0x0, 0x0,
+    0x6b21, 0x5408, 0x5c, 0x30fc, 0x627e, 0x5f92, 0x0, 0x9ed2,
+    0x8cb8, 0x53c2, 0x5f37, 0x88fd, 0x5f8c, 0x8cc3, 0x908a, 0x56e0,
+    0x7cd6, 0x55ef, 0x98a8, 0x9000, 0xf048, 0x0, 0x7559, 0x5747,
+    0x9060, 0x30d7, 0x548c, 0x70ba, 0x0, 0x0, 0x5a66, 0x666e,
+    0x5224, 0x5c3a, 0x0, 0x9700, 0x50c5, 0x6d88, 0x5b57, 0x4e4f,
+    0x0, 0x77f3, 0x98df, 0x5b, 0x6848, 0x8a73, 0x9678, 0x95a2,
+    0x0, 0x9055, 0x5c1a, 0x767d, 0x88cf, 0x7d04, 0x4f8b, 0x6230,
+    0x5b9e, 0x6839, 0x54, 0x0, 0x6c88, 0x5c04, 0x6614, 0x99c5,
+    0x9752, 0x6bcd, 0x662f, 0x0, 0x7b46, 0x69, 0xff11, 0x0,
+    0x306d, 0x0, 0x0, 0x59b3, 0x695a, 0x3057, 0x8a2a, 0x30c1,
+    0x3055, 0xf095, 0x5099, 0x30bf, 0x58, 0x8a0e, 0x7121, 0x4e94,
+    0x0, 0x30e7, 0x76f4, 0x65bc, 0x0, 0x559c, 0x0, 0x505c,
+    0x5065, 0x5c65, 0x30a1, 0x9769, 0x8fd1, 0x8cac, 0x52e4, 0x4eca,
+    0x0, 0x5440, 0x32, 0x307a, 0x0, 0x8072, 0x771f, 0x5c0f,
+    0x884c, 0x6163, 0x6a5f, 0x81f3, 0x676f, 0x6e2f, 0x4e89, 0x4f86,
+    0x30e5, 0x30a5, 0x77e5, 0x3046, 0x6015, 0x0, 0x46, 0x68,
+    0x62ed, 0x4e45, 0x30e4, 0x58f0, 0x4ea4, 0x309d, 0x5b99, 0xf01c,
+    0x0, 0x9e97, 0x7531, 0x9020, 0x55, 0x50f9, 0x8b58, 0x0,
+    0x0, 0x9818, 0x6cca, 0x30b4, 0x0, 0x5e9c, 0x670d, 0x592a,
+    0x91dd, 0x9803, 0x0, 0x8d8a, 0x5a5a, 0x3063, 0x60a8, 0x547d,
+    0x0, 0x4e08, 0x5883, 0x6c60, 0x67fb, 0x6226, 0x0, 0x9644,
+    0x9001, 0x9332, 0x0, 0x309a, 0x0, 0x3043, 0x6e08, 0x9032,
+    0x571f, 0x5f88, 0x36, 0x5750, 0xf068, 0x6e, 0x56db, 0x4eac,
+    0x661f, 0x9999, 0x653e, 0x7279, 0x767c, 0x7ba1, 0x30ac, 0x53f8,
+    0x7d75, 0x71b1, 0x6027, 0x3054, 0x30c2, 0x6fc3, 0x0, 0xf7c2,
+    0x8a34, 0x54b2, 0x5c45, 0x3097, 0x606f, 0x97ff, 0x5247, 0x0,
+    0x4e07, 0x529f, 0x6307, 0x4e21, 0x4e14, 0x65cf, 0x91cd, 0x0,
+    0xf015, 0x96a3, 0x8239, 0x6e90, 0x8a66, 0xf1eb, 0x76bf, 0x6211,
+    0x5176, 0x0, 0x306c, 0x0, 0x0, 0x969b, 0x7b11, 0x56f0,
+    0x54ea, 0x5167, 0x0, 0x0, 0x0, 0x7e54, 0x0, 0x5e33,
+    0x9154, 0x5019, 0x0, 0x37, 0x8abf, 0x5efa, 0x5f8b, 0x5b6b,
+    0x800c, 0x5f71, 0x41, 0x7d19, 0x8ab2, 0x9759, 0x7f3a, 0x96e2,
+    0x0, 0x8a18, 0x3080, 0x0, 0x671f, 0x671d, 0x7dad, 0x9808,
+    0x591a, 0x75, 0x7a2e, 0x8fba, 0x623b, 0x3096, 0x0, 0x7c73,
+    0x0, 0x30b9, 0x0, 0x8c61, 0x5c11, 0x751f, 0x653f, 0x51,
+    0x30d2, 0x5144, 0x9ebc, 0x6d, 0x8a8d, 0x8c50, 0x30de, 0x96e3,
+    0x8cfd, 0x500b, 0x30ab, 0x2d, 0x8f09, 0x6a19, 0xf06e, 0x0,
+    0x592b, 0x590f, 0x589e, 0x3056, 0x967d, 0x0, 0x5beb, 0x98ef,
+    0x53cd, 0x0, 0x5e2b, 0xf001, 0x8981, 0x3072, 0x8d77, 0x5df2,
+    0x83dc, 0x0, 0x5730, 0x81c9, 0x5e38, 0x6548, 0x6f, 0x9003,
+    0x4f55, 0x6b32, 0x5c55, 0x7e7c, 0x6280, 0x4f0a, 0x70b9, 0x7e8c,
+    0x53ef, 0x7cbe, 0x6df1, 0x6ce8, 0x0, 0x514b, 0x30a6, 0x0,
+    0x0, 0x5b98, 0x0, 0x8b70, 0x56f3, 0x0, 0x5feb, 0x80fd,
+    0x9053, 0x5104, 0x505a, 0x79c1, 0x3093, 0x6167, 0x6ce3, 0xf011,
+    0x62db, 0x4f53, 0x3070, 0x679c, 0x8f38, 0x6108, 0x85ac, 0x697d,
+    0x5566, 0x5909, 0x732b, 0x7403, 0x5427, 0x0, 0x5f97, 0x304f,
+    0x8089, 0x66fe, 0x9a13, 0x671b, 0x4ed6, 0x30c0, 0x89c0, 0x0,
+    0x30ba, 0x30eb, 0x62, 0x5169, 0x7d, 0x5e73, 0x5a92, 0x6587,
+    0x5283, 0xf04d, 0x6cf3, 0x6574, 0x8da3, 0x81ea, 0x914d, 0x78ba,
+    0x0, 0x0, 0x6eff, 0x2e, 0x0, 0x4f1d, 0x624b, 0x304b,
+    0x663c, 0x6e9d, 0x0, 0x7b56, 0x5589, 0x3050, 0x4f59, 0x6a21,
+    0x8d70, 0x63, 0x7136, 0x8f2a, 0x53e6, 0x5186, 0x6b77, 0x8a13,
+    0x7bc0, 0x3075, 0x822c, 0x614b, 0x5149, 0x9280, 0x0, 0x8ee2,
+    0x6b50, 0x7a4d, 0xf0c9, 0x7de9, 0x0, 0x9858, 0x611f, 0x5316,
+    0xf008, 0x309e, 0x89e3, 0x0, 0x67d0, 0x56fd, 0x8033, 0x0,
+    0x68b0, 0x0, 0x96d9, 0x9928, 0x4ecd, 0x795e, 0x5c0d, 0x0,
+    0x59, 0x0, 0x6b62, 0x3a, 0x0, 0x80f8, 0x6728, 0x30a2,
+    0x5468, 0x0, 0x66f8, 0x4f1a, 0x547c, 0x5357, 0xf04b, 0xf00b,
+    0x0, 0x6301, 0x5bdf, 0x7063, 0x5728, 0x5e97, 0x3084, 0x7537,
+    0x8eca, 0x7f8e, 0x5c31, 0x6700, 0x672b, 0x584a, 0xf293, 0x3076,
+    0x0, 0x7a, 0x99c4, 0x6e56, 0x51dd, 0x30d0, 0x9019, 0x51fa,
+    0x7d30, 0x30ca, 0x9078, 0x52c9, 0x56b4, 0x96d6, 0x8170, 0x66f2,
+    0xf093, 0x3077, 0xf0ea, 0x20, 0x767e, 0x0, 0x672a, 0x6d32,
+    0x305f, 0x60aa, 0x616e, 0x907f, 0x968e, 0x8cbf, 0x304e, 0x5bc4,
+    0x57df, 0x3048, 0x80a9, 0x5230, 0x754c, 0x0, 0x0, 0xf0c4,
+    0x0, 0x30c5, 0x5ba4, 0x65e2, 0x66ff, 0x5dee, 0x3b, 0x0,
+    0x8ca1, 0x597d, 0x3089, 0xf124, 0x667a, 0x7269, 0x0, 0x983c,
+    0x65c5, 0x7720, 0x308b, 0x73, 0x30df, 0x0, 0x9a12, 0x6b6f,
+    0x0, 0x675f, 0x610f, 0x5352, 0x2a, 0x0, 0x6cd5, 0x65f6,
+    0x534a, 0x592e
+};
+
+static const uint16_t cmap_hash_glyph_ids[] = {
+    324, 774, 1047, 983, 723, 1380, 0, 605, 1140, 658, 914, 1057,
+    0, 0, 524, 0, 878, 1013, 451, 1409, 176, 1147, 418, 345,
+    494, 1381, 198, 296, 657, 556, 1289, 619, 508, 476, 0, 211,
+    911, 0, 789, 717, 992, 253, 486, 0, 89, 1163, 157, 1273,
+    892, 0, 1251, 1172, 386, 599, 1337, 46, 1178, 713, 1164, 1118,
+    1037, 685, 1125, 1104, 0, 0, 1167, 0, 164, 888, 1110, 452,
+    475, 0, 1134, 1259, 55, 1312, 1076, 0, 136, 1238, 621, 1235,
+    663, 760, 748, 995, 0, 1107, 372, 503, 895, 929, 0, 225,
+    175, 0, 644, 738, 602, 509, 969, 0, 116, 1395, 925, 0,
+    369, 786, 0, 1154, 0, 955, 699, 176, 266, 869, 1413, 1117,
+    1158, 718, 150, 1398, 1361, 0, 306, 0, 355, 163, 863, 0,
+    3, 1185, 0, 1170, 1216, 952, 733, 1195, 1082, 941, 535, 35,
+    557, 0, 1219, 696, 1069, 0, 956, 1156, 0, 155, 149, 250,
+    0, 0, 901, 10, 228, 750, 1353, 185, 1051, 577, 401, 610,
+    118, 595, 545, 403, 191, 268, 988, 526, 101, 1228, 1262, 816,
+    376, 144, 0, 1208, 0, 0, 257, 0, 0, 1401, 0, 308,
+    359, 127, 0, 1338, 739, 0, 13, 801, 380, 1277, 940, 1074,
+    951, 0, 1206, 446, 0, 315, 0, 1343, 0, 635, 937, 117,
+    33, 416, 1077, 16, 42, 439, 397, 867, 463, 664, 1392, 1279,
+    594, 349, 1108, 0, 309, 1246, 763, 555, 210, 868, 1095, 632,
+    1298, 569, 1336, 904, 387, 365, 1015, 553, 473, 1387, 746, 75,
+    126, 1003, 357, 1346, 1000, 159, 294, 0, 0, 877, 1032, 558,
+    1132, 808, 192, 0, 572, 629, 238, 0, 31, 965, 0, 0,
+    917, 1372, 0, 132, 1297, 0, 623, 0, 942, 176, 176, 1116,
+    842, 272, 1329, 18, 160, 692, 467, 145, 844, 131, 624, 0,
+    29, 382, 756, 478, 935, 0, 1217, 536, 617, 1359, 274, 1400,
+    996, 830, 0, 172, 963, 0, 314, 405, 660, 65, 1066, 916,
+    0, 139, 0, 520, 281, 0, 703, 1318, 423, 319, 1097, 1316,
+    99, 0, 945, 1011, 953, 527, 1189, 1086, 0, 514, 216, 1411,
+    0, 1243, 0, 550, 705, 518, 362, 292, 1149, 871, 1402, 0,
+    0, 434, 433, 197, 176, 1177, 430, 1038, 628, 881, 819, 212,
+    286, 176, 316, 946, 154, 1192, 134, 190, 0, 218, 176, 1272,
+    803, 0, 673, 539, 1308, 0, 348, 864, 614, 189, 1263, 413,
+    0, 1355, 0, 721, 886, 771, 0, 764, 1201, 1367, 399, 269,
+    458, 368, 702, 1007, 846, 832, 1229, 0, 1044, 729, 1379, 0,
+    59, 815, 141, 427, 976, 367, 1114, 829, 0, 1364, 406, 818,
+    102, 611, 630, 392, 2, 176, 487, 176, 986, 468, 1232, 507,
+    922, 1408, 893, 302, 1220, 0, 0, 980, 1282, 546, 0, 1382,
+    223, 927, 570, 0, 1056, 677, 342, 885, 0, 1193, 277, 1010,
+    22, 1137, 548, 124, 158, 701, 410, 1023, 0, 361, 722, 378,
+    528, 876, 659, 0, 0, 870, 736, 123, 1160, 0, 625, 137,
+    847, 642, 0, 424, 1302, 1055, 464, 583, 1335, 0, 1240, 903,
+    402, 936, 37, 821, 708, 875, 1399, 0, 567, 352, 200, 332,
+    105, 1127, 0, 1363, 998, 237, 41, 52, 66, 71, 0, 0,
+    0, 391, 0, 1176, 525, 1089, 814, 262, 765, 1105, 950, 1085,
+    662, 193, 1080, 654, 98, 0, 1151, 82, 861, 924, 0, 889,
+    0, 973, 1012, 229, 603, 1280, 112, 0, 0, 499, 1159, 772,
+    751, 256, 1067, 489, 1340, 989, 425, 601, 0, 1257, 174, 129,
+    273, 466, 0, 419, 865, 0, 826, 1314, 778, 0, 1369, 371,
+    1131, 958, 300, 1255, 592, 938, 755, 543, 730, 637, 854, 694,
+    745, 1162, 994, 0, 280, 295, 926, 1064, 96, 443, 1215, 103,
+    393, 236, 252, 9, 529, 574, 176, 943, 1035, 775, 0, 83,
+    827, 288, 1026, 1042, 727, 176, 652, 1128, 0, 165, 1039, 0,
+    647, 902, 559, 298, 470, 0, 0, 328, 56, 422, 856, 0,
+    0, 838, 498, 1390, 589, 1270, 449, 330, 63, 1130, 259, 706,
+    21, 1121, 235, 683, 0, 47, 857, 672, 1096, 519, 97, 340,
+    0, 176, 1073, 264, 364, 0, 325, 1040, 231, 0, 609, 0,
+    258, 1241, 1087, 531, 421, 1223, 633, 109, 1094, 247, 1404, 714,
+    687, 377, 873, 1204, 224, 517, 1231, 290, 1209, 307, 1309, 788,
+    138, 76, 1373, 1168, 852, 0, 203, 398, 205, 1062, 691, 177,
+    0, 582, 285, 0, 1120, 168, 0, 12, 0, 1182, 26, 740,
+    1281, 1059, 804, 0, 837, 777, 213, 169, 0, 1100, 799, 1397,
+    1153, 1236, 293, 666, 1068, 0, 565, 322, 1202, 984, 580, 474,
+    1027, 1389, 1139, 412, 1211, 0, 20, 862, 379, 1002, 866, 573,
+    5, 140, 186, 1291, 0, 32, 0, 77, 897, 720, 283, 92,
+    389, 320, 0, 0, 933, 442, 0, 1386, 779, 0, 95, 859,
+    1142, 43, 353, 1362, 554, 1322, 176, 732, 1287, 645, 1102, 0,
+    275, 496, 181, 1179, 656, 639, 781, 604, 346, 336, 934, 182,
+    0, 455, 299, 800, 0, 48, 44, 1345, 968, 0, 0, 715,
+    1049, 1269, 0, 167, 908, 0, 674, 170, 450, 0, 1052, 176,
+    0, 1377, 0, 70, 221, 0, 100, 265, 0, 797, 1203, 1300,
+    768, 747, 438, 726, 1239, 87, 655, 1124, 711, 0, 107, 0,
+    667, 812, 600, 1093, 787, 385, 444, 1214, 562, 1103, 246, 549,
+    744, 88, 441, 646, 248, 974, 230, 0, 219, 1222, 1376, 1173,
+    1070, 0, 851, 607, 898, 0, 1348, 0, 1043, 72, 1305, 1112,
+    0, 0, 1405, 631, 321, 0, 700, 0, 1357, 579, 81, 1327,
+    360, 36, 204, 1005, 0, 1122, 551, 538, 1184, 428, 977, 0,
+    395, 0, 1306, 0, 45, 0, 341, 1324, 125, 0, 214, 249,
+    199, 1274, 758, 1020, 1319, 0, 947, 1041, 147, 1169, 242, 0,
+    890, 195, 505, 1234, 38, 835, 25, 1014, 776, 226, 1290, 481,
+    176, 411, 568, 1113, 533, 638, 85, 1018, 1360, 993, 1393, 408,
+    429, 544, 1198, 435, 1292, 1410, 964, 1053, 244, 613, 1254, 0,
+    0, 1347, 636, 1148, 310, 0, 990, 641, 51, 0, 912, 331,
+    1141, 1006, 1046, 0, 93, 232, 759, 409, 161, 1106, 1101, 40,
+    1171, 271, 338, 0, 537, 798, 962, 1004, 999, 534, 899, 383,
+    0, 297, 0, 432, 4, 0, 1299, 849, 1352, 7, 128, 500,
+    741, 811, 860, 848, 836, 1021, 564, 390, 948, 217, 17, 891,
+    1135, 615, 1275, 731, 326, 1187, 807, 1111, 725, 806, 1267, 959,
+    769, 1161, 184, 1224, 64, 1260, 6, 0, 684, 0, 928, 712,
+    0, 1249, 69, 719, 0, 209, 855, 278, 1031, 1253, 49, 0,
+    1017, 260, 0, 62, 90, 1370, 1252, 930, 967, 176, 1266, 1081,
+    323, 1050, 515, 598, 305, 622, 501, 1406, 1133, 966, 243, 370,
+    354, 724, 1321, 8, 1264, 488, 585, 695, 979, 716, 0, 135,
+    824, 420, 194, 511, 575, 436, 831, 111, 1371, 1378, 456, 823,
+    447, 30, 374, 728, 1339, 0, 0, 0, 840, 448, 61, 251,
+    697, 651, 0, 1344, 1188, 426, 640, 1126, 650, 1191, 1250, 482,
+    1030, 477, 1323, 1225, 1365, 0, 961, 493, 1245, 227, 461, 919,
+    0, 0, 541, 770, 381, 591, 0, 1301, 339, 894, 547, 270,
+    0, 987, 1325, 60, 820, 1155, 1283, 1276, 0, 1244, 588, 971,
+    1123, 1033, 318, 689, 563, 817, 53, 0, 874, 581, 761, 1332,
+    1303, 858, 766, 0, 1019, 74, 1412, 0, 143, 0, 0, 532,
+    825, 122, 1146, 208, 120, 1384, 337, 206, 57, 1143, 920, 279,
+    0, 241, 978, 749, 0, 472, 0, 334, 335, 597, 179, 1307,
+    1221, 1186, 404, 287, 0, 454, 19, 156, 0, 1075, 981, 586,
+    1119, 680, 839, 1092, 805, 905, 276, 317, 240, 176, 985, 106,
+    665, 0, 39, 73, 707, 267, 239, 510, 282, 176, 561, 1358,
+    0, 1341, 954, 1233, 54, 343, 1174, 0, 0, 1315, 879, 196,
+    0, 627, 790, 521, 1265, 1311, 0, 1199, 540, 133, 670, 460,
+    0, 255, 504, 872, 813, 688, 0, 1278, 1226, 1271, 0, 176,
+    0, 104, 900, 1237, 490, 648, 23, 495, 1374, 79, 480, 284,
+    762, 1330, 734, 932, 970, 1024, 188, 445, 1045, 923, 668, 119,
+    176, 913, 0, 1407, 1150, 462, 593, 176, 669, 1310, 388, 0,
+    254, 396, 710, 263, 261, 753, 1261, 0, 1356, 1288, 1099, 907,
+    1152, 1396, 975, 686, 363, 0, 142, 0, 0, 1286, 1016, 483,
+    465, 356, 0, 0, 0, 1058, 0, 616, 1258, 329, 0, 24,
+    1166, 634, 649, 552, 1071, 643, 34, 1034, 1165, 1304, 1063, 1295,
+    0, 1145, 162, 0, 793, 792, 1048, 1313, 516, 86, 1008, 1218,
+    690, 176, 0, 1028, 0, 201, 0, 1181, 587, 949, 735, 50,
+    222, 347, 1342, 78, 1157, 1180, 233, 1296, 1194, 327, 187, 14,
+    1210, 833, 1375, 0, 522, 513, 506, 121, 1284, 0, 578, 1326,
+    431, 0, 612, 1349, 1129, 148, 1197, 608, 1109, 0, 492, 1090,
+    618, 737, 80, 1227, 312, 841, 596, 1060, 698, 301, 918, 1061,
+    440, 1029, 896, 883, 0, 351, 183, 0, 0, 560, 0, 1175,
+    484, 0, 661, 1084, 1242, 344, 333, 1001, 178, 681, 882, 1354,
+    704, 311, 146, 809, 1213, 675, 1115, 828, 469, 512, 939, 944,
+    453, 0, 653, 114, 1078, 783, 1334, 791, 291, 207, 1136, 0,
+    202, 245, 67, 358, 94, 620, 542, 743, 394, 1368, 884, 742,
+    1200, 1091, 1256, 991, 0, 0, 910, 15, 0, 304, 693, 110,
+    767, 909, 0, 1022, 471, 115, 313, 834, 1196, 68, 921, 1212,
+    437, 366, 853, 1144, 1025, 151, 1098, 679, 350, 1268, 0, 1207,
+    843, 1009, 1388, 1054, 0, 1320, 678, 407, 1350, 176, 1138, 0,
+    810, 485, 1072, 0, 822, 0, 1294, 1328, 289, 997, 584, 0,
+    58, 0, 845, 27, 0, 1083, 794, 180, 457, 0, 782, 303,
+    459, 417, 1366, 1351, 0, 709, 576, 915, 491, 626, 166, 957,
+    1205, 1065, 590, 785, 796, 502, 1403, 152, 0, 91, 1331, 906,
+    373, 220, 1230, 375, 1036, 215, 1247, 400, 479, 1293, 1088, 780,
+    1383, 153, 1391, 1, 972, 0, 795, 887, 130, 671, 682, 1248,
+    1285, 1190, 113, 571, 497, 108, 1079, 384, 960, 0, 0, 1385,
+    0, 176, 566, 754, 784, 606, 28, 0, 1183, 530, 171, 1394,
+    773, 931, 0, 1317, 752, 982, 173, 84, 234, 0, 1333, 850,
+    0, 802, 676, 415, 11, 0, 880, 757, 414, 523
+};
+
+static const lv_font_fmt_txt_cmap_hash_t cmap_hash = {
+    .seeds = cmap_hash_seeds,
+    .letters = cmap_hash_letters,
+    .glyph_ids = cmap_hash_glyph_ids,
+    .bucket_cnt = 359,
+    .slot_cnt = 1690
+};
+/*End of CMAP HASH*/
+
 /*--------------------
  *  ALL CUSTOM DATA
  *--------------------*/
@@ -23746,7 +24152,8 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .kern_classes = 0,
     .bitmap_format = 0,
 #if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
+    .cache = &cache,
+    .cmap_hash = &cmap_hash
 #endif
 };
 
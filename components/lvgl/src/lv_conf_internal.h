@@ -313,6 +313,34 @@
             #define LV_CIRCLE_CACHE_SIZE 4
         #endif
     #endif
+
+    /* Set number of maximally cached rounded rectangle corners.
+    * The anti-aliased coverage of a corner is saved to draw rectangles, borders and outlines without masks
+    * (radius or border width)^2 bytes are used per corner (the most recently used ones are saved)
+    * The corners are stored in a LV_CORNER_CACHE_SIZE kB buffer which is allocated on first use and kept until `lv_deinit()`
+    * 0: to always draw the corners with masks */
+    #ifndef LV_CORNER_CACHE_SIZE
+        #ifdef CONFIG_LV_CORNER_CACHE_SIZE
+            #define LV_CORNER_CACHE_SIZE CONFIG_LV_CORNER_CACHE_SIZE
+        #else
+            #define LV_CORNER_CACHE_SIZE 4
+        #endif
+    #endif
+
+    /* Use the constant circle data of `src/draw/lv_draw_mask_circle_tables.c` for the radii it contains
+    * instead of calculating and caching them at runtime. Regenerate it with `scripts/circle_table_gen.py`
+    * for the radii used by your theme. About radius * 6 bytes of flash are used per radius */
+    #ifndef LV_USE_CIRCLE_TABLES
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_USE_CIRCLE_TABLES
+                #define LV_USE_CIRCLE_TABLES CONFIG_LV_USE_CIRCLE_TABLES
+            #else
+                #define LV_USE_CIRCLE_TABLES 0
+            #endif
+        #else
+            #define LV_USE_CIRCLE_TABLES 1
+        #endif
+    #endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -356,6 +384,66 @@
     #endif
 #endif
 
+/*Default memory limit of the image cache in bytes. The decoded images allocated by the decoders are counted too.
+ *If the limit is reached the least recently used images are closed, preferring the ones which are faster to open.
+ *0: no limit, only the number of images (LV_IMG_CACHE_DEF_SIZE) is limited*/
+#ifndef LV_IMG_CACHE_DEF_MEM_SIZE
+    #ifdef CONFIG_LV_IMG_CACHE_DEF_MEM_SIZE
+        #define LV_IMG_CACHE_DEF_MEM_SIZE CONFIG_LV_IMG_CACHE_DEF_MEM_SIZE
+    #else
+        #define LV_IMG_CACHE_DEF_MEM_SIZE 0
+    #endif
+#endif
+
+/*1: Convert the indexed, alpha only (1..4 bit), chroma keyed and (with 16 bit colors) ARGB images to the native color format
+ *when they are cached, so they are drawn as plain blits. Transparent images become RGB565A8 with 16 bit colors.
+ *Requires LV_IMG_CACHE_DEF_SIZE > 0 and uses (sizeof(lv_color_t) + 1) bytes per pixel while the image is cached*/
+#ifndef LV_IMG_CACHE_CONVERT
+    #ifdef CONFIG_LV_IMG_CACHE_CONVERT
+        #define LV_IMG_CACHE_CONVERT CONFIG_LV_IMG_CACHE_CONVERT
+    #else
+        #define LV_IMG_CACHE_CONVERT 0
+    #endif
+#endif
+
+/*1: Keep the recolored (`img_recolor` / `img_recolor_opa`) variants of the images in the image cache,
+ *so the colors are mixed only once and not on every draw. The variants use the same budget as the other cached images.
+ *Requires LV_IMG_CACHE_DEF_SIZE > 0*/
+#ifndef LV_IMG_CACHE_RECOLOR
+    #ifdef CONFIG_LV_IMG_CACHE_RECOLOR
+        #define LV_IMG_CACHE_RECOLOR CONFIG_LV_IMG_CACHE_RECOLOR
+    #else
+        #define LV_IMG_CACHE_RECOLOR 0
+    #endif
+#endif
+
+/*1: Keep the zoomed and/or rotated (`transform_zoom` / `transform_angle`) variants of the images in the image cache,
+ *so redrawing a statically transformed image is a plain blit. Only one transformed variant is kept per image,
+ *and it's built when the same angle, zoom, pivot and antialiasing is drawn twice in a row (so not while animating).
+ *The variants use the same budget as the other cached images.
+ *Requires LV_IMG_CACHE_DEF_SIZE > 0*/
+#ifndef LV_IMG_CACHE_TRANSFORM
+    #ifdef CONFIG_LV_IMG_CACHE_TRANSFORM
+        #define LV_IMG_CACHE_TRANSFORM CONFIG_LV_IMG_CACHE_TRANSFORM
+    #else
+        #define LV_IMG_CACHE_TRANSFORM 0
+    #endif
+#endif
+
+/*1: Decode the image files and the images of the external decoders (e.g. PNG, JPG) on a worker thread registered with
+ *`lv_img_cache_async_drv_register()`. A placeholder (or the dominant color of the image if it was decoded before)
+ *is drawn until the image is ready. `lv_img_cache_prefetch()` decodes images before they are shown.
+ *The memory management is locked by the driver so the decoders can use it from the worker.
+ *The decoders and the file system drivers run on the worker too, so custom ones need to be thread-safe.
+ *Requires LV_IMG_CACHE_DEF_SIZE > 0*/
+#ifndef LV_IMG_CACHE_ASYNC
+    #ifdef CONFIG_LV_IMG_CACHE_ASYNC
+        #define LV_IMG_CACHE_ASYNC CONFIG_LV_IMG_CACHE_ASYNC
+    #else
+        #define LV_IMG_CACHE_ASYNC 0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1209,6 +1297,29 @@
     #endif
 #endif
 
+/*Number of letters and kerning pairs to cache per font to find their glyph ID and kerning value quickly.
+ *Needs to be a power of 2. 0: to cache only the last letter*/
+#ifndef LV_FONT_FMT_TXT_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_CACHE_SIZE 16
+    #endif
+#endif
+
+/*Size of the glyph cache in bytes (0: disable, else min. 256).
+ *Glyphs of the built-in format fonts (except plain 8 bpp) are stored already decompressed and expanded to 8 bpp opacity
+ *so redrawing a text doesn't need to decompress and unpack its glyphs again. The least recently used glyphs are dropped.
+ *A glyph needs box_w * box_h + 24 bytes (on 32 bit MCUs): the ASCII range of Montserrat 14 is ~10 kB, of Montserrat 24 ~21 kB.
+ *Make it large enough for the glyphs of a screen, else the glyphs are expanded again in every refresh.*/
+#ifndef LV_FONT_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_GLYPH_CACHE_SIZE
+        #define LV_FONT_GLYPH_CACHE_SIZE CONFIG_LV_FONT_GLYPH_CACHE_SIZE
+    #else
+        #define LV_FONT_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
 /*Enable subpixel rendering*/
 #ifndef LV_USE_FONT_SUBPX
     #ifdef CONFIG_LV_USE_FONT_SUBPX
@@ -1474,7 +1585,21 @@
                 #define LV_LABEL_LONG_TXT_HINT 0
             #endif
         #else
-            #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+            #define LV_LABEL_LONG_TXT_HINT 1  /*Store the lines and some extra info in labels to speed up drawing of long texts*/
+        #endif
+    #endif
+    #ifndef LV_LABEL_SCROLL_CACHE_SIZE
+        #ifdef CONFIG_LV_LABEL_SCROLL_CACHE_SIZE
+            #define LV_LABEL_SCROLL_CACHE_SIZE CONFIG_LV_LABEL_SCROLL_CACHE_SIZE
+        #else
+            #define LV_LABEL_SCROLL_CACHE_SIZE 0  /*>0: render the text of scrolling labels once to an A8 image of max. this size (bytes)*/
+        #endif
+    #endif
+    #ifndef LV_LABEL_TEXT_INLINE_SIZE
+        #ifdef CONFIG_LV_LABEL_TEXT_INLINE_SIZE
+            #define LV_LABEL_TEXT_INLINE_SIZE CONFIG_LV_LABEL_TEXT_INLINE_SIZE
+        #else
+            #define LV_LABEL_TEXT_INLINE_SIZE 0   /*>0: store texts of max. this size (bytes with the closing '\0') in the label without allocation*/
         #endif
     #endif
 #endif
@@ -2087,6 +2212,15 @@
         #define LV_USE_PNG 0
     #endif
 #endif
+#if LV_USE_PNG
+    #ifndef LV_PNG_STREAM
+        #ifdef CONFIG_LV_PNG_STREAM
+            #define LV_PNG_STREAM CONFIG_LV_PNG_STREAM
+        #else
+            #define LV_PNG_STREAM 0   /*1: decode the PNG rows directly into the native color format with a few KB of RAM*/
+        #endif
+    #endif
+#endif
 
 /*BMP decoder library*/
 #ifndef LV_USE_BMP
@@ -2106,6 +2240,22 @@
         #define LV_USE_SJPG 0
     #endif
 #endif
+#if LV_USE_SJPG
+    #ifndef LV_SJPG_CACHE_SIZE
+        #ifdef CONFIG_LV_SJPG_CACHE_SIZE
+            #define LV_SJPG_CACHE_SIZE CONFIG_LV_SJPG_CACHE_SIZE
+        #else
+            #define LV_SJPG_CACHE_SIZE 0    /*Bytes of decoded slices to keep per image, at least one slice is kept*/
+        #endif
+    #endif
+    #ifndef LV_SJPG_PREFETCH
+        #ifdef CONFIG_LV_SJPG_PREFETCH
+            #define LV_SJPG_PREFETCH CONFIG_LV_SJPG_PREFETCH
+        #else
+            #define LV_SJPG_PREFETCH 0      /*1: decode the next slice in the background (requires LV_IMG_CACHE_ASYNC)*/
+        #endif
+    #endif
+#endif
 
 /*GIF decoder library*/
 #ifndef LV_USE_GIF
@@ -2125,6 +2275,31 @@
     #endif
 #endif
 
+/*Asset packs: pre-converted images, fonts and strings in one blob which is used in place (see scripts/lv_asset_pack.py)*/
+#ifndef LV_USE_ASSET_PACK
+    #ifdef CONFIG_LV_USE_ASSET_PACK
+        #define LV_USE_ASSET_PACK CONFIG_LV_USE_ASSET_PACK
+    #else
+        #define LV_USE_ASSET_PACK 0
+    #endif
+#endif
+#if LV_USE_ASSET_PACK
+    #ifndef LV_ASSET_PACK_LETTER
+        #ifdef CONFIG_LV_ASSET_PACK_LETTER
+            #define LV_ASSET_PACK_LETTER CONFIG_LV_ASSET_PACK_LETTER
+        #else
+            #define LV_ASSET_PACK_LETTER '\0'   /*Set an upper cased letter to access the assets as files (e.g. 'Z' for "Z:name")*/
+        #endif
+    #endif
+    #ifndef LV_ASSET_PACK_MMAP
+        #ifdef CONFIG_LV_ASSET_PACK_MMAP
+            #define LV_ASSET_PACK_MMAP CONFIG_LV_ASSET_PACK_MMAP
+        #else
+            #define LV_ASSET_PACK_MMAP 0        /*1: lv_asset_pack_open() maps the file with POSIX mmap() instead of loading it*/
+        #endif
+    #endif
+#endif
+
 /*FreeType library*/
 #ifndef LV_USE_FREETYPE
     #ifdef CONFIG_LV_USE_FREETYPE
@@ -2170,6 +2345,15 @@
             #endif
         #endif
     #endif
+    /*Size of the glyph cache in bytes (0: disable).
+     *It stores the rendered glyphs already converted to A8 so redrawing a text doesn't reach FreeType.*/
+    #ifndef LV_FREETYPE_GLYPH_CACHE_SIZE
+        #ifdef CONFIG_LV_FREETYPE_GLYPH_CACHE_SIZE
+            #define LV_FREETYPE_GLYPH_CACHE_SIZE CONFIG_LV_FREETYPE_GLYPH_CACHE_SIZE
+        #else
+            #define LV_FREETYPE_GLYPH_CACHE_SIZE (16 * 1024)
+        #endif
+    #endif
 #endif
 
 /*Rlottie library*/
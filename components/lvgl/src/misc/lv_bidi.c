@@ -19,8 +19,8 @@
 #define LV_BIDI_BRACKLET_DEPTH   4
 
 // Highest bit of the 16-bit pos_conv value specifies whether this pos is RTL or not
-#define GET_POS(x) ((x) & 0x7FFF)
-#define IS_RTL_POS(x) (((x) & 0x8000) != 0)
+#define GET_POS(x) _LV_BIDI_GET_POS(x)
+#define IS_RTL_POS(x) _LV_BIDI_IS_RTL_POS(x)
 #define SET_RTL_POS(x, is_rtl) (GET_POS(x) | ((is_rtl)? 0x8000: 0))
 
 /**********************
@@ -27,6 +27,10 @@ extern "C" {
 #define LV_BIDI_LRO  "\xE2\x80\xAD" /*U+202D*/
 #define LV_BIDI_RLO  "\xE2\x80\xAE" /*U+202E*/
 
+/*Get the position and the direction from an item of the `pos_conv_out` array of `_lv_bidi_process_paragraph()`*/
+#define _LV_BIDI_GET_POS(x)     ((x) & 0x7FFF)
+#define _LV_BIDI_IS_RTL_POS(x)  (((x) & 0x8000) != 0)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -157,6 +157,10 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, char * buf, uint32_t
                 /*If remaining data chuck is bigger than buffer size, then do not use cache, instead read it directly from FS*/
                 res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)(buf + buffer_remaining_length),
                                            btr - buffer_remaining_length, &bytes_read_to_buffer);
+
+                /*The FS position is not at the end of the buffer anymore so drop the buffer*/
+                file_p->cache->start = file_p->cache->end + bytes_read_to_buffer;
+                file_p->cache->end = file_p->cache->start;
             }
             else {
                 /*If remaining data chunk is smaller than buffer size, then read into cache buffer*/
@@ -175,6 +179,10 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, char * buf, uint32_t
         if(btr > buffer_size) {
             /*If bigger data is requested, then do not use cache, instead read it directly*/
             res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buf, btr, br);
+
+            /*The FS position is not at the end of the buffer anymore so drop the buffer*/
+            file_p->cache->start = file_position + *br;
+            file_p->cache->end = file_p->cache->start;
         }
         else {
             /*If small data is requested, then read from FS into cache buffer*/
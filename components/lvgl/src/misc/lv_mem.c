@@ -49,6 +49,7 @@
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+static void * mem_buf_get(uint32_t size);
 
 /**********************
  *  STATIC VARIABLES
@@ -61,6 +62,11 @@
 
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+#if LV_IMG_CACHE_ASYNC
+    static void (*lock_cb)(void);
+    static void (*unlock_cb)(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -70,6 +76,14 @@ static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variabl
     #define MEM_TRACE(...)
 #endif
 
+#if LV_IMG_CACHE_ASYNC
+    #define MEM_LOCK()      if(lock_cb) lock_cb()
+    #define MEM_UNLOCK()    if(unlock_cb) unlock_cb()
+#else
+    #define MEM_LOCK()
+    #define MEM_UNLOCK()
+#endif
+
 #define COPY32 *d32 = *s32; d32++; s32++;
 #define COPY8 *d8 = *s8; d8++; s8++;
 #define SET32(x) *d32 = x; d32++;
@@ -131,6 +145,7 @@ void * lv_mem_alloc(size_t size)
     }
 
 #if LV_MEM_CUSTOM == 0
+    MEM_LOCK();
     void * alloc = lv_tlsf_malloc(tlsf, size);
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
@@ -159,6 +174,10 @@ void * lv_mem_alloc(size_t size)
 #endif
         MEM_TRACE("allocated at %p", alloc);
     }
+
+#if LV_MEM_CUSTOM == 0
+    MEM_UNLOCK();
+#endif
     return alloc;
 }
 
@@ -173,12 +192,14 @@ void lv_mem_free(void * data)
     if(data == NULL) return;
 
 #if LV_MEM_CUSTOM == 0
+    MEM_LOCK();
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
     size_t size = lv_tlsf_free(tlsf, data);
     if(cur_used > size) cur_used -= size;
     else cur_used = 0;
+    MEM_UNLOCK();
 #else
     LV_MEM_CUSTOM_FREE(data);
 #endif
@@ -203,7 +224,9 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
 #if LV_MEM_CUSTOM == 0
+    MEM_LOCK();
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+    MEM_UNLOCK();
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
@@ -250,7 +273,9 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 #if LV_MEM_CUSTOM == 0
     MEM_TRACE("begin");
 
+    MEM_LOCK();
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
+    MEM_UNLOCK();
 
     mon_p->total_size = LV_MEM_SIZE;
     mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
@@ -275,54 +300,10 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
  */
 void * lv_mem_buf_get(uint32_t size)
 {
-    if(size == 0) return NULL;
-
-    MEM_TRACE("begin, getting %d bytes", size);
-
-    /*Try to find a free buffer with suitable size*/
-    int8_t i_guess = -1;
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0 && LV_GC_ROOT(lv_mem_buf[i]).size >= size) {
-            if(LV_GC_ROOT(lv_mem_buf[i]).size == size) {
-                LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-                return LV_GC_ROOT(lv_mem_buf[i]).p;
-            }
-            else if(i_guess < 0) {
-                i_guess = i;
-            }
-            /*If size of `i` is closer to `size` prefer it*/
-            else if(LV_GC_ROOT(lv_mem_buf[i]).size < LV_GC_ROOT(lv_mem_buf[i_guess]).size) {
-                i_guess = i;
-            }
-        }
-    }
-
-    if(i_guess >= 0) {
-        LV_GC_ROOT(lv_mem_buf[i_guess]).used = 1;
-        MEM_TRACE("returning already allocated buffer (buffer id: %d, address: %p)", i_guess,
-                  LV_GC_ROOT(lv_mem_buf[i_guess]).p);
-        return LV_GC_ROOT(lv_mem_buf[i_guess]).p;
-    }
-
-    /*Reallocate a free buffer*/
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
-            /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
-            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
-            LV_ASSERT_MSG(buf != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
-            if(buf == NULL) return NULL;
-
-            LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-            LV_GC_ROOT(lv_mem_buf[i]).size = size;
-            LV_GC_ROOT(lv_mem_buf[i]).p    = buf;
-            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, LV_GC_ROOT(lv_mem_buf[i]).p);
-            return LV_GC_ROOT(lv_mem_buf[i]).p;
-        }
-    }
-
-    LV_LOG_ERROR("no more buffers. (increase LV_MEM_BUF_MAX_NUM)");
-    LV_ASSERT_MSG(false, "No more buffers. Increase LV_MEM_BUF_MAX_NUM.");
-    return NULL;
+    MEM_LOCK();
+    void * buf = mem_buf_get(size);
+    MEM_UNLOCK();
+    return buf;
 }
 
 /**
@@ -333,30 +314,49 @@ void lv_mem_buf_release(void * p)
 {
     MEM_TRACE("begin (address: %p)", p);
 
+    MEM_LOCK();
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
             LV_GC_ROOT(lv_mem_buf[i]).used = 0;
+            MEM_UNLOCK();
             return;
         }
     }
+    MEM_UNLOCK();
 
     LV_LOG_ERROR("p is not a known buffer");
 }
 
 /**
- * Free all memory buffers
+ * Free all memory buffers which are not used.
+ * The used ones are kept, e.g. a function running on the background decoding worker can still write them.
  */
 void lv_mem_buf_free_all(void)
 {
+    MEM_LOCK();
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p) {
+        if(LV_GC_ROOT(lv_mem_buf[i]).p && LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
             lv_mem_free(LV_GC_ROOT(lv_mem_buf[i]).p);
             LV_GC_ROOT(lv_mem_buf[i]).p = NULL;
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
             LV_GC_ROOT(lv_mem_buf[i]).size = 0;
         }
     }
+    MEM_UNLOCK();
+}
+
+#if LV_IMG_CACHE_ASYNC
+/**
+ * Set the functions to lock the memory management if it's used from an other thread too
+ * (by the background image decoding). The lock is taken recursively.
+ * @param lock      lock a recursive mutex
+ * @param unlock    unlock the mutex
+ */
+void _lv_mem_set_lock_cb(void (*lock)(void), void (*unlock)(void))
+{
+    lock_cb = lock;
+    unlock_cb = unlock;
 }
+#endif
 
 #if LV_MEMCPY_MEMSET_STD == 0
 /**
@@ -547,6 +547,62 @@ LV_ATTRIBUTE_FAST_MEM void lv_memset_ff(void * dst, size_t len)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get a temporal buffer with the given size.
+ * @param size the required size
+ */
+static void * mem_buf_get(uint32_t size)
+{
+    if(size == 0) return NULL;
+
+    MEM_TRACE("begin, getting %d bytes", size);
+
+    /*Try to find a free buffer with suitable size*/
+    int8_t i_guess = -1;
+    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
+        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0 && LV_GC_ROOT(lv_mem_buf[i]).size >= size) {
+            if(LV_GC_ROOT(lv_mem_buf[i]).size == size) {
+                LV_GC_ROOT(lv_mem_buf[i]).used = 1;
+                return LV_GC_ROOT(lv_mem_buf[i]).p;
+            }
+            else if(i_guess < 0) {
+                i_guess = i;
+            }
+            /*If size of `i` is closer to `size` prefer it*/
+            else if(LV_GC_ROOT(lv_mem_buf[i]).size < LV_GC_ROOT(lv_mem_buf[i_guess]).size) {
+                i_guess = i;
+            }
+        }
+    }
+
+    if(i_guess >= 0) {
+        LV_GC_ROOT(lv_mem_buf[i_guess]).used = 1;
+        MEM_TRACE("returning already allocated buffer (buffer id: %d, address: %p)", i_guess,
+                  LV_GC_ROOT(lv_mem_buf[i_guess]).p);
+        return LV_GC_ROOT(lv_mem_buf[i_guess]).p;
+    }
+
+    /*Reallocate a free buffer*/
+    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
+        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
+            /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
+            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
+            LV_ASSERT_MSG(buf != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
+            if(buf == NULL) return NULL;
+
+            LV_GC_ROOT(lv_mem_buf[i]).used = 1;
+            LV_GC_ROOT(lv_mem_buf[i]).size = size;
+            LV_GC_ROOT(lv_mem_buf[i]).p    = buf;
+            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, LV_GC_ROOT(lv_mem_buf[i]).p);
+            return LV_GC_ROOT(lv_mem_buf[i]).p;
+        }
+    }
+
+    LV_LOG_ERROR("no more buffers. (increase LV_MEM_BUF_MAX_NUM)");
+    LV_ASSERT_MSG(false, "No more buffers. Increase LV_MEM_BUF_MAX_NUM.");
+    return NULL;
+}
+
 #if LV_MEM_CUSTOM == 0
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
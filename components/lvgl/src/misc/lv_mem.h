@@ -115,10 +115,20 @@ void * lv_mem_buf_get(uint32_t size);
 void lv_mem_buf_release(void * p);
 
 /**
- * Free all memory buffers
+ * Free all memory buffers which are not used
  */
 void lv_mem_buf_free_all(void);
 
+#if LV_IMG_CACHE_ASYNC
+/**
+ * Set the functions to lock the memory management if it's used from an other thread too
+ * (by the background image decoding). The lock is taken recursively.
+ * @param lock      lock a recursive mutex
+ * @param unlock    unlock the mutex
+ */
+void _lv_mem_set_lock_cb(void (*lock)(void), void (*unlock)(void));
+#endif
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
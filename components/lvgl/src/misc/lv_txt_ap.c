@@ -37,6 +37,7 @@ typedef struct {
  **********************/
 #if LV_USE_ARABIC_PERSIAN_CHARS == 1
 static uint32_t lv_ap_get_char_index(uint16_t c);
+static bool lv_txt_has_ap_chars(const char * txt);
 static uint32_t lv_txt_lam_alef(uint32_t ch_curr, uint32_t ch_next);
 static bool lv_txt_is_arabic_vowel(uint16_t c);
 
@@ -114,6 +115,9 @@ uint32_t _lv_txt_ap_calc_bytes_cnt(const char * txt)
     uint32_t i, j;
     uint32_t ch_enc;
 
+    /*Most texts have no Arabic or Persian letters, so don't decode them*/
+    if(!lv_txt_has_ap_chars(txt)) return strlen(txt) + 1;
+
     txt_length = _lv_txt_get_encoded_length(txt);
 
     i = 0;
@@ -148,6 +152,11 @@ void _lv_txt_ap_proc(const char * txt, char * txt_out)
     uint32_t * ch_fin;
     char * txt_out_temp;
 
+    if(!lv_txt_has_ap_chars(txt)) {
+        lv_memcpy(txt_out, txt, strlen(txt) + 1);
+        return;
+    }
+
     txt_length = _lv_txt_get_encoded_length(txt);
 
     ch_enc = (uint32_t *)lv_mem_alloc(sizeof(uint32_t) * (txt_length + 1));
@@ -255,6 +264,9 @@ void _lv_txt_ap_proc(const char * txt, char * txt_out)
 
 static uint32_t lv_ap_get_char_index(uint16_t c)
 {
+    /*The letters are in the Arabic (U+06xx) and the Arabic Presentation Forms (U+FB50..U+FEFF) blocks*/
+    if(c < LV_AP_ALPHABET_BASE_CODE || (c > 0x06FF && c < 0xFB50)) return LV_UNDEF_ARABIC_PERSIAN_CHARS;
+
     for(uint8_t i = 0; ap_chars_map[i].char_end_form; i++) {
         if(c == (ap_chars_map[i].char_offset + LV_AP_ALPHABET_BASE_CODE))
             return i;
@@ -298,4 +310,20 @@ static bool lv_txt_is_arabic_vowel(uint16_t c)
     return (c >= 0x064B) && (c <= 0x0652);
 }
 
+/**
+ * Check if a text might contain letters to process
+ * @param txt       a UTF-8 text
+ * @return          false: there are no letters in the U+0600..U+06FF and U+F000..U+FFFF ranges
+ */
+static bool lv_txt_has_ap_chars(const char * txt)
+{
+    const uint8_t * p = (const uint8_t *)txt;
+    while(*p) {
+        /*Lead bytes of U+0600..U+06FF and U+F000..U+FFFF*/
+        if((*p >= 0xD8 && *p <= 0xDB) || *p == 0xEF) return true;
+        p++;
+    }
+    return false;
+}
+
 #endif
@@ -27,10 +27,25 @@
 #define LV_LABEL_SCROLL_DELAY       300
 #define LV_LABEL_DOT_END_INV 0xFFFFFFFF
 #define LV_LABEL_HINT_HEIGHT_LIMIT 1024 /*Enable "hint" to buffer info about labels larger than this. (Speed up drawing)*/
+#define LV_LABEL_FMT_BUF_SIZE 64 /*Texts of `lv_label_set_text_fmt()` shorter than this are printed to the stack*/
+
+#if LV_LABEL_TEXT_INLINE_SIZE
+#define TEXT_IS_INLINE(label) ((label)->text == (label)->text_inline)
+#else
+#define TEXT_IS_INLINE(label) false
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_LABEL_SCROLL_CACHE_SIZE
+/*The text of a scrolling label rendered to an A8 image*/
+typedef struct _lv_label_scroll_cache_t {
+    lv_img_dsc_t img;
+    lv_draw_label_dsc_t dsc;    /*The text was rendered with these parameters*/
+    lv_coord_t txt_w;           /*Width of the text area when the text was rendered*/
+} lv_label_scroll_cache_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -41,7 +56,24 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_main(lv_event_t * e);
 
 static void lv_label_refr_text(lv_obj_t * obj);
+static void lv_label_refr_text_no_inv(lv_obj_t * obj);
 static void lv_label_revert_dots(lv_obj_t * label);
+#if LV_LABEL_SCROLL_CACHE_SIZE
+static bool draw_scroll_cache(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                              const lv_area_t * txt_coords, const lv_area_t * txt_clip);
+static lv_label_scroll_cache_t * scroll_cache_update(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx,
+                                                     const lv_draw_label_dsc_t * dsc, lv_coord_t txt_w,
+                                                     lv_coord_t img_w, lv_coord_t img_h);
+static void scroll_cache_free(lv_obj_t * obj);
+#endif
+static void get_txt_size(lv_obj_t * obj, lv_point_t * size, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag);
+static bool get_txt_area(lv_obj_t * obj, lv_area_t * area);
+static bool lv_label_text_store(lv_obj_t * obj, const char * txt);
+static bool lv_label_text_reserve(lv_obj_t * obj, size_t size);
+static void lv_label_text_edited(lv_obj_t * obj, bool lines_ok, uint32_t pos, uint32_t del_len, uint32_t ins_len);
+static void lv_label_text_free(lv_obj_t * obj);
+static bool has_lines(lv_obj_t * obj);
 
 static bool lv_label_set_dot_tmp(lv_obj_t * label, char * data, uint32_t len);
 static char * lv_label_get_dot_tmp(lv_obj_t * label);
@@ -87,61 +119,77 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
 
-    lv_obj_invalidate(obj);
-
     /*If text is NULL then just refresh with the current text*/
     if(text == NULL) text = label->text;
 
     if(label->text == text && label->static_txt == 0) {
+        lv_obj_invalidate(obj);
+
+#if LV_LABEL_LONG_TXT_HINT
+        /*The text might have been modified directly*/
+        lv_draw_label_hint_clear_lines(&label->hint);
+#endif
+
         /*If set its own text then reallocate it (maybe its size changed)*/
 #if LV_USE_ARABIC_PERSIAN_CHARS
         /*Get the size of the text and process it*/
         size_t len = _lv_txt_ap_calc_bytes_cnt(text);
-
-        label->text = lv_mem_realloc(label->text, len);
-        LV_ASSERT_MALLOC(label->text);
-        if(label->text == NULL) return;
-
-        _lv_txt_ap_proc(label->text, label->text);
+        char * ap_txt = lv_mem_buf_get(len);
+        LV_ASSERT_MALLOC(ap_txt);
+        if(ap_txt == NULL) return;
+
+        _lv_txt_ap_proc(label->text, ap_txt);
+        bool res = lv_label_text_store(obj, ap_txt);
+        lv_mem_buf_release(ap_txt);
+        if(res == false) return;
 #else
-        label->text = lv_mem_realloc(label->text, strlen(label->text) + 1);
+        if(!TEXT_IS_INLINE(label)) {
+            label->text_size = strlen(label->text) + 1;
+            label->text = lv_mem_realloc(label->text, label->text_size);
+            LV_ASSERT_MALLOC(label->text);
+            if(label->text == NULL) return;
+        }
 #endif
 
-        LV_ASSERT_MALLOC(label->text);
-        if(label->text == NULL) return;
+        lv_label_refr_text(obj);
+        return;
     }
-    else {
-        /*Free the old text*/
-        if(label->text != NULL && label->static_txt == 0) {
-            lv_mem_free(label->text);
-            label->text = NULL;
-        }
 
 #if LV_USE_ARABIC_PERSIAN_CHARS
-        /*Get the size of the text and process it*/
-        size_t len = _lv_txt_ap_calc_bytes_cnt(text);
+    /*Process the text first to compare and store the final form*/
+    size_t len = _lv_txt_ap_calc_bytes_cnt(text);
+    char * ap_txt = lv_mem_buf_get(len);
+    LV_ASSERT_MALLOC(ap_txt);
+    if(ap_txt == NULL) return;
+
+    _lv_txt_ap_proc(text, ap_txt);
+    text = ap_txt;
+#endif
 
-        label->text = lv_mem_alloc(len);
-        LV_ASSERT_MALLOC(label->text);
-        if(label->text == NULL) return;
+    /*Nothing to do if the text hasn't changed. (In dot mode the stored text is modified so it can't be compared)*/
+    if(label->text == NULL || label->static_txt || label->dot_end != LV_LABEL_DOT_END_INV ||
+       strcmp(label->text, text) != 0) {
+        /*Only the area of the old and new text needs to be redrawn*/
+        lv_area_t old_area;
+        bool old_area_ok = get_txt_area(obj, &old_area);
 
-        _lv_txt_ap_proc(text, label->text);
-#else
-        /*Get the size of the text*/
-        size_t len = strlen(text) + 1;
-
-        /*Allocate space for the new text*/
-        label->text = lv_mem_alloc(len);
-        LV_ASSERT_MALLOC(label->text);
-        if(label->text == NULL) return;
-        strcpy(label->text, text);
-#endif
+        if(lv_label_text_store(obj, text)) {
+            lv_label_refr_text_no_inv(obj);
 
-        /*Now the text is dynamically allocated*/
-        label->static_txt = 0;
+            lv_area_t new_area;
+            if(old_area_ok && get_txt_area(obj, &new_area)) {
+                _lv_area_join(&new_area, &new_area, &old_area);
+                lv_obj_invalidate_area(obj, &new_area);
+            }
+            else {
+                lv_obj_invalidate(obj);
+            }
+        }
     }
 
-    lv_label_refr_text(obj);
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    lv_mem_buf_release(ap_txt);
+#endif
 }
 
 void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
@@ -149,27 +197,85 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(fmt);
 
-    lv_obj_invalidate(obj);
-    lv_label_t * label = (lv_label_t *)obj;
-
     /*If text is NULL then refresh*/
     if(fmt == NULL) {
+        lv_obj_invalidate(obj);
         lv_label_refr_text(obj);
         return;
     }
 
-    if(label->text != NULL && label->static_txt == 0) {
-        lv_mem_free(label->text);
-        label->text = NULL;
+    /*Short texts are printed to the stack and set as normal texts without allocating a temporary buffer*/
+    char buf[LV_LABEL_FMT_BUF_SIZE];
+    va_list args;
+    va_start(args, fmt);
+    int len = lv_vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if(len < 0) return;
+    if(len < (int)sizeof(buf)) {
+        lv_label_set_text(obj, buf);
+        return;
     }
 
-    va_list args;
+    /*The length is known now so print it again only once, directly to a buffer of the exact size.
+     *The old text is freed only after printing as it might be one of the arguments.*/
+    char * txt = lv_mem_alloc(len + 1);
+    LV_ASSERT_MALLOC(txt);
+    if(txt == NULL) return;
+
     va_start(args, fmt);
-    label->text = _lv_txt_set_text_vfmt(fmt, args);
+    lv_vsnprintf(txt, len + 1, fmt, args);
     va_end(args);
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    /*The letters are processed by `lv_label_set_text()`*/
+    lv_label_set_text(obj, txt);
+    lv_mem_free(txt);
+#else
+    lv_label_t * label = (lv_label_t *)obj;
+    lv_obj_invalidate(obj);
+    lv_label_text_free(obj);
+    label->text = txt;
     label->static_txt = 0; /*Now the text is dynamically allocated*/
+    label->text_size = len + 1;
 
     lv_label_refr_text(obj);
+#endif
+}
+
+void lv_label_set_text_int(lv_obj_t * obj, int32_t value)
+{
+    lv_label_set_text_fixed(obj, value, 0);
+}
+
+void lv_label_set_text_fixed(lv_obj_t * obj, int32_t value, uint8_t decimals)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    if(decimals > 9) decimals = 9;
+
+    /*Sign, 10 digits, decimal point, leading zero and the closing '\0'*/
+    char buf[16];
+    char * p = &buf[sizeof(buf) - 1];
+    *p = '\0';
+
+    uint32_t abs_value = value < 0 ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+    uint32_t digit_cnt = 0;
+    do {
+        p--;
+        *p = (char)('0' + abs_value % 10);
+        abs_value /= 10;
+        digit_cnt++;
+        if(digit_cnt == decimals) {
+            p--;
+            *p = '.';
+        }
+    } while(abs_value > 0 || digit_cnt <= decimals);
+
+    if(value < 0) {
+        p--;
+        *p = '-';
+    }
+
+    lv_label_set_text(obj, p);
 }
 
 void lv_label_set_text_static(lv_obj_t * obj, const char * text)
@@ -177,10 +283,7 @@ void lv_label_set_text_static(lv_obj_t * obj, const char * text)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_label_t * label = (lv_label_t *)obj;
 
-    if(label->static_txt == 0 && label->text != NULL) {
-        lv_mem_free(label->text);
-        label->text = NULL;
-    }
+    lv_label_text_free(obj);
 
     if(text != NULL) {
         label->static_txt = 1;
@@ -328,13 +431,25 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     uint32_t byte_id = _lv_txt_encoded_get_byte_id(txt, char_id);
 
     /*Search the line of the index letter*/;
-    while(txt[new_line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
-        if(byte_id < new_line_start || txt[new_line_start] == '\0')
-            break; /*The line of 'index' letter begins at 'line_start'*/
+#if LV_LABEL_LONG_TXT_HINT
+    const lv_draw_label_hint_t * hint = &label->hint;
+    if(lv_draw_label_hint_has_lines(hint, txt, font, letter_space, max_w, flag)) {
+        uint32_t line_id = lv_draw_label_hint_get_line(hint, byte_id);
+        line_start = hint->lines[line_id].start;
+        new_line_start = hint->lines[line_id + 1].start;
+        y = (lv_coord_t)line_id * (letter_height + line_space);
+    }
+    else
+#endif
+    {
+        while(txt[new_line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+            if(byte_id < new_line_start || txt[new_line_start] == '\0')
+                break; /*The line of 'index' letter begins at 'line_start'*/
 
-        y += letter_height + line_space;
-        line_start = new_line_start;
+            y += letter_height + line_space;
+            line_start = new_line_start;
+        }
     }
 
     /*If the last character is line break then go to the next line*/
@@ -357,6 +472,28 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
         visual_byte_pos = base_dir == LV_BASE_DIR_RTL ? 0 : byte_id - line_start;
         bidi_txt = &txt[line_start];
     }
+#if LV_LABEL_LONG_TXT_HINT
+    else if(lv_draw_label_hint_set_bidi(&label->hint, txt, font, letter_space, max_w, flag, base_dir)) {
+        /*Use the text in visual order stored when the label was drawn*/
+        bidi_txt = label->hint.bidi_txt ? &label->hint.bidi_txt[line_start] : &txt[line_start];
+        visual_byte_pos = byte_id - line_start;
+        if(label->hint.bidi_pos) {
+            const uint16_t * bidi_pos = &label->hint.bidi_pos[line_start];
+            uint32_t line_char_id = _lv_txt_encoded_get_char_id(&txt[line_start], byte_id - line_start);
+            uint32_t i = 0;
+            while(i < new_line_start - line_start) {
+                uint16_t p = bidi_pos[i];
+                _lv_txt_encoded_next(bidi_txt, &i);
+                if(_LV_BIDI_GET_POS(p) == line_char_id) {
+                    /*Place the cursor after RTL letters*/
+                    if(!_LV_BIDI_IS_RTL_POS(p)) _lv_txt_encoded_prev(bidi_txt, &i);
+                    break;
+                }
+            }
+            visual_byte_pos = i;
+        }
+    }
+#endif
     else {
         uint32_t line_char_id = _lv_txt_encoded_get_char_id(&txt[line_start], byte_id - line_start);
 
@@ -420,7 +557,7 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     lv_coord_t y             = 0;
     lv_text_flag_t flag       = LV_TEXT_FLAG_NONE;
     uint32_t logical_pos;
-    char * bidi_txt;
+    const char * bidi_txt;
 
     if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
@@ -429,30 +566,71 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, label->text);
 
     /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+#if LV_LABEL_LONG_TXT_HINT
+    const lv_draw_label_hint_t * hint = &label->hint;
+    lv_coord_t line_h = letter_height + line_space;
+    if(line_h > 0 && lv_draw_label_hint_has_lines(hint, txt, font, letter_space, max_w, flag)) {
+        uint32_t line_id = pos.y <= letter_height ? 0 : (pos.y - letter_height + line_h - 1) / line_h;
+        if(line_id < hint->line_cnt) {
+            line_start = hint->lines[line_id].start;
+            new_line_start = hint->lines[line_id + 1].start;
 
-        if(pos.y <= y + letter_height) {
-            /*The line is found (stored in 'line_start')*/
             /*Include the NULL terminator in the last line*/
             uint32_t tmp = new_line_start;
             uint32_t letter;
             letter = _lv_txt_encoded_prev(txt, &tmp);
             if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
-            break;
         }
-        y += letter_height + line_space;
+        else {
+            line_start = hint->lines[hint->line_cnt].start;
+            new_line_start = line_start;
+        }
+    }
+    else
+#endif
+    {
+        while(txt[line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+
+            if(pos.y <= y + letter_height) {
+                /*The line is found (stored in 'line_start')*/
+                /*Include the NULL terminator in the last line*/
+                uint32_t tmp = new_line_start;
+                uint32_t letter;
+                letter = _lv_txt_encoded_prev(txt, &tmp);
+                if(letter != '\n' && txt[new_line_start] == '\0') new_line_start++;
+                break;
+            }
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
 #if LV_USE_BIDI
-    bidi_txt = lv_mem_buf_get(new_line_start - line_start + 1);
     uint32_t txt_len = new_line_start - line_start;
     if(new_line_start > 0 && txt[new_line_start - 1] == '\0' && txt_len > 0) txt_len--;
-    _lv_bidi_process_paragraph(txt + line_start, bidi_txt, txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), NULL, 0);
+
+    char * bidi_buf = NULL;
+    const uint16_t * bidi_pos = NULL;
+    bool bidi_cached = false;
+#if LV_LABEL_LONG_TXT_HINT
+    /*Use the text in visual order stored when the label was drawn*/
+    lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
+    if(base_dir == LV_BASE_DIR_AUTO) base_dir = _lv_bidi_detect_base_dir(txt);
+    bidi_cached = lv_draw_label_hint_set_bidi(&label->hint, txt, font, letter_space, max_w, flag, base_dir);
+#endif
+    if(bidi_cached) {
+        bidi_txt = label->hint.bidi_txt ? &label->hint.bidi_txt[line_start] : &txt[line_start];
+        if(label->hint.bidi_pos) bidi_pos = &label->hint.bidi_pos[line_start];
+    }
+    else {
+        bidi_buf = lv_mem_buf_get(new_line_start - line_start + 1);
+        _lv_bidi_process_paragraph(txt + line_start, bidi_buf, txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), NULL, 0);
+        bidi_txt = bidi_buf;
+    }
 #else
-    bidi_txt = (char *)txt + line_start;
+    bidi_txt = txt + line_start;
 #endif
 
     /*Calculate the x coordinate*/
@@ -507,13 +685,20 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     if(txt[line_start + i] == '\0') {
         logical_pos = i;
     }
+    else if(bidi_pos) {
+        logical_pos = _LV_BIDI_GET_POS(bidi_pos[i]);
+        if(_LV_BIDI_IS_RTL_POS(bidi_pos[i])) logical_pos++;
+    }
+    else if(bidi_cached) {
+        logical_pos = cid;
+    }
     else {
         bool is_rtl;
         logical_pos = _lv_bidi_get_logical_pos(&txt[line_start], NULL,
                                                txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), cid, &is_rtl);
         if(is_rtl) logical_pos++;
     }
-    lv_mem_buf_release(bidi_txt);
+    if(bidi_buf) lv_mem_buf_release(bidi_buf);
 #else
     logical_pos = _lv_txt_encoded_get_char_id(bidi_txt, i);
 #endif
@@ -547,13 +732,31 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
     /*Search the line of the index letter*/;
-    while(txt[line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+#if LV_LABEL_LONG_TXT_HINT
+    const lv_draw_label_hint_t * hint = &label->hint;
+    lv_coord_t line_h = letter_height + line_space;
+    if(line_h > 0 && lv_draw_label_hint_has_lines(hint, txt, font, letter_space, max_w, flag)) {
+        uint32_t line_id = pos->y <= letter_height ? 0 : (pos->y - letter_height + line_h - 1) / line_h;
+        if(line_id < hint->line_cnt) {
+            line_start = hint->lines[line_id].start;
+            new_line_start = hint->lines[line_id + 1].start;
+        }
+        else {
+            line_start = hint->lines[hint->line_cnt].start;
+            new_line_start = line_start;
+        }
+    }
+    else
+#endif
+    {
+        while(txt[line_start] != '\0') {
+            new_line_start += _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
 
-        if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
-        y += letter_height + line_space;
+            if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
+            y += letter_height + line_space;
 
-        line_start = new_line_start;
+            line_start = new_line_start;
+        }
     }
 
     /*Calculate the x coordinate*/
@@ -647,20 +850,20 @@ void lv_label_ins_text(lv_obj_t * obj, uint32_t pos, const char * txt)
 
     lv_obj_invalidate(obj);
 
-    /*Allocate space for the new text*/
     size_t old_len = strlen(label->text);
     size_t ins_len = strlen(txt);
-    size_t new_len = ins_len + old_len;
-    label->text        = lv_mem_realloc(label->text, new_len + 1);
-    LV_ASSERT_MALLOC(label->text);
-    if(label->text == NULL) return;
 
-    if(pos == LV_LABEL_POS_LAST) {
-        pos = _lv_txt_get_encoded_length(label->text);
-    }
+    /*Convert to byte index. Appending is common so don't go through the text for it.*/
+    uint32_t byte_pos = pos == LV_LABEL_POS_LAST ? old_len : _lv_txt_encoded_get_byte_id(label->text, pos);
+    bool lines_ok = has_lines(obj);
+
+    /*Allocate space for the new text*/
+    if(lv_label_text_reserve(obj, old_len + ins_len + 1) == false) return;
 
-    _lv_txt_ins(label->text, pos, txt);
-    lv_label_set_text(obj, NULL);
+    memmove(&label->text[byte_pos + ins_len], &label->text[byte_pos], old_len - byte_pos + 1);
+    lv_memcpy(&label->text[byte_pos], txt, ins_len);
+
+    lv_label_text_edited(obj, lines_ok, byte_pos, 0, ins_len);
 }
 
 void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
@@ -673,12 +876,16 @@ void lv_label_cut_text(lv_obj_t * obj, uint32_t pos, uint32_t cnt)
 
     lv_obj_invalidate(obj);
 
-    char * label_txt = lv_label_get_text(obj);
     /*Delete the characters*/
-    _lv_txt_cut(label_txt, pos, cnt);
+    char * label_txt = label->text;
+    size_t old_len = strlen(label_txt);
+    uint32_t byte_pos = _lv_txt_encoded_get_byte_id(label_txt, pos);
+    uint32_t del_len = _lv_txt_encoded_get_byte_id(&label_txt[byte_pos], cnt);
+    bool lines_ok = has_lines(obj);
 
-    /*Refresh the label*/
-    lv_label_refr_text(obj);
+    memmove(&label_txt[byte_pos], &label_txt[byte_pos + del_len], old_len - byte_pos - del_len + 1);
+
+    lv_label_text_edited(obj, lines_ok, byte_pos, del_len, 0);
 }
 
 /**********************
@@ -693,6 +900,7 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
 
     label->text       = NULL;
+    label->text_size  = 0;
     label->static_txt = 0;
     label->recolor    = 0;
     label->dot_end    = LV_LABEL_DOT_END_INV;
@@ -727,8 +935,15 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_t * label = (lv_label_t *)obj;
 
     lv_label_dot_tmp_free(obj);
-    if(!label->static_txt) lv_mem_free(label->text);
-    label->text = NULL;
+    lv_label_text_free(obj);
+
+#if LV_LABEL_LONG_TXT_HINT
+    lv_draw_label_hint_clear_lines(&label->hint);
+#endif
+
+#if LV_LABEL_SCROLL_CACHE_SIZE
+    scroll_cache_free(obj);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -772,11 +987,16 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
         if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
         if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
 
-        lv_coord_t w = lv_obj_get_content_width(obj);
-        if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
-        else w = lv_obj_get_content_width(obj);
+        lv_coord_t w;
+        if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) {
+            w = LV_COORD_MAX;
+            flag |= LV_TEXT_FLAG_FIT;
+        }
+        else {
+            w = lv_obj_get_content_width(obj);
+        }
 
-        lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+        get_txt_size(obj, &size, font, letter_space, line_space, w, flag);
 
         lv_point_t * self_size = lv_event_get_param(e);
         self_size->x = LV_MAX(self_size->x, size.x);
@@ -824,16 +1044,20 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_txt_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                     LV_COORD_MAX, flag);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
     }
 #if LV_LABEL_LONG_TXT_HINT
+    /*With a line table always pass the hint, else use it only for tall texts.
+     *With bidi pass it for short texts too as it also stores the text in visual order.*/
     lv_draw_label_hint_t * hint = &label->hint;
-    if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR || lv_area_get_height(&txt_coords) < LV_LABEL_HINT_HEIGHT_LIMIT)
+    if(hint->lines == NULL && (label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR ||
+                               (!LV_USE_BIDI && lv_area_get_height(&txt_coords) < LV_LABEL_HINT_HEIGHT_LIMIT))) {
         hint = NULL;
+    }
 
 #else
     /*Just for compatibility*/
@@ -844,6 +1068,10 @@ static void draw_main(lv_event_t * e)
     bool is_common = _lv_area_intersect(&txt_clip, &txt_coords, draw_ctx->clip_area);
     if(!is_common) return;
 
+#if LV_LABEL_SCROLL_CACHE_SIZE
+    if(draw_scroll_cache(obj, draw_ctx, &label_draw_dsc, &txt_coords, &txt_clip)) return;
+#endif
+
     if(label->long_mode == LV_LABEL_LONG_WRAP) {
         lv_coord_t s = lv_obj_get_scroll_top(obj);
         lv_area_move(&txt_coords, 0, -s);
@@ -864,8 +1092,8 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_txt_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                        LV_COORD_MAX, flag);
+        get_txt_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                     LV_COORD_MAX, flag);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -893,13 +1121,19 @@ static void draw_main(lv_event_t * e)
  * @param label pointer to a label object
  */
 static void lv_label_refr_text(lv_obj_t * obj)
+{
+    lv_label_refr_text_no_inv(obj);
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * Refresh the label with its text without invalidating it
+ * @param label pointer to a label object
+ */
+static void lv_label_refr_text_no_inv(lv_obj_t * obj)
 {
     lv_label_t * label = (lv_label_t *)obj;
     if(label->text == NULL) return;
-#if LV_LABEL_LONG_TXT_HINT
-    label->hint.line_start = -1; /*The hint is invalid if the text changes*/
-#endif
-
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
     lv_coord_t max_w         = lv_area_get_width(&txt_coords);
@@ -914,7 +1148,20 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+#if LV_LABEL_SCROLL_CACHE_SIZE
+    scroll_cache_free(obj);
+#endif
+
+#if LV_LABEL_LONG_TXT_HINT
+    /*Split the text to lines once here and draw from the line table.
+     *The line table is freed when the text changes, and updated when text is inserted or deleted.*/
+    if(!lv_draw_label_hint_has_lines(&label->hint, label->text, font, letter_space, max_w, flag)) {
+        label->hint.line_start = -1;
+        lv_draw_label_hint_set_lines(&label->hint, label->text, font, letter_space, max_w, flag);
+    }
+#endif
+
+    get_txt_size(obj, &size, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1158,14 +1405,16 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+
+#if LV_LABEL_LONG_TXT_HINT
+                lv_draw_label_hint_set_lines(&label->hint, label->text, font, letter_space, max_w, flag);
+#endif
             }
         }
     }
     else if(label->long_mode == LV_LABEL_LONG_CLIP) {
         /*Do nothing*/
     }
-
-    lv_obj_invalidate(obj);
 }
 
 
@@ -1190,6 +1439,418 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+
+#if LV_LABEL_LONG_TXT_HINT
+    /*The lines were calculated with the dots*/
+    lv_draw_label_hint_clear_lines(&label->hint);
+#endif
+}
+
+#if LV_LABEL_SCROLL_CACHE_SIZE
+/**
+ * Draw the text of a scrolling label from an image the text is rendered to once.
+ * The image is (re)rendered if the drawing parameters have changed.
+ * @param obj pointer to a label object
+ * @param draw_ctx pointer to a draw context
+ * @param dsc the label's draw descriptor
+ * @param txt_coords the text area of the label
+ * @param txt_clip the visible part of `txt_coords`
+ * @return true: the text is drawn; false: the text needs to be drawn normally
+ */
+static bool draw_scroll_cache(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                              const lv_area_t * txt_coords, const lv_area_t * txt_clip)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    if(label->long_mode != LV_LABEL_LONG_SCROLL && label->long_mode != LV_LABEL_LONG_SCROLL_CIRCULAR) return false;
+
+    /*Only single colored texts without decoration can be rendered to an A8 image*/
+    if(dsc->flag & LV_TEXT_FLAG_RECOLOR) return false;
+    if(dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL && dsc->sel_end != LV_DRAW_LABEL_NO_TXT_SEL) return false;
+    if(dsc->decor != LV_TEXT_DECOR_NONE) return false;
+    if(dsc->font->subpx != LV_FONT_SUBPX_NONE) return false;
+
+    /*The draw unit can't render the text to an A8 image*/
+    if(draw_ctx->letter_run_to_a8 == NULL) return false;
+
+#if LV_DRAW_COMPLEX
+    /*A8 images are blended directly only without masks*/
+    if(lv_draw_mask_is_any(txt_clip)) return false;
+#endif
+
+    lv_point_t size;
+    get_txt_size(obj, &size, dsc->font, dsc->letter_space, dsc->line_space, LV_COORD_MAX, dsc->flag);
+
+    /*Not scrolled so there is nothing to gain*/
+    lv_coord_t txt_w = lv_area_get_width(txt_coords);
+    lv_coord_t txt_h = lv_area_get_height(txt_coords);
+    if(size.x <= txt_w && size.y <= txt_h) return false;
+
+    lv_coord_t img_w = LV_MAX(size.x, txt_w);
+    lv_coord_t img_h = LV_MAX(size.y, txt_h);
+    if((uint32_t)img_w * img_h > LV_LABEL_SCROLL_CACHE_SIZE) {
+        scroll_cache_free(obj);
+        return false;
+    }
+
+    lv_label_scroll_cache_t * cache = label->scroll_cache;
+    if(cache == NULL || cache->img.header.w != img_w || cache->img.header.h != img_h || cache->txt_w != txt_w ||
+       cache->dsc.font != dsc->font || cache->dsc.opa != dsc->opa || cache->dsc.flag != dsc->flag ||
+       cache->dsc.letter_space != dsc->letter_space || cache->dsc.line_space != dsc->line_space ||
+       cache->dsc.align != dsc->align || cache->dsc.bidi_dir != dsc->bidi_dir) {
+        cache = scroll_cache_update(obj, draw_ctx, dsc, txt_w, img_w, img_h);
+        if(cache == NULL) return false;
+    }
+
+    /*The image has only opacity, the color comes from `recolor`*/
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    img_dsc.recolor = dsc->color;
+    img_dsc.opa = dsc->opa;
+    img_dsc.blend_mode = dsc->blend_mode;
+
+    lv_area_t img_area;
+    img_area.x1 = txt_coords->x1 + label->offset.x;
+    img_area.y1 = txt_coords->y1 + label->offset.y;
+    img_area.x2 = img_area.x1 + img_w - 1;
+    img_area.y2 = img_area.y1 + img_h - 1;
+
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    draw_ctx->clip_area = txt_clip;
+    lv_draw_img(draw_ctx, &img_dsc, &img_area, &cache->img);
+
+    if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
+        /*Draw the text again on label to the original to make a circular effect */
+        if(size.x > txt_w) {
+            lv_area_t img_area2 = img_area;
+            lv_area_move(&img_area2, size.x + lv_font_get_glyph_width(dsc->font, ' ', ' ') * LV_LABEL_WAIT_CHAR_COUNT, 0);
+            lv_draw_img(draw_ctx, &img_dsc, &img_area2, &cache->img);
+        }
+
+        /*Draw the text again below the original to make a circular effect */
+        if(size.y > txt_h) {
+            lv_area_t img_area2 = img_area;
+            lv_area_move(&img_area2, 0, size.y + lv_font_get_line_height(dsc->font));
+            lv_draw_img(draw_ctx, &img_dsc, &img_area2, &cache->img);
+        }
+    }
+
+    draw_ctx->clip_area = clip_area_ori;
+
+    return true;
+}
+
+/**
+ * Render the text of a label to an A8 image
+ * @param obj pointer to a label object
+ * @param draw_ctx pointer to the draw context which renders the letters
+ * @param dsc the label's draw descriptor
+ * @param txt_w width of the text area of the label
+ * @param img_w width of the image
+ * @param img_h height of the image
+ * @return the new cache or NULL if it couldn't be allocated
+ */
+static lv_label_scroll_cache_t * scroll_cache_update(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx,
+                                                     const lv_draw_label_dsc_t * dsc, lv_coord_t txt_w,
+                                                     lv_coord_t img_w, lv_coord_t img_h)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    scroll_cache_free(obj);
+
+    uint32_t buf_size = (uint32_t)img_w * img_h;
+    lv_label_scroll_cache_t * cache = lv_mem_alloc(sizeof(lv_label_scroll_cache_t) + buf_size);
+    if(cache == NULL) {
+        LV_LOG_WARN("couldn't allocate the scroll cache");
+        return NULL;
+    }
+
+    lv_opa_t * buf = (lv_opa_t *)(cache + 1);
+    lv_memset_00(buf, buf_size);
+
+    lv_memset_00(&cache->img, sizeof(cache->img));
+    cache->img.header.cf = LV_IMG_CF_ALPHA_8BIT;
+    cache->img.header.w = img_w;
+    cache->img.header.h = img_h;
+    cache->img.data_size = buf_size;
+    cache->img.data = buf;
+    cache->dsc = *dsc;
+    cache->txt_w = txt_w;
+
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, 0, 0, img_w - 1, img_h - 1);
+
+    /*Align the lines in the text area as they are drawn normally*/
+    lv_draw_label_dsc_t a8_dsc = *dsc;
+    a8_dsc.ofs_x = 0;
+    a8_dsc.ofs_y = 0;
+    lv_area_t txt_coords;
+    lv_area_set(&txt_coords, 0, 0, txt_w - 1, img_h - 1);
+
+#if LV_LABEL_LONG_TXT_HINT
+    lv_draw_label_hint_t * hint = &label->hint;
+#else
+    lv_draw_label_hint_t * hint = NULL;
+#endif
+    if(lv_draw_label_to_a8(draw_ctx, &a8_dsc, &txt_coords, label->text, hint, buf, &buf_area) != LV_RES_OK) {
+        lv_mem_free(cache);
+        return NULL;
+    }
+
+    label->scroll_cache = cache;
+    return cache;
+}
+
+/**
+ * Free the scroll cache of a label
+ * @param obj pointer to a label object
+ */
+static void scroll_cache_free(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->scroll_cache == NULL) return;
+
+    lv_img_cache_invalidate_src(&label->scroll_cache->img);
+    lv_mem_free(label->scroll_cache);
+    label->scroll_cache = NULL;
+}
+#endif
+
+/**
+ * Get the size of the label's text. Use the line table if it was made with the same parameters.
+ * @param obj pointer to a label object
+ * @param size store the size here
+ * @param font font of the text
+ * @param letter_space letter space of the text
+ * @param line_space line space of the text
+ * @param max_w max width of the lines
+ * @param flag the text flags
+ */
+static void get_txt_size(lv_obj_t * obj, lv_point_t * size, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+#if LV_LABEL_LONG_TXT_HINT
+    const lv_draw_label_hint_t * hint = &label->hint;
+    if(lv_draw_label_hint_has_lines(hint, label->text, font, letter_space, max_w, flag)) {
+        /*The same as `lv_txt_get_size()` does*/
+        lv_coord_t letter_height = lv_font_get_line_height(font);
+        uint32_t line_cnt = hint->line_cnt;
+        uint32_t txt_end = hint->lines[line_cnt].start;
+        if(label->text[txt_end - 1] == '\n' || label->text[txt_end - 1] == '\r') line_cnt++;
+
+        int64_t h = (int64_t)line_cnt * (letter_height + line_space);
+        if(h <= (int64_t)LV_MAX_OF(lv_coord_t)) {
+            size->x = hint->lines_w;
+            size->y = h == 0 ? letter_height : h - line_space;
+            return;
+        }
+    }
+#endif
+
+    lv_txt_get_size(size, label->text, font, letter_space, line_space, max_w, flag);
+}
+
+/**
+ * Get the area where the text is drawn.
+ * @param obj       pointer to a label object
+ * @param area      store the area here
+ * @return          false if the text area can't be calculated simply (e.g. scrolled or dotted text)
+ */
+static bool get_txt_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    if(label->text == NULL) return false;
+    if(label->long_mode != LV_LABEL_LONG_WRAP && label->long_mode != LV_LABEL_LONG_CLIP) return false;
+
+    lv_obj_get_content_coords(obj, area);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+
+    lv_text_flag_t flag = LV_TEXT_FLAG_NONE;
+    if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
+    if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
+    if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
+
+    lv_point_t size;
+    get_txt_size(obj, &size, font, letter_space, line_space, lv_area_get_width(area), flag);
+
+    /*The lines are aligned one by one so the longest line determines the horizontal extent*/
+    lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, label->text);
+    if(align == LV_TEXT_ALIGN_CENTER) area->x1 += (lv_area_get_width(area) - size.x) / 2;
+    else if(align == LV_TEXT_ALIGN_RIGHT) area->x1 = area->x2 - size.x + 1;
+    area->x2 = area->x1 + size.x - 1;
+    area->y2 = area->y1 + size.y - 1;
+
+    if(label->long_mode == LV_LABEL_LONG_WRAP) {
+        lv_area_move(area, 0, -lv_obj_get_scroll_top(obj));
+    }
+
+    /*The glyphs might be a little out of their box (e.g. italic letters)*/
+    lv_coord_t ext = lv_font_get_line_height(font) / 2;
+    lv_area_increase(area, ext, ext);
+
+    return true;
+}
+
+/**
+ * Copy a text to the label. Short texts are stored in the label, long texts reuse the allocated buffer if possible.
+ * @param obj       pointer to a label object
+ * @param txt       the text to copy. Can be the current text of the label or part of it.
+ * @return          false if the memory couldn't be allocated
+ */
+static bool lv_label_text_store(lv_obj_t * obj, const char * txt)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    size_t len = strlen(txt) + 1;
+    char * old_txt = label->static_txt == 0 && !TEXT_IS_INLINE(label) ? label->text : NULL;
+    char * new_txt = NULL;
+
+#if LV_LABEL_TEXT_INLINE_SIZE
+    if(len <= LV_LABEL_TEXT_INLINE_SIZE) new_txt = label->text_inline;
+#endif
+
+    if(new_txt == NULL) {
+        /*Reallocate the old text unless the new text is in it*/
+        if(old_txt && (txt < old_txt || txt >= old_txt + label->text_size)) {
+            new_txt = lv_mem_realloc(old_txt, len);
+            old_txt = NULL;
+        }
+        else {
+            new_txt = lv_mem_alloc(len);
+        }
+        LV_ASSERT_MALLOC(new_txt);
+        if(new_txt == NULL) return false;
+    }
+
+    memmove(new_txt, txt, len);
+    if(old_txt) lv_mem_free(old_txt);
+
+    label->text = new_txt;
+    label->text_size = TEXT_IS_INLINE(label) ? LV_LABEL_TEXT_INLINE_SIZE : len;
+    label->static_txt = 0;
+
+#if LV_LABEL_LONG_TXT_HINT
+    lv_draw_label_hint_clear_lines(&label->hint);
+#endif
+
+    return true;
+}
+
+/**
+ * Make sure the text buffer of the label can store `size` bytes. The text is kept.
+ * Some extra space is allocated to insert text later without reallocation.
+ * @param obj       pointer to a label object with dynamic text
+ * @param size      the required size in bytes
+ * @return          false if the memory couldn't be allocated
+ */
+static bool lv_label_text_reserve(lv_obj_t * obj, size_t size)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    if(size <= label->text_size) return true;
+
+    size += size / 4;
+    char * new_txt;
+    if(TEXT_IS_INLINE(label)) {
+        new_txt = lv_mem_alloc(size);
+        LV_ASSERT_MALLOC(new_txt);
+        if(new_txt == NULL) return false;
+        lv_memcpy(new_txt, label->text, label->text_size);
+    }
+    else {
+        new_txt = lv_mem_realloc(label->text, size);
+        LV_ASSERT_MALLOC(new_txt);
+        if(new_txt == NULL) return false;
+    }
+
+    label->text = new_txt;
+    label->text_size = size;
+    return true;
+}
+
+/**
+ * Refresh the label after some text was inserted or deleted
+ * @param obj       pointer to a label object
+ * @param lines_ok  true: the line table was valid before the edit, so it can be updated
+ * @param pos       byte index of the edit
+ * @param del_len   number of deleted bytes
+ * @param ins_len   number of inserted bytes
+ */
+static void lv_label_text_edited(lv_obj_t * obj, bool lines_ok, uint32_t pos, uint32_t del_len, uint32_t ins_len)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+#if LV_USE_ARABIC_PERSIAN_CHARS
+    /*The form of the Arabic letters depends on their neighbors. Nothing changes if only ASCII characters
+     *are inserted between ASCII characters, else process the whole text again.*/
+    bool ascii = (pos == 0 || (uint8_t)label->text[pos - 1] < 0x80) && (uint8_t)label->text[pos + ins_len] < 0x80;
+    uint32_t i;
+    for(i = pos; ascii && i < pos + ins_len; i++) {
+        if((uint8_t)label->text[i] >= 0x80) ascii = false;
+    }
+
+    if(!ascii) {
+        lv_label_set_text(obj, NULL);
+        return;
+    }
+#endif
+
+#if LV_LABEL_LONG_TXT_HINT
+    if(lines_ok) lv_draw_label_hint_update_lines(&label->hint, label->text, pos, del_len, ins_len);
+    else lv_draw_label_hint_clear_lines(&label->hint);
+#else
+    LV_UNUSED(label);
+    LV_UNUSED(lines_ok);
+    LV_UNUSED(pos);
+    LV_UNUSED(del_len);
+    LV_UNUSED(ins_len);
+#endif
+
+    lv_label_refr_text(obj);
+}
+
+/**
+ * Check if the line table of the label was made for its current text and style
+ * @param obj       pointer to a label object
+ * @return          true: the line table can be used
+ */
+static bool has_lines(lv_obj_t * obj)
+{
+#if LV_LABEL_LONG_TXT_HINT
+    lv_label_t * label = (lv_label_t *)obj;
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    lv_text_flag_t flag = LV_TEXT_FLAG_NONE;
+    if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
+    if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
+    if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
+
+    return lv_draw_label_hint_has_lines(&label->hint, label->text, font, letter_space, lv_obj_get_content_width(obj), flag);
+#else
+    LV_UNUSED(obj);
+    return false;
+#endif
+}
+
+/**
+ * Free the text of the label if it was allocated
+ * @param obj       pointer to a label object
+ */
+static void lv_label_text_free(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    if(label->static_txt == 0 && !TEXT_IS_INLINE(label)) lv_mem_free(label->text);
+    label->text = NULL;
+    label->text_size = 0;
+
+#if LV_LABEL_LONG_TXT_HINT
+    lv_draw_label_hint_clear_lines(&label->hint);
+#endif
 }
 
 /**
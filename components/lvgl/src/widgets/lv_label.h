@@ -53,12 +53,17 @@ typedef uint8_t lv_label_long_mode_t;
 typedef struct {
     lv_obj_t obj;
     char * text;
+    uint32_t text_size; /*Size of the buffer of a dynamic text. Can be larger than the text to insert quickly*/
     union {
         char * tmp_ptr; /*Pointer to the allocated memory containing the character replaced by dots*/
         char tmp[LV_LABEL_DOT_NUM + 1]; /*Directly store the characters if <=4 characters*/
     } dot;
     uint32_t dot_end;  /*The real text length, used in dot mode*/
 
+#if LV_LABEL_TEXT_INLINE_SIZE
+    char text_inline[LV_LABEL_TEXT_INLINE_SIZE]; /*Short texts are stored here without allocation*/
+#endif
+
 #if LV_LABEL_LONG_TXT_HINT
     lv_draw_label_hint_t hint;
 #endif
@@ -68,6 +73,10 @@ typedef struct {
     uint32_t sel_end;
 #endif
 
+#if LV_LABEL_SCROLL_CACHE_SIZE
+    struct _lv_label_scroll_cache_t * scroll_cache; /*The text rendered once in scroll modes*/
+#endif
+
     lv_point_t offset; /*Text draw position offset*/
     lv_label_long_mode_t long_mode : 3; /*Determine what to do with the long texts*/
     uint8_t static_txt : 1;             /*Flag to indicate the text is static*/
@@ -95,6 +104,7 @@ lv_obj_t * lv_label_create(lv_obj_t * parent);
 
 /**
  * Set a new text for a label. Memory will be allocated to store the text by the label.
+ * Nothing happens if the new text is the same as the current one.
  * @param obj           pointer to a label object
  * @param text          '\0' terminated character string. NULL to refresh with the current text.
  */
@@ -108,6 +118,22 @@ void lv_label_set_text(lv_obj_t * obj, const char * text);
  */
 void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...) LV_FORMAT_ATTRIBUTE(2, 3);
 
+/**
+ * Set an integer number as the text of a label. It's much faster than `lv_label_set_text_fmt(obj, "%d", value)`.
+ * @param obj           pointer to a label object
+ * @param value         the number to show
+ */
+void lv_label_set_text_int(lv_obj_t * obj, int32_t value);
+
+/**
+ * Set a fixed-point number as the text of a label.
+ * @param obj           pointer to a label object
+ * @param value         the number multiplied by 10^decimals
+ * @param decimals      number of digits after the decimal point (max. 9)
+ * @example lv_label_set_text_fixed(label1, 1234, 2); //"12.34"
+ */
+void lv_label_set_text_fixed(lv_obj_t * obj, int32_t value, uint8_t decimals);
+
 /**
  * Set a static text. It will not be saved by the label so the 'text' variable
  * has to be 'alive' while the label exists.
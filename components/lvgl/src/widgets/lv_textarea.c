@@ -59,6 +59,7 @@ static lv_res_t insert_handler(lv_obj_t * obj, const char * txt);
 static void draw_placeholder(lv_event_t * e);
 static void draw_cursor(lv_event_t * e);
 static void auto_hide_characters(lv_obj_t * obj);
+static uint32_t cut_to_retention_limit(lv_obj_t * obj);
 static inline bool is_valid_but_non_printable_char(const uint32_t letter);
 
 /**********************
@@ -208,6 +209,43 @@ void lv_textarea_add_text(lv_obj_t * obj, const char * txt)
     lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+void lv_textarea_append_text(lv_obj_t * obj, const char * txt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(txt);
+
+    lv_textarea_t * ta = (lv_textarea_t *)obj;
+
+    const char * txt_act = lv_label_get_text(ta->label);
+    size_t old_len = strlen(txt_act);
+    bool cursor_at_end = ta->cursor.txt_byte_pos >= old_len;
+
+    /*If the textarea is empty, invalidate it to hide the placeholder*/
+    if(ta->placeholder_txt && old_len == 0) lv_obj_invalidate(obj);
+
+    /*Handle the password mode and the accepted characters as usual*/
+    if(ta->pwd_mode || lv_textarea_get_accepted_chars(obj) || lv_textarea_get_max_length(obj)) {
+        uint32_t cursor_pos = ta->cursor.pos;
+        lv_textarea_set_cursor_pos(obj, LV_TEXTAREA_CURSOR_LAST);
+        lv_textarea_add_text(obj, txt);
+        if(!cursor_at_end) lv_textarea_set_cursor_pos(obj, cursor_pos);
+    }
+    else {
+        lv_label_ins_text(ta->label, LV_LABEL_POS_LAST, txt);
+        lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    }
+
+    uint32_t cut_cnt = cut_to_retention_limit(obj);
+
+    if(cursor_at_end) {
+        lv_textarea_set_cursor_pos(obj, LV_TEXTAREA_CURSOR_LAST);
+    }
+    else if(cut_cnt > 0) {
+        lv_textarea_clear_selection(obj);
+        lv_textarea_set_cursor_pos(obj, ta->cursor.pos > cut_cnt ? ta->cursor.pos - cut_cnt : 0);
+    }
+}
+
 void lv_textarea_del_char(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -222,13 +260,8 @@ void lv_textarea_del_char(lv_obj_t * obj)
     lv_res_t res = insert_handler(obj, del_buf);
     if(res != LV_RES_OK) return;
 
-    char * label_txt = lv_label_get_text(ta->label);
-
     /*Delete a character*/
-    _lv_txt_cut(label_txt, ta->cursor.pos - 1, 1);
-
-    /*Refresh the label*/
-    lv_label_set_text(ta->label, label_txt);
+    lv_label_cut_text(ta->label, ta->cursor.pos - 1, 1);
     lv_textarea_clear_selection(obj);
 
     /*If the textarea became empty, invalidate it to hide the placeholder*/
@@ -507,6 +540,15 @@ void lv_textarea_set_max_length(lv_obj_t * obj, uint32_t num)
     ta->max_length = num;
 }
 
+void lv_textarea_set_retention_limit(lv_obj_t * obj, uint32_t size)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_textarea_t * ta = (lv_textarea_t *)obj;
+
+    ta->retention_limit = size;
+}
+
 void lv_textarea_set_insert_replace(lv_obj_t * obj, const char * txt)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -662,6 +704,14 @@ uint32_t lv_textarea_get_max_length(lv_obj_t * obj)
     return ta->max_length;
 }
 
+uint32_t lv_textarea_get_retention_limit(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_textarea_t * ta = (lv_textarea_t *)obj;
+    return ta->retention_limit;
+}
+
 bool lv_textarea_text_is_selected(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -815,6 +865,7 @@ static void lv_textarea_constructor(const lv_obj_class_t * class_p, lv_obj_t * o
     ta->pwd_show_time     = LV_TEXTAREA_DEF_PWD_SHOW_TIME;
     ta->accepted_chars    = NULL;
     ta->max_length        = 0;
+    ta->retention_limit   = 0;
     ta->cursor.show      = 1;
     /*It will be set to zero later (with zero value lv_textarea_set_cursor_pos(obj, 0); wouldn't do anything as there is no difference)*/
     ta->cursor.pos        = 1;
@@ -1338,6 +1389,35 @@ static void draw_cursor(lv_event_t * e)
     }
 }
 
+/**
+ * Remove the oldest lines from the beginning of the text if it's longer than the retention limit
+ * @param obj       pointer to a text area
+ * @return          the number of removed characters
+ */
+static uint32_t cut_to_retention_limit(lv_obj_t * obj)
+{
+    lv_textarea_t * ta = (lv_textarea_t *)obj;
+    if(ta->retention_limit == 0) return 0;
+
+    const char * txt = lv_label_get_text(ta->label);
+    size_t len = strlen(txt);
+    if(len <= ta->retention_limit) return 0;
+
+    /*Remove whole lines if possible, else exactly as many bytes as required*/
+    size_t cut_bytes = len - ta->retention_limit;
+    const char * nl = strchr(txt + cut_bytes - 1, '\n');
+    if(nl) {
+        cut_bytes = (size_t)(nl - txt) + 1;
+    }
+    else {
+        while(cut_bytes < len && (txt[cut_bytes] & 0xC0) == 0x80) cut_bytes++;
+    }
+
+    uint32_t cut_cnt = _lv_txt_encoded_get_char_id(txt, (uint32_t)cut_bytes);
+    lv_label_cut_text(ta->label, 0, cut_cnt);
+    return cut_cnt;
+}
+
 static void auto_hide_characters(lv_obj_t * obj)
 {
     lv_textarea_t * ta = (lv_textarea_t *) obj;
@@ -45,6 +45,7 @@ typedef struct {
     char * pwd_bullet;           /*Replacement characters displayed in password mode*/
     const char * accepted_chars; /*Only these characters will be accepted. NULL: accept all*/
     uint32_t max_length;         /*The max. number of characters. 0: no limit*/
+    uint32_t retention_limit;    /*Max. size of the text in bytes kept by `lv_textarea_append_text()`. 0: no limit*/
     uint16_t pwd_show_time;      /*Time to show characters in password mode before change them to '*'*/
     struct {
         lv_coord_t valid_x;        /*Used when stepping up/down to a shorter line.
@@ -102,6 +103,16 @@ void lv_textarea_add_char(lv_obj_t * obj, uint32_t c);
  */
 void lv_textarea_add_text(lv_obj_t * obj, const char * txt);
 
+/**
+ * Append a text to the end of the text area without inserting it at the cursor.
+ * If the cursor was at the end it stays at the end, else it stays on the same character.
+ * If the text gets longer than the retention limit, the first lines are removed.
+ * Useful for logs and consoles.
+ * @param obj       pointer to a text area object
+ * @param txt       a '\0' terminated string to append
+ */
+void lv_textarea_append_text(lv_obj_t * obj, const char * txt);
+
 /**
  * Delete a the left character from the current cursor position
  * @param obj       pointer to a text area object
@@ -183,6 +194,14 @@ void lv_textarea_set_accepted_chars(lv_obj_t * obj, const char * list);
  */
 void lv_textarea_set_max_length(lv_obj_t * obj, uint32_t num);
 
+/**
+ * Set the max. size of the text kept by `lv_textarea_append_text()`.
+ * If the text gets longer, whole lines are removed from its beginning.
+ * @param obj       pointer to a text area object
+ * @param size      max. size of the text in bytes. 0: no limit
+ */
+void lv_textarea_set_retention_limit(lv_obj_t * obj, uint32_t size);
+
 /**
  * In `LV_EVENT_INSERT` the text which planned to be inserted can be replaced by an other text.
  * It can be used to add automatic formatting to the text area.
@@ -290,6 +309,13 @@ const char * lv_textarea_get_accepted_chars(lv_obj_t * obj);
  */
 uint32_t lv_textarea_get_max_length(lv_obj_t * obj);
 
+/**
+ * Get the max. size of the text kept by `lv_textarea_append_text()`.
+ * @param obj       pointer to a text area object
+ * @return          max. size of the text in bytes. 0: no limit
+ */
+uint32_t lv_textarea_get_retention_limit(const lv_obj_t * obj);
+
 /**
  * Find whether text is selected or not.
  * @param obj       pointer to a text area object
@@ -0,0 +1,118 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/components/lvgl/CMakeLists.txt"
+  "/root/repo/components/lvgl/env_support/cmake/custom.cmake"
+  "/root/repo/components/lvgl/tests/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/lvgl.dir/DependInfo.cmake"
+  "CMakeFiles/lvgl_examples.dir/DependInfo.cmake"
+  "CMakeFiles/lvgl_demos.dir/DependInfo.cmake"
+  "CMakeFiles/test_common.dir/DependInfo.cmake"
+  "CMakeFiles/test_arc.dir/DependInfo.cmake"
+  "CMakeFiles/test_asset_pack.dir/DependInfo.cmake"
+  "CMakeFiles/test_bar.dir/DependInfo.cmake"
+  "CMakeFiles/test_checkbox.dir/DependInfo.cmake"
+  "CMakeFiles/test_config.dir/DependInfo.cmake"
+  "CMakeFiles/test_demo_stress.dir/DependInfo.cmake"
+  "CMakeFiles/test_demo_widgets.dir/DependInfo.cmake"
+  "CMakeFiles/test_draw_label.dir/DependInfo.cmake"
+  "CMakeFiles/test_draw_mask.dir/DependInfo.cmake"
+  "CMakeFiles/test_draw_rect.dir/DependInfo.cmake"
+  "CMakeFiles/test_draw_transform.dir/DependInfo.cmake"
+  "CMakeFiles/test_dropdown.dir/DependInfo.cmake"
+  "CMakeFiles/test_event.dir/DependInfo.cmake"
+  "CMakeFiles/test_font_fmt_txt.dir/DependInfo.cmake"
+  "CMakeFiles/test_font_loader.dir/DependInfo.cmake"
+  "CMakeFiles/test_fs.dir/DependInfo.cmake"
+  "CMakeFiles/test_gif.dir/DependInfo.cmake"
+  "CMakeFiles/test_img_cache.dir/DependInfo.cmake"
+  "CMakeFiles/test_img_cache_async.dir/DependInfo.cmake"
+  "CMakeFiles/test_label.dir/DependInfo.cmake"
+  "CMakeFiles/test_line.dir/DependInfo.cmake"
+  "CMakeFiles/test_mem.dir/DependInfo.cmake"
+  "CMakeFiles/test_obj_tree.dir/DependInfo.cmake"
+  "CMakeFiles/test_png_stream.dir/DependInfo.cmake"
+  "CMakeFiles/test_sjpg.dir/DependInfo.cmake"
+  "CMakeFiles/test_slider.dir/DependInfo.cmake"
+  "CMakeFiles/test_snapshot.dir/DependInfo.cmake"
+  "CMakeFiles/test_span.dir/DependInfo.cmake"
+  "CMakeFiles/test_style.dir/DependInfo.cmake"
+  "CMakeFiles/test_switch.dir/DependInfo.cmake"
+  "CMakeFiles/test_table.dir/DependInfo.cmake"
+  "CMakeFiles/test_textarea.dir/DependInfo.cmake"
+  "CMakeFiles/test_txt.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,190 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/components/lvgl/examples/anim/lv_example_anim_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/anim/lv_example_anim_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/anim/lv_example_anim_1.c.o.d"
+  "/root/repo/components/lvgl/examples/anim/lv_example_anim_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/anim/lv_example_anim_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/anim/lv_example_anim_2.c.o.d"
+  "/root/repo/components/lvgl/examples/anim/lv_example_anim_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/anim/lv_example_anim_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/anim/lv_example_anim_3.c.o.d"
+  "/root/repo/components/lvgl/examples/anim/lv_example_anim_timeline_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/anim/lv_example_anim_timeline_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/anim/lv_example_anim_timeline_1.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/animimg001.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/animimg001.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/animimg001.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/animimg002.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/animimg002.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/animimg002.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/animimg003.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/animimg003.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/animimg003.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/emoji/img_emoji_F617.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/emoji/img_emoji_F617.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/emoji/img_emoji_F617.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_caret_down.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_caret_down.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_caret_down.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_cogwheel_alpha16.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_alpha16.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_alpha16.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_cogwheel_argb.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_argb.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_argb.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_cogwheel_chroma_keyed.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_chroma_keyed.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_chroma_keyed.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_cogwheel_indexed16.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_indexed16.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_indexed16.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_cogwheel_rgb.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_rgb.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_cogwheel_rgb.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_hand.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_hand.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_hand.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_skew_strip.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_skew_strip.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_skew_strip.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/img_star.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_star.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/img_star.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/imgbtn_left.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/imgbtn_left.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/imgbtn_left.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/imgbtn_mid.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/imgbtn_mid.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/imgbtn_mid.c.o.d"
+  "/root/repo/components/lvgl/examples/assets/imgbtn_right.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/imgbtn_right.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/assets/imgbtn_right.c.o.d"
+  "/root/repo/components/lvgl/examples/event/lv_example_event_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/event/lv_example_event_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/event/lv_example_event_1.c.o.d"
+  "/root/repo/components/lvgl/examples/event/lv_example_event_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/event/lv_example_event_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/event/lv_example_event_2.c.o.d"
+  "/root/repo/components/lvgl/examples/event/lv_example_event_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/event/lv_example_event_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/event/lv_example_event_3.c.o.d"
+  "/root/repo/components/lvgl/examples/event/lv_example_event_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/event/lv_example_event_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/event/lv_example_event_4.c.o.d"
+  "/root/repo/components/lvgl/examples/get_started/lv_example_get_started_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/get_started/lv_example_get_started_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/get_started/lv_example_get_started_1.c.o.d"
+  "/root/repo/components/lvgl/examples/get_started/lv_example_get_started_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/get_started/lv_example_get_started_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/get_started/lv_example_get_started_2.c.o.d"
+  "/root/repo/components/lvgl/examples/get_started/lv_example_get_started_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/get_started/lv_example_get_started_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/get_started/lv_example_get_started_3.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_1.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_2.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_3.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_4.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_5.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_5.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_5.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_6.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_6.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/flex/lv_example_flex_6.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_1.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_2.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_3.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_4.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_5.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_5.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_5.c.o.d"
+  "/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_6.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_6.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/layouts/grid/lv_example_grid_6.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/bmp/lv_example_bmp_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/bmp/lv_example_bmp_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/bmp/lv_example_bmp_1.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/ffmpeg/lv_example_ffmpeg_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/ffmpeg/lv_example_ffmpeg_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/ffmpeg/lv_example_ffmpeg_1.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/ffmpeg/lv_example_ffmpeg_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/ffmpeg/lv_example_ffmpeg_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/ffmpeg/lv_example_ffmpeg_2.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/freetype/lv_example_freetype_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/freetype/lv_example_freetype_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/freetype/lv_example_freetype_1.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/gif/img_bulb_gif.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/gif/img_bulb_gif.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/gif/img_bulb_gif.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/gif/lv_example_gif_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/gif/lv_example_gif_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/gif/lv_example_gif_1.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/png/img_wink_png.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/png/img_wink_png.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/png/img_wink_png.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/png/lv_example_png_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/png/lv_example_png_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/png/lv_example_png_1.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/qrcode/lv_example_qrcode_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/qrcode/lv_example_qrcode_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/qrcode/lv_example_qrcode_1.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_1.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_2.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_approve.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_approve.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/rlottie/lv_example_rlottie_approve.c.o.d"
+  "/root/repo/components/lvgl/examples/libs/sjpg/lv_example_sjpg_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/sjpg/lv_example_sjpg_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/libs/sjpg/lv_example_sjpg_1.c.o.d"
+  "/root/repo/components/lvgl/examples/others/fragment/lv_example_fragment_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/fragment/lv_example_fragment_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/fragment/lv_example_fragment_1.c.o.d"
+  "/root/repo/components/lvgl/examples/others/fragment/lv_example_fragment_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/fragment/lv_example_fragment_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/fragment/lv_example_fragment_2.c.o.d"
+  "/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_1.c.o.d"
+  "/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_2.c.o.d"
+  "/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_3.c.o.d"
+  "/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/gridnav/lv_example_gridnav_4.c.o.d"
+  "/root/repo/components/lvgl/examples/others/ime/lv_example_ime_pinyin_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/ime/lv_example_ime_pinyin_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/ime/lv_example_ime_pinyin_1.c.o.d"
+  "/root/repo/components/lvgl/examples/others/ime/lv_example_ime_pinyin_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/ime/lv_example_ime_pinyin_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/ime/lv_example_ime_pinyin_2.c.o.d"
+  "/root/repo/components/lvgl/examples/others/imgfont/lv_example_imgfont_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/imgfont/lv_example_imgfont_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/imgfont/lv_example_imgfont_1.c.o.d"
+  "/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_1.c.o.d"
+  "/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_2.c.o.d"
+  "/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/monkey/lv_example_monkey_3.c.o.d"
+  "/root/repo/components/lvgl/examples/others/msg/lv_example_msg_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/msg/lv_example_msg_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/msg/lv_example_msg_1.c.o.d"
+  "/root/repo/components/lvgl/examples/others/msg/lv_example_msg_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/msg/lv_example_msg_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/msg/lv_example_msg_2.c.o.d"
+  "/root/repo/components/lvgl/examples/others/msg/lv_example_msg_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/msg/lv_example_msg_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/msg/lv_example_msg_3.c.o.d"
+  "/root/repo/components/lvgl/examples/others/snapshot/lv_example_snapshot_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/snapshot/lv_example_snapshot_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/others/snapshot/lv_example_snapshot_1.c.o.d"
+  "/root/repo/components/lvgl/examples/porting/lv_port_disp_template.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/porting/lv_port_disp_template.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/porting/lv_port_disp_template.c.o.d"
+  "/root/repo/components/lvgl/examples/porting/lv_port_fs_template.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/porting/lv_port_fs_template.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/porting/lv_port_fs_template.c.o.d"
+  "/root/repo/components/lvgl/examples/porting/lv_port_indev_template.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/porting/lv_port_indev_template.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/porting/lv_port_indev_template.c.o.d"
+  "/root/repo/components/lvgl/examples/scroll/lv_example_scroll_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_1.c.o.d"
+  "/root/repo/components/lvgl/examples/scroll/lv_example_scroll_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_2.c.o.d"
+  "/root/repo/components/lvgl/examples/scroll/lv_example_scroll_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_3.c.o.d"
+  "/root/repo/components/lvgl/examples/scroll/lv_example_scroll_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_4.c.o.d"
+  "/root/repo/components/lvgl/examples/scroll/lv_example_scroll_5.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_5.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_5.c.o.d"
+  "/root/repo/components/lvgl/examples/scroll/lv_example_scroll_6.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_6.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/scroll/lv_example_scroll_6.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_1.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_10.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_10.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_10.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_11.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_11.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_11.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_12.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_12.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_12.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_13.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_13.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_13.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_14.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_14.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_14.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_15.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_15.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_15.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_2.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_3.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_4.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_5.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_5.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_5.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_6.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_6.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_6.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_7.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_7.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_7.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_8.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_8.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_8.c.o.d"
+  "/root/repo/components/lvgl/examples/styles/lv_example_style_9.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_9.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/styles/lv_example_style_9.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/animimg/lv_example_animimg_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/animimg/lv_example_animimg_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/animimg/lv_example_animimg_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/arc/lv_example_arc_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/arc/lv_example_arc_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/arc/lv_example_arc_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/arc/lv_example_arc_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/arc/lv_example_arc_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/arc/lv_example_arc_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_4.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_5.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_5.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_5.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_6.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_6.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/bar/lv_example_bar_6.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btn/lv_example_btn_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/btnmatrix/lv_example_btnmatrix_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/calendar/lv_example_calendar_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/calendar/lv_example_calendar_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/calendar/lv_example_calendar_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/canvas/lv_example_canvas_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/canvas/lv_example_canvas_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/canvas/lv_example_canvas_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/canvas/lv_example_canvas_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/canvas/lv_example_canvas_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/canvas/lv_example_canvas_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_4.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_5.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_5.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_5.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_6.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_6.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_6.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_7.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_7.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_7.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_8.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_8.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_8.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_9.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_9.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/chart/lv_example_chart_9.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/checkbox/lv_example_checkbox_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/checkbox/lv_example_checkbox_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/checkbox/lv_example_checkbox_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/checkbox/lv_example_checkbox_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/checkbox/lv_example_checkbox_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/checkbox/lv_example_checkbox_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/colorwheel/lv_example_colorwheel_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/colorwheel/lv_example_colorwheel_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/colorwheel/lv_example_colorwheel_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/dropdown/lv_example_dropdown_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/img/lv_example_img_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/img/lv_example_img_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/img/lv_example_img_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/img/lv_example_img_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/img/lv_example_img_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/img/lv_example_img_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/img/lv_example_img_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/img/lv_example_img_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/img/lv_example_img_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/img/lv_example_img_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/img/lv_example_img_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/img/lv_example_img_4.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/imgbtn/lv_example_imgbtn_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/imgbtn/lv_example_imgbtn_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/imgbtn/lv_example_imgbtn_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/keyboard/lv_example_keyboard_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/keyboard/lv_example_keyboard_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/keyboard/lv_example_keyboard_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/label/lv_example_label_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/label/lv_example_label_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/label/lv_example_label_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/label/lv_example_label_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_4.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/label/lv_example_label_5.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_5.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/label/lv_example_label_5.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/led/lv_example_led_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/led/lv_example_led_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/led/lv_example_led_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/line/lv_example_line_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/line/lv_example_line_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/line/lv_example_line_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/list/lv_example_list_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/list/lv_example_list_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/list/lv_example_list_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/list/lv_example_list_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/list/lv_example_list_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/list/lv_example_list_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_4.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_5.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_5.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/menu/lv_example_menu_5.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_4.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_4.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/meter/lv_example_meter_4.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/msgbox/lv_example_msgbox_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/msgbox/lv_example_msgbox_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/msgbox/lv_example_msgbox_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/obj/lv_example_obj_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/obj/lv_example_obj_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/obj/lv_example_obj_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/obj/lv_example_obj_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/obj/lv_example_obj_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/obj/lv_example_obj_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/roller/lv_example_roller_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/slider/lv_example_slider_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/span/lv_example_span_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/span/lv_example_span_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/span/lv_example_span_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/spinbox/lv_example_spinbox_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/spinbox/lv_example_spinbox_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/spinbox/lv_example_spinbox_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/spinner/lv_example_spinner_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/spinner/lv_example_spinner_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/spinner/lv_example_spinner_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/switch/lv_example_switch_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/switch/lv_example_switch_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/switch/lv_example_switch_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/table/lv_example_table_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/table/lv_example_table_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/table/lv_example_table_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/table/lv_example_table_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/table/lv_example_table_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/table/lv_example_table_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/tabview/lv_example_tabview_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/tabview/lv_example_tabview_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/tabview/lv_example_tabview_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/tabview/lv_example_tabview_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/tabview/lv_example_tabview_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/tabview/lv_example_tabview_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_2.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_2.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_2.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_3.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_3.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/textarea/lv_example_textarea_3.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/tileview/lv_example_tileview_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/tileview/lv_example_tileview_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/tileview/lv_example_tileview_1.c.o.d"
+  "/root/repo/components/lvgl/examples/widgets/win/lv_example_win_1.c" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/win/lv_example_win_1.c.o" "gcc" "CMakeFiles/lvgl_examples.dir/root/repo/components/lvgl/examples/widgets/win/lv_example_win_1.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/components/lvgl/tests/build_16bit/CMakeFiles/lvgl.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_arc.dir/src/test_cases/test_arc.c.o"
+  "CMakeFiles/test_arc.dir/src/test_cases/test_arc.c.o.d"
+  "CMakeFiles/test_arc.dir/src/test_runners/test_arc_Runner.c.o"
+  "CMakeFiles/test_arc.dir/src/test_runners/test_arc_Runner.c.o.d"
+  "test_arc"
+  "test_arc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_arc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
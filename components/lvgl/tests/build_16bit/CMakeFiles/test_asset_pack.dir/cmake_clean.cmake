@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_asset_pack.dir/src/test_cases/test_asset_pack.c.o"
+  "CMakeFiles/test_asset_pack.dir/src/test_cases/test_asset_pack.c.o.d"
+  "CMakeFiles/test_asset_pack.dir/src/test_runners/test_asset_pack_Runner.c.o"
+  "CMakeFiles/test_asset_pack.dir/src/test_runners/test_asset_pack_Runner.c.o.d"
+  "test_asset_pack"
+  "test_asset_pack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_asset_pack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
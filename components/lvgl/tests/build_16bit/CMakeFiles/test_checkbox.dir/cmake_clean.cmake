@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_checkbox.dir/src/test_cases/test_checkbox.c.o"
+  "CMakeFiles/test_checkbox.dir/src/test_cases/test_checkbox.c.o.d"
+  "CMakeFiles/test_checkbox.dir/src/test_runners/test_checkbox_Runner.c.o"
+  "CMakeFiles/test_checkbox.dir/src/test_runners/test_checkbox_Runner.c.o.d"
+  "test_checkbox"
+  "test_checkbox.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_checkbox.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
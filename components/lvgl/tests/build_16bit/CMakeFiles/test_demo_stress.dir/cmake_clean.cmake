@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_demo_stress.dir/src/test_cases/test_demo_stress.c.o"
+  "CMakeFiles/test_demo_stress.dir/src/test_cases/test_demo_stress.c.o.d"
+  "CMakeFiles/test_demo_stress.dir/src/test_runners/test_demo_stress_Runner.c.o"
+  "CMakeFiles/test_demo_stress.dir/src/test_runners/test_demo_stress_Runner.c.o.d"
+  "test_demo_stress"
+  "test_demo_stress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_demo_stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_demo_widgets.dir/src/test_cases/test_demo_widgets.c.o"
+  "CMakeFiles/test_demo_widgets.dir/src/test_cases/test_demo_widgets.c.o.d"
+  "CMakeFiles/test_demo_widgets.dir/src/test_runners/test_demo_widgets_Runner.c.o"
+  "CMakeFiles/test_demo_widgets.dir/src/test_runners/test_demo_widgets_Runner.c.o.d"
+  "test_demo_widgets"
+  "test_demo_widgets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_demo_widgets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_draw_mask.dir/src/test_cases/test_draw_mask.c.o"
+  "CMakeFiles/test_draw_mask.dir/src/test_cases/test_draw_mask.c.o.d"
+  "CMakeFiles/test_draw_mask.dir/src/test_runners/test_draw_mask_Runner.c.o"
+  "CMakeFiles/test_draw_mask.dir/src/test_runners/test_draw_mask_Runner.c.o.d"
+  "test_draw_mask"
+  "test_draw_mask.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_draw_mask.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fs.dir/src/test_cases/test_fs.c.o"
+  "CMakeFiles/test_fs.dir/src/test_cases/test_fs.c.o.d"
+  "CMakeFiles/test_fs.dir/src/test_runners/test_fs_Runner.c.o"
+  "CMakeFiles/test_fs.dir/src/test_runners/test_fs_Runner.c.o.d"
+  "test_fs"
+  "test_fs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_fs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
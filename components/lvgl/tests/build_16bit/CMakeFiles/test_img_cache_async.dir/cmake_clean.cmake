@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_img_cache_async.dir/src/test_cases/test_img_cache_async.c.o"
+  "CMakeFiles/test_img_cache_async.dir/src/test_cases/test_img_cache_async.c.o.d"
+  "CMakeFiles/test_img_cache_async.dir/src/test_runners/test_img_cache_async_Runner.c.o"
+  "CMakeFiles/test_img_cache_async.dir/src/test_runners/test_img_cache_async_Runner.c.o.d"
+  "test_img_cache_async"
+  "test_img_cache_async.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_img_cache_async.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mem.dir/src/test_cases/test_mem.c.o"
+  "CMakeFiles/test_mem.dir/src/test_cases/test_mem.c.o.d"
+  "CMakeFiles/test_mem.dir/src/test_runners/test_mem_Runner.c.o"
+  "CMakeFiles/test_mem.dir/src/test_runners/test_mem_Runner.c.o.d"
+  "test_mem"
+  "test_mem.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_mem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_png_stream.dir/src/test_cases/test_png_stream.c.o"
+  "CMakeFiles/test_png_stream.dir/src/test_cases/test_png_stream.c.o.d"
+  "CMakeFiles/test_png_stream.dir/src/test_runners/test_png_stream_Runner.c.o"
+  "CMakeFiles/test_png_stream.dir/src/test_runners/test_png_stream_Runner.c.o.d"
+  "test_png_stream"
+  "test_png_stream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_png_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sjpg.dir/src/test_cases/test_sjpg.c.o"
+  "CMakeFiles/test_sjpg.dir/src/test_cases/test_sjpg.c.o.d"
+  "CMakeFiles/test_sjpg.dir/src/test_runners/test_sjpg_Runner.c.o"
+  "CMakeFiles/test_sjpg.dir/src/test_runners/test_sjpg_Runner.c.o.d"
+  "test_sjpg"
+  "test_sjpg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_sjpg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
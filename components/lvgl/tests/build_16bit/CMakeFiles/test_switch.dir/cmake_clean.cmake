@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_switch.dir/src/test_cases/test_switch.c.o"
+  "CMakeFiles/test_switch.dir/src/test_cases/test_switch.c.o.d"
+  "CMakeFiles/test_switch.dir/src/test_runners/test_switch_Runner.c.o"
+  "CMakeFiles/test_switch.dir/src/test_runners/test_switch_Runner.c.o.d"
+  "test_switch"
+  "test_switch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_switch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
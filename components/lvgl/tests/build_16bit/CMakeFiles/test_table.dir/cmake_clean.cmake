@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_table.dir/src/test_cases/test_table.c.o"
+  "CMakeFiles/test_table.dir/src/test_cases/test_table.c.o.d"
+  "CMakeFiles/test_table.dir/src/test_runners/test_table_Runner.c.o"
+  "CMakeFiles/test_table.dir/src/test_runners/test_table_Runner.c.o.d"
+  "test_table"
+  "test_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
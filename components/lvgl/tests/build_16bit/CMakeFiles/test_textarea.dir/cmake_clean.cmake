@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_textarea.dir/src/test_cases/test_textarea.c.o"
+  "CMakeFiles/test_textarea.dir/src/test_cases/test_textarea.c.o.d"
+  "CMakeFiles/test_textarea.dir/src/test_runners/test_textarea_Runner.c.o"
+  "CMakeFiles/test_textarea.dir/src/test_runners/test_textarea_Runner.c.o.d"
+  "test_textarea"
+  "test_textarea.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_textarea.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_txt.dir/src/test_cases/test_txt.c.o"
+  "CMakeFiles/test_txt.dir/src/test_cases/test_txt.c.o.d"
+  "CMakeFiles/test_txt.dir/src/test_runners/test_txt_Runner.c.o"
+  "CMakeFiles/test_txt.dir/src/test_runners/test_txt_Runner.c.o.d"
+  "test_txt"
+  "test_txt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_txt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
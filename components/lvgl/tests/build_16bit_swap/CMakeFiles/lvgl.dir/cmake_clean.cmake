@@ -0,0 +1,391 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_disp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_disp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_event.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_event.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_group.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_group.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_indev.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_indev.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_indev_scroll.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_indev_scroll.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_class.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_class.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_draw.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_draw.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_pos.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_pos.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_scroll.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_scroll.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_style.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_style.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_style_gen.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_style_gen.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_tree.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_obj_tree.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_refr.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_refr.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_theme.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/core/lv_theme.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/arm2d/lv_gpu_arm2d.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/arm2d/lv_gpu_arm2d.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_img.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_img.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_label.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_label.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_layer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_layer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_mask.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_mask.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_mask_circle_tables.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_mask_circle_tables.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_rect.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_rect.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_transform.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_transform.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_triangle.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_draw_triangle.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_img_buf.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_img_buf.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_img_cache.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_img_cache.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_img_decoder.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/lv_img_decoder.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/pxp/lv_draw_pxp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/pxp/lv_draw_pxp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/pxp/lv_draw_pxp_blend.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/pxp/lv_draw_pxp_blend.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/pxp/lv_gpu_nxp_pxp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/pxp/lv_gpu_nxp_pxp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/pxp/lv_gpu_nxp_pxp_osa.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/pxp/lv_gpu_nxp_pxp_osa.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite_blend.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite_blend.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite_rect.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_draw_vglite_rect.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_vglite_buf.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_vglite_buf.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_vglite_utils.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/nxp/vglite/lv_vglite_utils.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_bg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_bg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_composite.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_composite.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_img.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_img.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_label.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_label.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_layer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_layer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_mask.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_mask.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_polygon.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_polygon.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_rect.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_rect.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_stack_blur.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_stack_blur.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_texture_cache.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_texture_cache.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_utils.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sdl/lv_draw_sdl_utils.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/stm32_dma2d/lv_gpu_stm32_dma2d.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/stm32_dma2d/lv_gpu_stm32_dma2d.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_blend.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_blend.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_dither.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_dither.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_gradient.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_gradient.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_img.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_img.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_layer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_layer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_letter.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_letter.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_polygon.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_polygon.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_rect.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_rect.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_transform.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/sw/lv_draw_sw_transform.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/swm341_dma2d/lv_gpu_swm341_dma2d.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/draw/swm341_dma2d/lv_gpu_swm341_dma2d.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/layouts/flex/lv_flex.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/layouts/flex/lv_flex.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/layouts/grid/lv_grid.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/layouts/grid/lv_grid.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/asset_pack/lv_asset_pack.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/asset_pack/lv_asset_pack.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/bmp/lv_bmp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/bmp/lv_bmp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/ffmpeg/lv_ffmpeg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/ffmpeg/lv_ffmpeg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/freetype/lv_freetype.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/freetype/lv_freetype.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/fsdrv/lv_fs_fatfs.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/fsdrv/lv_fs_fatfs.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/fsdrv/lv_fs_posix.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/fsdrv/lv_fs_posix.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/fsdrv/lv_fs_stdio.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/fsdrv/lv_fs_stdio.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/fsdrv/lv_fs_win32.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/fsdrv/lv_fs_win32.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/gif/gifdec.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/gif/gifdec.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/gif/lv_gif.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/gif/lv_gif.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/png/lodepng.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/png/lodepng.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/png/lv_png.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/png/lv_png.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/png/lv_png_stream.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/png/lv_png_stream.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/qrcode/lv_qrcode.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/qrcode/lv_qrcode.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/qrcode/qrcodegen.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/qrcode/qrcodegen.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/rlottie/lv_rlottie.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/rlottie/lv_rlottie.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/sjpg/lv_sjpg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/sjpg/lv_sjpg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/sjpg/tjpgd.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/libs/sjpg/tjpgd.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/lv_extra.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/lv_extra.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/fragment/lv_fragment.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/fragment/lv_fragment.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/fragment/lv_fragment_manager.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/fragment/lv_fragment_manager.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/gridnav/lv_gridnav.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/gridnav/lv_gridnav.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/ime/lv_ime_pinyin.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/ime/lv_ime_pinyin.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/imgfont/lv_imgfont.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/imgfont/lv_imgfont.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/monkey/lv_monkey.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/monkey/lv_monkey.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/msg/lv_msg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/msg/lv_msg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/snapshot/lv_snapshot.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/others/snapshot/lv_snapshot.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/themes/basic/lv_theme_basic.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/themes/basic/lv_theme_basic.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/themes/default/lv_theme_default.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/themes/default/lv_theme_default.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/themes/mono/lv_theme_mono.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/themes/mono/lv_theme_mono.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/animimg/lv_animimg.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/animimg/lv_animimg.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/calendar/lv_calendar.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/calendar/lv_calendar.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/calendar/lv_calendar_header_arrow.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/calendar/lv_calendar_header_arrow.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/calendar/lv_calendar_header_dropdown.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/calendar/lv_calendar_header_dropdown.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/chart/lv_chart.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/chart/lv_chart.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/colorwheel/lv_colorwheel.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/colorwheel/lv_colorwheel.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/imgbtn/lv_imgbtn.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/imgbtn/lv_imgbtn.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/keyboard/lv_keyboard.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/keyboard/lv_keyboard.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/led/lv_led.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/led/lv_led.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/list/lv_list.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/list/lv_list.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/menu/lv_menu.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/menu/lv_menu.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/meter/lv_meter.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/meter/lv_meter.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/msgbox/lv_msgbox.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/msgbox/lv_msgbox.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/span/lv_span.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/span/lv_span.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/spinbox/lv_spinbox.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/spinbox/lv_spinbox.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/spinner/lv_spinner.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/spinner/lv_spinner.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/tabview/lv_tabview.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/tabview/lv_tabview.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/tileview/lv_tileview.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/tileview/lv_tileview.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/win/lv_win.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/extra/widgets/win/lv_win.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_dejavu_16_persian_hebrew.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_dejavu_16_persian_hebrew.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_fmt_txt.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_fmt_txt.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_loader.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_loader.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_10.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_10.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_12.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_12.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_12_subpx.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_12_subpx.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_14.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_14.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_16.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_16.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_18.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_18.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_20.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_20.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_22.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_22.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_24.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_24.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_26.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_26.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_28.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_28.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_28_compressed.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_28_compressed.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_30.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_30.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_32.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_32.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_34.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_34.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_36.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_36.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_38.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_38.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_40.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_40.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_42.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_42.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_44.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_44.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_46.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_46.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_48.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_48.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_8.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_montserrat_8.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_simsun_16_cjk.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_simsun_16_cjk.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_unscii_16.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_unscii_16.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_unscii_8.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/font/lv_font_unscii_8.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/hal/lv_hal_disp.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/hal/lv_hal_disp.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/hal/lv_hal_indev.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/hal/lv_hal_indev.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/hal/lv_hal_tick.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/hal/lv_hal_tick.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_anim.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_anim.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_anim_timeline.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_anim_timeline.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_area.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_area.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_async.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_async.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_bidi.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_bidi.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_color.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_color.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_fs.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_fs.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_gc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_gc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_ll.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_ll.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_log.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_log.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_lru.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_lru.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_math.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_math.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_mem.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_mem.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_printf.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_printf.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_style.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_style.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_style_gen.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_style_gen.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_templ.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_templ.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_timer.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_timer.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_tlsf.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_tlsf.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_txt.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_txt.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_txt_ap.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_txt_ap.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_utils.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/misc/lv_utils.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_arc.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_arc.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_bar.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_bar.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_btn.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_btn.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_btnmatrix.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_btnmatrix.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_canvas.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_canvas.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_checkbox.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_checkbox.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_dropdown.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_dropdown.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_img.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_img.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_label.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_label.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_line.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_line.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_objx_templ.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_objx_templ.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_roller.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_roller.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_slider.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_slider.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_switch.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_switch.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_table.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_table.c.o.d"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_textarea.c.o"
+  "CMakeFiles/lvgl.dir/root/repo/components/lvgl/src/widgets/lv_textarea.c.o.d"
+  "lib/liblvgl.a"
+  "lib/liblvgl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvgl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,129 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_alpha16.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_alpha16.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_argb.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_argb.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_chroma_keyed.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_chroma_keyed.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_indexed16.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_indexed16.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_rgb.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_rgb.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_rgb565a8.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/img_benchmark_cogwheel_rgb565a8.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/lv_font_bechmark_montserrat_12_compr_az.c.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/lv_font_bechmark_montserrat_12_compr_az.c.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/lv_font_bechmark_montserrat_16_compr_az.c.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/lv_font_bechmark_montserrat_16_compr_az.c.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/lv_font_bechmark_montserrat_28_compr_az.c.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/assets/lv_font_bechmark_montserrat_28_compr_az.c.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/lv_demo_benchmark.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/benchmark/lv_demo_benchmark.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/keypad_encoder/lv_demo_keypad_encoder.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/keypad_encoder/lv_demo_keypad_encoder.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_corner_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_corner_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_list_pause.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_list_pause.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_list_pause_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_list_pause_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_list_play.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_list_play.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_list_play_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_list_play_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_loop.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_loop.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_loop_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_loop_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_next.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_next.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_next_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_next_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_pause.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_pause.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_pause_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_pause_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_play.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_play.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_play_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_play_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_prev.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_prev.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_prev_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_prev_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_rnd.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_rnd.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_rnd_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_btn_rnd_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_corner_left.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_corner_left.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_corner_left_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_corner_left_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_corner_right.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_corner_right.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_corner_right_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_corner_right_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_cover_1.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_cover_1.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_cover_2.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_cover_2.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_cover_3.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_cover_3.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_1.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_1.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_1_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_1_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_2.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_2.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_2_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_2_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_3.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_3.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_3_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_3_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_4.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_4.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_4_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_icon_4_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_list_border.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_list_border.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_list_border_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_list_border_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_logo.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_logo.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_slider_knob.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_slider_knob.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_slider_knob_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_slider_knob_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_wave_bottom.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_wave_bottom.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_wave_bottom_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_wave_bottom_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_wave_top.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_wave_top.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_wave_top_large.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/assets/img_lv_demo_music_wave_top_large.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/lv_demo_music.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/lv_demo_music.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/lv_demo_music_list.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/lv_demo_music_list.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/lv_demo_music_main.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/music/lv_demo_music_main.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/stress/lv_demo_stress.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/stress/lv_demo_stress.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/widgets/assets/img_clothes.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/widgets/assets/img_clothes.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/widgets/assets/img_demo_widgets_avatar.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/widgets/assets/img_demo_widgets_avatar.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/widgets/assets/img_lvgl_logo.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/widgets/assets/img_lvgl_logo.c.o.d"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/widgets/lv_demo_widgets.c.o"
+  "CMakeFiles/lvgl_demos.dir/root/repo/components/lvgl/demos/widgets/lv_demo_widgets.c.o.d"
+  "liblvgl_demos.a"
+  "liblvgl_demos.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/lvgl_demos.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
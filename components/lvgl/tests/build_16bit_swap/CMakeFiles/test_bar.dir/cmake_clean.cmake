@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bar.dir/src/test_cases/test_bar.c.o"
+  "CMakeFiles/test_bar.dir/src/test_cases/test_bar.c.o.d"
+  "CMakeFiles/test_bar.dir/src/test_runners/test_bar_Runner.c.o"
+  "CMakeFiles/test_bar.dir/src/test_runners/test_bar_Runner.c.o.d"
+  "test_bar"
+  "test_bar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_draw_label.dir/src/test_cases/test_draw_label.c.o"
+  "CMakeFiles/test_draw_label.dir/src/test_cases/test_draw_label.c.o.d"
+  "CMakeFiles/test_draw_label.dir/src/test_runners/test_draw_label_Runner.c.o"
+  "CMakeFiles/test_draw_label.dir/src/test_runners/test_draw_label_Runner.c.o.d"
+  "test_draw_label"
+  "test_draw_label.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_draw_label.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_draw_rect.dir/src/test_cases/test_draw_rect.c.o"
+  "CMakeFiles/test_draw_rect.dir/src/test_cases/test_draw_rect.c.o.d"
+  "CMakeFiles/test_draw_rect.dir/src/test_runners/test_draw_rect_Runner.c.o"
+  "CMakeFiles/test_draw_rect.dir/src/test_runners/test_draw_rect_Runner.c.o.d"
+  "test_draw_rect"
+  "test_draw_rect.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_draw_rect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
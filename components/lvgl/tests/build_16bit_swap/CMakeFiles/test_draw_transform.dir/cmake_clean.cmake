@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_draw_transform.dir/src/test_cases/test_draw_transform.c.o"
+  "CMakeFiles/test_draw_transform.dir/src/test_cases/test_draw_transform.c.o.d"
+  "CMakeFiles/test_draw_transform.dir/src/test_runners/test_draw_transform_Runner.c.o"
+  "CMakeFiles/test_draw_transform.dir/src/test_runners/test_draw_transform_Runner.c.o.d"
+  "test_draw_transform"
+  "test_draw_transform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_draw_transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_font_fmt_txt.dir/src/test_cases/test_font_fmt_txt.c.o"
+  "CMakeFiles/test_font_fmt_txt.dir/src/test_cases/test_font_fmt_txt.c.o.d"
+  "CMakeFiles/test_font_fmt_txt.dir/src/test_runners/test_font_fmt_txt_Runner.c.o"
+  "CMakeFiles/test_font_fmt_txt.dir/src/test_runners/test_font_fmt_txt_Runner.c.o.d"
+  "test_font_fmt_txt"
+  "test_font_fmt_txt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_font_fmt_txt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
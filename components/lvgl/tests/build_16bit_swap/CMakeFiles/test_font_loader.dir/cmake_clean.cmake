@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_font_loader.dir/src/test_cases/test_font_loader.c.o"
+  "CMakeFiles/test_font_loader.dir/src/test_cases/test_font_loader.c.o.d"
+  "CMakeFiles/test_font_loader.dir/src/test_runners/test_font_loader_Runner.c.o"
+  "CMakeFiles/test_font_loader.dir/src/test_runners/test_font_loader_Runner.c.o.d"
+  "test_font_loader"
+  "test_font_loader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_font_loader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
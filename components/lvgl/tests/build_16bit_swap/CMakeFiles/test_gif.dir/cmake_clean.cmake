@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gif.dir/src/test_cases/test_gif.c.o"
+  "CMakeFiles/test_gif.dir/src/test_cases/test_gif.c.o.d"
+  "CMakeFiles/test_gif.dir/src/test_runners/test_gif_Runner.c.o"
+  "CMakeFiles/test_gif.dir/src/test_runners/test_gif_Runner.c.o.d"
+  "test_gif"
+  "test_gif.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_gif.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_img_cache.dir/src/test_cases/test_img_cache.c.o"
+  "CMakeFiles/test_img_cache.dir/src/test_cases/test_img_cache.c.o.d"
+  "CMakeFiles/test_img_cache.dir/src/test_runners/test_img_cache_Runner.c.o"
+  "CMakeFiles/test_img_cache.dir/src/test_runners/test_img_cache_Runner.c.o.d"
+  "test_img_cache"
+  "test_img_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_img_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
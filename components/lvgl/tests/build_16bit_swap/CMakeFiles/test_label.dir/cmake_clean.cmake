@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_label.dir/src/test_cases/test_label.c.o"
+  "CMakeFiles/test_label.dir/src/test_cases/test_label.c.o.d"
+  "CMakeFiles/test_label.dir/src/test_runners/test_label_Runner.c.o"
+  "CMakeFiles/test_label.dir/src/test_runners/test_label_Runner.c.o.d"
+  "test_label"
+  "test_label.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_label.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_slider.dir/src/test_cases/test_slider.c.o"
+  "CMakeFiles/test_slider.dir/src/test_cases/test_slider.c.o.d"
+  "CMakeFiles/test_slider.dir/src/test_runners/test_slider_Runner.c.o"
+  "CMakeFiles/test_slider.dir/src/test_runners/test_slider_Runner.c.o.d"
+  "test_slider"
+  "test_slider.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_slider.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_span.dir/src/test_cases/test_span.c.o"
+  "CMakeFiles/test_span.dir/src/test_cases/test_span.c.o.d"
+  "CMakeFiles/test_span.dir/src/test_runners/test_span_Runner.c.o"
+  "CMakeFiles/test_span.dir/src/test_runners/test_span_Runner.c.o.d"
+  "test_span"
+  "test_span.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_span.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_style.dir/src/test_cases/test_style.c.o"
+  "CMakeFiles/test_style.dir/src/test_cases/test_style.c.o.d"
+  "CMakeFiles/test_style.dir/src/test_runners/test_style_Runner.c.o"
+  "CMakeFiles/test_style.dir/src/test_runners/test_style_Runner.c.o.d"
+  "test_style"
+  "test_style.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_style.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,72 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/components/lvgl/tests
+# Build directory: /root/repo/components/lvgl/tests/build_16bit_swap
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_arc "/root/repo/components/lvgl/tests/build_16bit_swap/test_arc")
+set_tests_properties(test_arc PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_asset_pack "/root/repo/components/lvgl/tests/build_16bit_swap/test_asset_pack")
+set_tests_properties(test_asset_pack PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_bar "/root/repo/components/lvgl/tests/build_16bit_swap/test_bar")
+set_tests_properties(test_bar PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_checkbox "/root/repo/components/lvgl/tests/build_16bit_swap/test_checkbox")
+set_tests_properties(test_checkbox PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_config "/root/repo/components/lvgl/tests/build_16bit_swap/test_config")
+set_tests_properties(test_config PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_demo_stress "/root/repo/components/lvgl/tests/build_16bit_swap/test_demo_stress")
+set_tests_properties(test_demo_stress PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_demo_widgets "/root/repo/components/lvgl/tests/build_16bit_swap/test_demo_widgets")
+set_tests_properties(test_demo_widgets PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_draw_label "/root/repo/components/lvgl/tests/build_16bit_swap/test_draw_label")
+set_tests_properties(test_draw_label PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_draw_mask "/root/repo/components/lvgl/tests/build_16bit_swap/test_draw_mask")
+set_tests_properties(test_draw_mask PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_draw_rect "/root/repo/components/lvgl/tests/build_16bit_swap/test_draw_rect")
+set_tests_properties(test_draw_rect PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_draw_transform "/root/repo/components/lvgl/tests/build_16bit_swap/test_draw_transform")
+set_tests_properties(test_draw_transform PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_dropdown "/root/repo/components/lvgl/tests/build_16bit_swap/test_dropdown")
+set_tests_properties(test_dropdown PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_event "/root/repo/components/lvgl/tests/build_16bit_swap/test_event")
+set_tests_properties(test_event PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_font_fmt_txt "/root/repo/components/lvgl/tests/build_16bit_swap/test_font_fmt_txt")
+set_tests_properties(test_font_fmt_txt PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_font_loader "/root/repo/components/lvgl/tests/build_16bit_swap/test_font_loader")
+set_tests_properties(test_font_loader PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_fs "/root/repo/components/lvgl/tests/build_16bit_swap/test_fs")
+set_tests_properties(test_fs PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_gif "/root/repo/components/lvgl/tests/build_16bit_swap/test_gif")
+set_tests_properties(test_gif PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_img_cache "/root/repo/components/lvgl/tests/build_16bit_swap/test_img_cache")
+set_tests_properties(test_img_cache PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_img_cache_async "/root/repo/components/lvgl/tests/build_16bit_swap/test_img_cache_async")
+set_tests_properties(test_img_cache_async PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_label "/root/repo/components/lvgl/tests/build_16bit_swap/test_label")
+set_tests_properties(test_label PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_line "/root/repo/components/lvgl/tests/build_16bit_swap/test_line")
+set_tests_properties(test_line PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_mem "/root/repo/components/lvgl/tests/build_16bit_swap/test_mem")
+set_tests_properties(test_mem PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_obj_tree "/root/repo/components/lvgl/tests/build_16bit_swap/test_obj_tree")
+set_tests_properties(test_obj_tree PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_png_stream "/root/repo/components/lvgl/tests/build_16bit_swap/test_png_stream")
+set_tests_properties(test_png_stream PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_sjpg "/root/repo/components/lvgl/tests/build_16bit_swap/test_sjpg")
+set_tests_properties(test_sjpg PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_slider "/root/repo/components/lvgl/tests/build_16bit_swap/test_slider")
+set_tests_properties(test_slider PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_snapshot "/root/repo/components/lvgl/tests/build_16bit_swap/test_snapshot")
+set_tests_properties(test_snapshot PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_span "/root/repo/components/lvgl/tests/build_16bit_swap/test_span")
+set_tests_properties(test_span PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_style "/root/repo/components/lvgl/tests/build_16bit_swap/test_style")
+set_tests_properties(test_style PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_switch "/root/repo/components/lvgl/tests/build_16bit_swap/test_switch")
+set_tests_properties(test_switch PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_table "/root/repo/components/lvgl/tests/build_16bit_swap/test_table")
+set_tests_properties(test_table PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_textarea "/root/repo/components/lvgl/tests/build_16bit_swap/test_textarea")
+set_tests_properties(test_textarea PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")
+add_test(test_txt "/root/repo/components/lvgl/tests/build_16bit_swap/test_txt")
+set_tests_properties(test_txt PROPERTIES  WORKING_DIRECTORY "/root/repo/components/lvgl/tests" _BACKTRACE_TRIPLES "/root/repo/components/lvgl/tests/CMakeLists.txt;394;add_test;/root/repo/components/lvgl/tests/CMakeLists.txt;0;")